@@ -19,6 +19,7 @@
 #include "conversion.h"
 #include "serde.h"
 #include "signatures.h"
+#include "udf.h"
 
 namespace facebook::velox::py {
 using namespace velox;
@@ -225,6 +226,8 @@ static VectorPtr evaluateExpression(
   RowVectorPtr rowVector = std::make_shared<RowVector>(
       pool, rowType, BufferPtr{nullptr}, numRows, inputs);
   core::TypedExprPtr typed = core::Expressions::inferTypes(expr, rowType, pool);
+  // Python functions called by the expression acquire the GIL themselves.
+  py::gil_scoped_release release;
   exec::ExprSet set({typed}, PyVeloxContext::getSingletonInstance().execCtx());
   exec::EvalCtx evalCtx(
       PyVeloxContext::getSingletonInstance().execCtx(), &set, rowVector.get());
@@ -313,6 +316,7 @@ PYBIND11_MODULE(pyvelox, m) {
   addSignatureBindings(m);
   addSerdeBindings(m);
   addConversionBindings(m);
+  addUdfBindings(m);
   m.attr("__version__") = "dev";
 }
 #endif
@@ -0,0 +1,85 @@
+# Copyright (c) Facebook, Inc. and its affiliates.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pyarrow as pa
+import pyarrow.compute as pc
+import pyvelox.pyvelox as pv
+import unittest
+
+
+class TestVeloxUdf(unittest.TestCase):
+    def test_scalar_udf(self):
+        pv.register_udf(
+            "py_times_two",
+            lambda a: pc.multiply(a, 2),
+            [pv.BigintType()],
+            pv.BigintType(),
+        )
+        expr = pv.Expression.from_string("py_times_two(a) + 1")
+        a = pv.from_list([1, 2, None, 4])
+        b = expr.evaluate({"a": a})
+        self.assertEqual(b[0], 3)
+        self.assertEqual(b[1], 5)
+        self.assertEqual(b[2], None)
+        self.assertEqual(b[3], 9)
+
+    def test_called_once_per_batch(self):
+        batch_sizes = []
+
+        def concat(a, b):
+            batch_sizes.append(len(a))
+            return pc.binary_join_element_wise(a, b, "-")
+
+        pv.register_udf(
+            "py_concat",
+            concat,
+            [pv.VarcharType(), pv.VarcharType()],
+            pv.VarcharType(),
+        )
+        expr = pv.Expression.from_string("py_concat(a, b)")
+        a = pv.from_list(["x", "y", "z"])
+        b = pv.from_list(["1", "2", "3"])
+        c = expr.evaluate({"a": a, "b": b})
+        self.assertEqual([c[i] for i in range(3)], ["x-1", "y-2", "z-3"])
+        self.assertEqual(batch_sizes, [3])
+
+    def test_list_result(self):
+        pv.register_udf(
+            "py_length",
+            lambda a: [len(s) for s in a.to_pylist()],
+            [pv.VarcharType()],
+            pv.BigintType(),
+        )
+        expr = pv.Expression.from_string("py_length(a)")
+        c = expr.evaluate({"a": pv.from_list(["a", "bb", "ccc"])})
+        self.assertEqual([c[i] for i in range(3)], [1, 2, 3])
+
+    def test_errors(self):
+        def fail(a):
+            raise ValueError("bad input")
+
+        pv.register_udf("py_fail", fail, [pv.BigintType()], pv.BigintType())
+        expr = pv.Expression.from_string("py_fail(a)")
+        with self.assertRaisesRegex(RuntimeError, "bad input"):
+            expr.evaluate({"a": pv.from_list([1, 2])})
+
+        pv.register_udf(
+            "py_wrong_type",
+            lambda a: pa.array(["x"] * len(a)),
+            [pv.BigintType()],
+            pv.BigintType(),
+        )
+        expr = pv.Expression.from_string("py_wrong_type(a)")
+        with self.assertRaisesRegex(RuntimeError, "expected BIGINT"):
+            expr.evaluate({"a": pv.from_list([1, 2])})
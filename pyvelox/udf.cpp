@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "udf.h"
+#include <folly/String.h>
+#include <pybind11/stl.h>
+#include <velox/expression/VectorFunction.h>
+#include <velox/vector/arrow/Abi.h>
+#include <velox/vector/arrow/Bridge.h>
+
+namespace facebook::velox::py {
+
+namespace py = pybind11;
+
+namespace {
+
+// Calls a Python callable once per batch. The arguments are exported to
+// pyarrow arrays and the pyarrow array returned by the callable is imported
+// back. Flat vectors are exported and imported without copying the buffers.
+// The GIL is only held while calling into Python, so Velox threads evaluating
+// other expressions are not serialized.
+class PythonVectorFunction : public exec::VectorFunction {
+ public:
+  PythonVectorFunction(std::string name, py::function callable)
+      : name_(std::move(name)), callable_(std::move(callable)) {}
+
+  ~PythonVectorFunction() override {
+    // Functions still registered at exit are destroyed after the interpreter.
+    if (!Py_IsInitialized()) {
+      callable_.release();
+      return;
+    }
+    py::gil_scoped_acquire acquire;
+    callable_ = py::function();
+  }
+
+  void apply(
+      const SelectivityVector& rows,
+      std::vector<VectorPtr>& args,
+      const TypePtr& outputType,
+      exec::EvalCtx& context,
+      VectorPtr& result) const override {
+    ArrowOptions options;
+    options.flattenDictionary = true;
+    options.flattenConstant = true;
+
+    std::vector<ArrowArray> arrowArrays(args.size());
+    std::vector<ArrowSchema> arrowSchemas(args.size());
+    for (auto i = 0; i < args.size(); ++i) {
+      exportToArrow(args[i], arrowArrays[i], context.pool(), options);
+      exportToArrow(args[i], arrowSchemas[i], options);
+    }
+
+    ArrowArray resultArray{};
+    ArrowSchema resultSchema{};
+    std::string error;
+    {
+      py::gil_scoped_acquire acquire;
+      try {
+        auto arrayClass = py::module::import("pyarrow").attr("Array");
+        py::list pyArgs;
+        for (auto i = 0; i < args.size(); ++i) {
+          // pyarrow takes ownership of the exported array and schema.
+          pyArgs.append(arrayClass.attr("_import_from_c")(
+              reinterpret_cast<uintptr_t>(&arrowArrays[i]),
+              reinterpret_cast<uintptr_t>(&arrowSchemas[i])));
+        }
+        auto pyResult = callable_(*pyArgs);
+        if (!py::isinstance(pyResult, arrayClass)) {
+          pyResult = py::module::import("pyarrow").attr("array")(pyResult);
+        }
+        pyResult.attr("_export_to_c")(
+            reinterpret_cast<uintptr_t>(&resultArray),
+            reinterpret_cast<uintptr_t>(&resultSchema));
+      } catch (const std::exception& e) {
+        error = e.what();
+      }
+    }
+
+    // Releases the arguments pyarrow did not take ownership of.
+    for (auto i = 0; i < args.size(); ++i) {
+      if (arrowArrays[i].release) {
+        arrowArrays[i].release(&arrowArrays[i]);
+      }
+      if (arrowSchemas[i].release) {
+        arrowSchemas[i].release(&arrowSchemas[i]);
+      }
+    }
+    if (!error.empty()) {
+      VELOX_USER_FAIL("Python function {} failed: {}", name_, error);
+    }
+
+    auto imported =
+        importFromArrowAsOwner(resultSchema, resultArray, context.pool());
+    VELOX_USER_CHECK(
+        imported->type()->equivalent(*outputType),
+        "Python function {} returned {}, expected {}",
+        name_,
+        imported->type()->toString(),
+        outputType->toString());
+    VELOX_USER_CHECK_GE(
+        imported->size(),
+        rows.end(),
+        "Python function {} returned fewer rows than it was given",
+        name_);
+    context.moveOrCopyResult(imported, rows, result);
+  }
+
+ private:
+  const std::string name_;
+  py::function callable_;
+};
+
+// Returns the name of 'type' in function signatures, e.g. array(bigint).
+std::string toSignatureType(const TypePtr& type) {
+  std::vector<std::string> children;
+  for (auto i = 0; i < type->size(); ++i) {
+    children.push_back(toSignatureType(type->childAt(i)));
+  }
+  switch (type->kind()) {
+    case TypeKind::ARRAY:
+      return fmt::format("array({})", children[0]);
+    case TypeKind::MAP:
+      return fmt::format("map({}, {})", children[0], children[1]);
+    case TypeKind::ROW:
+      return fmt::format("row({})", folly::join(", ", children));
+    default:
+      return exec::sanitizeName(type->toString());
+  }
+}
+
+} // namespace
+
+void addUdfBindings(py::module& m, bool asModuleLocalDefinitions) {
+  m.def(
+      "register_udf",
+      [](const std::string& name,
+         py::function callable,
+         const std::vector<TypePtr>& argTypes,
+         const TypePtr& returnType,
+         bool deterministic) {
+        exec::FunctionSignatureBuilder builder;
+        builder.returnType(toSignatureType(returnType));
+        for (const auto& argType : argTypes) {
+          builder.argumentType(toSignatureType(argType));
+        }
+        exec::registerVectorFunction(
+            name,
+            {builder.build()},
+            std::make_unique<PythonVectorFunction>(name, std::move(callable)),
+            exec::VectorFunctionMetadataBuilder()
+                .deterministic(deterministic)
+                .build());
+      },
+      "Registers a Python callable as a function usable in expressions. The "
+      "callable is invoked once per batch with one pyarrow array per argument "
+      "and must return a pyarrow array, or a sequence convertible to one, of "
+      "the same length. Rows with a null argument produce null.",
+      py::arg("name"),
+      py::arg("callable"),
+      py::arg("arg_types"),
+      py::arg("return_type"),
+      py::arg("deterministic") = true);
+}
+
+} // namespace facebook::velox::py
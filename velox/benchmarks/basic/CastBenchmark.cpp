@@ -38,6 +38,11 @@ int main(int argc, char** argv) {
       vectorSize, [](auto /*row*/) { return "$"; });
   auto validDoubleStringInput = vectorMaker.flatVector<std::string>(
       vectorSize, [](auto row) { return fmt::format("{}.12345678910", row); });
+  auto validBigintStringInput = vectorMaker.flatVector<std::string>(
+      vectorSize,
+      [](auto row) { return std::to_string(row * 1'234'567'890'123LL); });
+  auto bigintInput = vectorMaker.flatVector<int64_t>(
+      vectorSize, [](auto row) { return row * 1'234'567'890'123LL; });
   auto validNaNInput = vectorMaker.flatVector<std::string>(
       vectorSize, [](auto /*row*/) { return "NaN"; });
   auto validInfinityInput = vectorMaker.flatVector<std::string>(
@@ -117,6 +122,16 @@ int main(int argc, char** argv) {
           vectorMaker.rowVector({"timestamp"}, {timestampInput}))
       .addExpression("cast", "cast (timestamp as varchar)");
 
+  benchmarkBuilder
+      .addBenchmarkSet(
+          "cast_varchar_and_bigint",
+          vectorMaker.rowVector(
+              {"valid_string", "valid_bigint"},
+              {validBigintStringInput, bigintInput}))
+      .addExpression("cast_varchar_as_bigint", "cast (valid_string as bigint)")
+      .addExpression(
+          "cast_bigint_as_varchar", "cast (valid_bigint as varchar)");
+
   benchmarkBuilder
       .addBenchmarkSet(
           "cast_varchar_as_double",
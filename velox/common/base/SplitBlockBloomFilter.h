@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <xsimd/xsimd.hpp>
+
+#include "velox/common/base/BitUtil.h"
+#include "velox/common/base/Exceptions.h"
+#include "velox/common/base/IOUtils.h"
+
+namespace facebook::velox {
+// Split block bloom filter, as used by Parquet and Impala. The filter is an
+// array of 32 byte blocks. A value sets one bit in each of the 8 32-bit words
+// of a single block, so that inserting or probing a value touches one cache
+// line, and the 8 bits are set or tested with SIMD instructions. The upper
+// 32 bits of the hash number select the block and the lower 32 bits select the
+// bits in the block. Like BloomFilter, the input is a 64 bit hash number and
+// the filter is sized for 16 bits per expected entry, which gives ~0.5% false
+// positives.
+//
+// The serialization has the same layout as BloomFilter with a different
+// version, so that readers can tell the two apart.
+template <typename Allocator = std::allocator<uint64_t>>
+class SplitBlockBloomFilter {
+ public:
+  static constexpr int8_t kVersion = 2;
+
+  explicit SplitBlockBloomFilter() : bits_{Allocator()} {}
+  explicit SplitBlockBloomFilter(const Allocator& allocator)
+      : bits_{allocator} {}
+
+  // Returns true if 'serialized' was produced by serialize() of a
+  // SplitBlockBloomFilter.
+  static bool isSplitBlock(const char* serialized) {
+    return serialized[0] == kVersion;
+  }
+
+  // Prepares 'this' for use with an expected 'capacity' entries. Drops any
+  // prior content.
+  void reset(int32_t capacity) {
+    bits_.clear();
+    // 2 bytes per value.
+    const int32_t numBlocks = std::max<int32_t>(
+        1, bits::nextPowerOfTwo(capacity) * 2 / kBytesPerBlock);
+    bits_.resize(numBlocks * kWordsPerBlock / 2);
+  }
+
+  bool isSet() const {
+    return bits_.size() > 0;
+  }
+
+  // Adds 'value'. Input is a hashed uint64_t value, e.g.
+  // folly::hasher<InputType>()(value).
+  void insert(uint64_t value) {
+    auto* block = blockAt(value);
+    const auto key = xsimd::broadcast(static_cast<uint32_t>(value));
+    for (auto i = 0; i < kWordsPerBlock; i += Batch::size) {
+      auto words = Batch::load_unaligned(block + i);
+      (words | mask(key, i)).store_unaligned(block + i);
+    }
+  }
+
+  // Input is a hashed uint64_t value, e.g. folly::hasher<InputType>()(value).
+  bool mayContain(uint64_t value) const {
+    const auto* block = blockAt(value);
+    const auto key = xsimd::broadcast(static_cast<uint32_t>(value));
+    for (auto i = 0; i < kWordsPerBlock; i += Batch::size) {
+      const auto bits = mask(key, i);
+      if (!xsimd::all((Batch::load_unaligned(block + i) & bits) == bits)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Prefetches the block of 'value'. Probing many values is faster if the
+  // blocks are prefetched a few values ahead.
+  void prefetch(uint64_t value) const {
+    __builtin_prefetch(blockAt(value));
+  }
+
+  void merge(const char* serialized) {
+    common::InputByteStream stream(serialized);
+    auto version = stream.read<int8_t>();
+    VELOX_USER_CHECK_EQ(kVersion, version);
+    auto size = stream.read<int32_t>();
+    auto bitsdata =
+        reinterpret_cast<const uint64_t*>(serialized + stream.offset());
+    if (bits_.size() == 0) {
+      bits_.resize(size);
+      for (auto i = 0; i < size; i++) {
+        bits_[i] = bitsdata[i];
+      }
+      return;
+    } else if (size == 0) {
+      return;
+    }
+    VELOX_USER_CHECK_EQ(bits_.size(), size);
+    bits::orBits(bits_.data(), bitsdata, 0, 64 * size);
+  }
+
+  uint32_t serializedSize() const {
+    return 1 /* version */
+        + 4 /* number of 64 bit words */
+        + bits_.size() * 8;
+  }
+
+  void serialize(char* output) const {
+    common::OutputByteStream stream(output);
+    stream.appendOne(kVersion);
+    stream.appendOne((int32_t)bits_.size());
+    for (auto bit : bits_) {
+      stream.appendOne(bit);
+    }
+  }
+
+ private:
+  using Batch = xsimd::batch<uint32_t>;
+
+  static constexpr int32_t kWordsPerBlock = 8;
+  static constexpr int32_t kBytesPerBlock = kWordsPerBlock * sizeof(uint32_t);
+  static_assert(kWordsPerBlock % Batch::size == 0);
+
+  // Odd constants multiplied with the lower 32 bits of the hash number. The
+  // top 5 bits of each product select the bit in one word.
+  alignas(64) static constexpr uint32_t kSalts[kWordsPerBlock] = {
+      0x47b6137bU,
+      0x44974d91U,
+      0x8824ad5bU,
+      0xa2b7289dU,
+      0x705495c7U,
+      0x2df1424bU,
+      0x9efc4947U,
+      0x5c6bfb31U};
+
+  // Returns the bits to set in words [i, i + Batch::size) of a block.
+  static Batch mask(Batch key, int32_t i) {
+    const auto shifts = (key * Batch::load_aligned(kSalts + i)) >> 27;
+    return xsimd::broadcast<uint32_t>(1) << shifts;
+  }
+
+  int32_t numBlocks() const {
+    return bits_.size() * 2 / kWordsPerBlock;
+  }
+
+  // The upper 32 bits of 'value' select the block. The number of blocks is a
+  // power of 2.
+  uint32_t* blockAt(uint64_t value) {
+    return reinterpret_cast<uint32_t*>(bits_.data()) +
+        ((value >> 32) & (numBlocks() - 1)) * kWordsPerBlock;
+  }
+
+  const uint32_t* blockAt(uint64_t value) const {
+    return reinterpret_cast<const uint32_t*>(bits_.data()) +
+        ((value >> 32) & (numBlocks() - 1)) * kWordsPerBlock;
+  }
+
+  std::vector<uint64_t, Allocator> bits_;
+};
+
+} // namespace facebook::velox
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/base/SplitBlockBloomFilter.h"
+
+#include <folly/Hash.h>
+#include <gtest/gtest.h>
+
+#include "velox/common/base/BloomFilter.h"
+#include "velox/common/base/tests/GTestUtils.h"
+
+using namespace facebook::velox;
+
+class SplitBlockBloomFilterTest : public ::testing::Test {
+ protected:
+  static uint64_t hash(int64_t value) {
+    return folly::hasher<int64_t>()(value);
+  }
+
+  static std::string serialize(const SplitBlockBloomFilter<>& bloom) {
+    std::string data;
+    data.resize(bloom.serializedSize());
+    bloom.serialize(data.data());
+    return data;
+  }
+};
+
+TEST_F(SplitBlockBloomFilterTest, basic) {
+  constexpr int32_t kSize = 10'000;
+  SplitBlockBloomFilter bloom;
+  EXPECT_FALSE(bloom.isSet());
+  bloom.reset(kSize);
+  EXPECT_TRUE(bloom.isSet());
+  for (auto i = 0; i < kSize; ++i) {
+    bloom.insert(hash(i));
+  }
+
+  int32_t numFalsePositives = 0;
+  for (auto i = 0; i < kSize; ++i) {
+    bloom.prefetch(hash(i));
+    EXPECT_TRUE(bloom.mayContain(hash(i)));
+    numFalsePositives += bloom.mayContain(hash(i + kSize));
+    numFalsePositives += bloom.mayContain(hash((i + kSize) * 123451));
+  }
+  EXPECT_GT(1, 100 * numFalsePositives / (2 * kSize));
+}
+
+TEST_F(SplitBlockBloomFilterTest, smallCapacity) {
+  for (auto capacity : {0, 1, 5, 31, 32, 33}) {
+    SplitBlockBloomFilter bloom;
+    bloom.reset(capacity);
+    for (auto i = 0; i < capacity; ++i) {
+      bloom.insert(hash(i));
+    }
+    for (auto i = 0; i < capacity; ++i) {
+      EXPECT_TRUE(bloom.mayContain(hash(i)));
+    }
+  }
+}
+
+TEST_F(SplitBlockBloomFilterTest, serialize) {
+  constexpr int32_t kSize = 1024;
+  SplitBlockBloomFilter bloom;
+  bloom.reset(kSize);
+  for (auto i = 0; i < kSize; ++i) {
+    bloom.insert(hash(i));
+  }
+  auto data = serialize(bloom);
+  EXPECT_TRUE(SplitBlockBloomFilter<>::isSplitBlock(data.data()));
+
+  SplitBlockBloomFilter deserialized;
+  deserialized.merge(data.data());
+  EXPECT_EQ(bloom.serializedSize(), deserialized.serializedSize());
+  EXPECT_EQ(data, serialize(deserialized));
+  for (auto i = 0; i < kSize; ++i) {
+    EXPECT_TRUE(deserialized.mayContain(hash(i)));
+  }
+
+  // The formats of BloomFilter and SplitBlockBloomFilter are not compatible.
+  BloomFilter classic;
+  VELOX_ASSERT_THROW(classic.merge(data.data()), "");
+
+  classic.reset(kSize);
+  std::string classicData;
+  classicData.resize(classic.serializedSize());
+  classic.serialize(classicData.data());
+  EXPECT_FALSE(SplitBlockBloomFilter<>::isSplitBlock(classicData.data()));
+  VELOX_ASSERT_THROW(deserialized.merge(classicData.data()), "");
+}
+
+TEST_F(SplitBlockBloomFilterTest, merge) {
+  constexpr int32_t kSize = 10;
+  SplitBlockBloomFilter bloom;
+  bloom.reset(kSize);
+  for (auto i = 0; i < kSize; ++i) {
+    bloom.insert(hash(i));
+  }
+
+  SplitBlockBloomFilter merge;
+  merge.reset(kSize);
+  for (auto i = kSize; i < kSize + kSize; i++) {
+    merge.insert(hash(i));
+  }
+
+  bloom.merge(serialize(merge).data());
+  for (auto i = 0; i < kSize + kSize; ++i) {
+    EXPECT_TRUE(bloom.mayContain(hash(i)));
+  }
+  EXPECT_EQ(bloom.serializedSize(), merge.serializedSize());
+
+  SplitBlockBloomFilter larger;
+  larger.reset(kSize * 100);
+  VELOX_ASSERT_THROW(bloom.merge(serialize(larger).data()), "");
+}
@@ -18,8 +18,153 @@
 #include "velox/common/base/Exceptions.h"
 
 #include <folly/Conv.h>
+#include <zdict.h>
+#include <zstd.h>
 
 namespace facebook::velox::common {
+namespace {
+
+// Zstd codec which compresses each input as one frame using a dictionary.
+// Compression and decompression contexts are created on first use and reused
+// for the lifetime of the codec.
+class ZstdDictionaryCodec : public folly::io::Codec {
+ public:
+  explicit ZstdDictionaryCodec(std::shared_ptr<const ZstdDictionary> dictionary)
+      : Codec(folly::io::CodecType::ZSTD), dictionary_(std::move(dictionary)) {}
+
+  ~ZstdDictionaryCodec() override {
+    ZSTD_freeCCtx(compressContext_);
+    ZSTD_freeDCtx(decompressContext_);
+  }
+
+ private:
+  uint64_t doMaxCompressedLength(uint64_t uncompressedLength) const override {
+    return ZSTD_compressBound(uncompressedLength);
+  }
+
+  std::unique_ptr<folly::IOBuf> doCompress(const folly::IOBuf* data) override {
+    folly::IOBuf coalesced;
+    if (data->isChained()) {
+      coalesced = data->cloneCoalescedAsValue();
+      data = &coalesced;
+    }
+    if (compressContext_ == nullptr) {
+      compressContext_ = ZSTD_createCCtx();
+      VELOX_CHECK_NOT_NULL(compressContext_);
+    }
+    auto result = folly::IOBuf::create(ZSTD_compressBound(data->length()));
+    const auto size = ZSTD_compress_usingCDict(
+        compressContext_,
+        result->writableData(),
+        result->capacity(),
+        data->data(),
+        data->length(),
+        dictionary_->compressionDictionary());
+    VELOX_CHECK(
+        !ZSTD_isError(size),
+        "ZSTD dictionary compression failed: {}",
+        ZSTD_getErrorName(size));
+    result->append(size);
+    return result;
+  }
+
+  std::unique_ptr<folly::IOBuf> doUncompress(
+      const folly::IOBuf* data,
+      folly::Optional<uint64_t> uncompressedLength) override {
+    folly::IOBuf coalesced;
+    if (data->isChained()) {
+      coalesced = data->cloneCoalescedAsValue();
+      data = &coalesced;
+    }
+    uint64_t size;
+    if (uncompressedLength.has_value()) {
+      size = uncompressedLength.value();
+    } else {
+      size = ZSTD_getFrameContentSize(data->data(), data->length());
+      VELOX_CHECK(
+          size != ZSTD_CONTENTSIZE_UNKNOWN && size != ZSTD_CONTENTSIZE_ERROR,
+          "Unknown uncompressed size of ZSTD frame");
+    }
+    if (decompressContext_ == nullptr) {
+      decompressContext_ = ZSTD_createDCtx();
+      VELOX_CHECK_NOT_NULL(decompressContext_);
+    }
+    auto result = folly::IOBuf::create(size);
+    const auto actualSize = ZSTD_decompress_usingDDict(
+        decompressContext_,
+        result->writableData(),
+        size,
+        data->data(),
+        data->length(),
+        dictionary_->decompressionDictionary());
+    VELOX_CHECK(
+        !ZSTD_isError(actualSize),
+        "ZSTD dictionary decompression failed: {}",
+        ZSTD_getErrorName(actualSize));
+    VELOX_CHECK_EQ(actualSize, size, "Unexpected uncompressed size");
+    result->append(actualSize);
+    return result;
+  }
+
+  const std::shared_ptr<const ZstdDictionary> dictionary_;
+  ZSTD_CCtx* compressContext_{nullptr};
+  ZSTD_DCtx* decompressContext_{nullptr};
+};
+} // namespace
+
+// static
+std::shared_ptr<const ZstdDictionary> ZstdDictionary::train(
+    const std::vector<std::string_view>& samples,
+    size_t maxSize,
+    int32_t compressionLevel) {
+  std::string buffer;
+  std::vector<size_t> sampleSizes;
+  sampleSizes.reserve(samples.size());
+  for (const auto& sample : samples) {
+    buffer.append(sample);
+    sampleSizes.push_back(sample.size());
+  }
+  std::string data(maxSize, '\0');
+  const auto size = ZDICT_trainFromBuffer(
+      data.data(),
+      data.size(),
+      buffer.data(),
+      sampleSizes.data(),
+      sampleSizes.size());
+  if (ZDICT_isError(size)) {
+    return nullptr;
+  }
+  data.resize(size);
+  return std::make_shared<const ZstdDictionary>(
+      std::move(data), compressionLevel);
+}
+
+ZstdDictionary::ZstdDictionary(std::string data, int32_t compressionLevel)
+    : data_(std::move(data)),
+      compressionDictionary_(
+          ZSTD_createCDict(data_.data(), data_.size(), compressionLevel)),
+      decompressionDictionary_(ZSTD_createDDict(data_.data(), data_.size())) {
+  VELOX_CHECK_NOT_NULL(compressionDictionary_);
+  VELOX_CHECK_NOT_NULL(decompressionDictionary_);
+}
+
+ZstdDictionary::~ZstdDictionary() {
+  ZSTD_freeCDict(compressionDictionary_);
+  ZSTD_freeDDict(decompressionDictionary_);
+}
+
+std::unique_ptr<folly::io::Codec> compressionKindToCodec(
+    CompressionKind kind,
+    const std::shared_ptr<const ZstdDictionary>& zstdDictionary) {
+  if (zstdDictionary == nullptr) {
+    return compressionKindToCodec(kind);
+  }
+  VELOX_CHECK_EQ(
+      kind,
+      CompressionKind_ZSTD,
+      "Compression dictionaries are only supported by zstd");
+  return std::make_unique<ZstdDictionaryCodec>(zstdDictionary);
+}
 
 std::unique_ptr<folly::io::Codec> compressionKindToCodec(CompressionKind kind) {
   switch (static_cast<int32_t>(kind)) {
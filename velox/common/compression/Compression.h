@@ -19,6 +19,11 @@
 #include <fmt/format.h>
 #include <folly/compression/Compression.h>
 #include <string>
+#include <string_view>
+#include <vector>
+
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
 
 namespace facebook::velox::common {
 
@@ -35,6 +40,53 @@ enum CompressionKind {
 
 std::unique_ptr<folly::io::Codec> compressionKindToCodec(CompressionKind kind);
 
+/// A zstd dictionary trained on samples of the data to compress. Small inputs
+/// compress much better with a dictionary since the codec does not need to
+/// learn their common content from scratch. Data compressed with a dictionary
+/// can only be uncompressed with the same dictionary. Immutable and safe to
+/// share between threads.
+class ZstdDictionary {
+ public:
+  /// Trains a dictionary of at most 'maxSize' bytes on 'samples'. Returns
+  /// nullptr if the samples are too few or too small to train on.
+  static std::shared_ptr<const ZstdDictionary> train(
+      const std::vector<std::string_view>& samples,
+      size_t maxSize,
+      int32_t compressionLevel = kDefaultCompressionLevel);
+
+  ZstdDictionary(std::string data, int32_t compressionLevel);
+
+  ~ZstdDictionary();
+
+  /// The raw dictionary bytes.
+  const std::string& data() const {
+    return data_;
+  }
+
+  ZSTD_CDict_s* compressionDictionary() const {
+    return compressionDictionary_;
+  }
+
+  ZSTD_DDict_s* decompressionDictionary() const {
+    return decompressionDictionary_;
+  }
+
+ private:
+  static constexpr int32_t kDefaultCompressionLevel = 3;
+
+  const std::string data_;
+  // Digested forms of 'data_' which are expensive to create and are therefore
+  // made once.
+  ZSTD_CDict_s* const compressionDictionary_;
+  ZSTD_DDict_s* const decompressionDictionary_;
+};
+
+/// Same as above. If 'zstdDictionary' is set, 'kind' must be zstd and the
+/// returned codec compresses and uncompresses with the dictionary.
+std::unique_ptr<folly::io::Codec> compressionKindToCodec(
+    CompressionKind kind,
+    const std::shared_ptr<const ZstdDictionary>& zstdDictionary);
+
 CompressionKind codecTypeToCompressionKind(folly::io::CodecType type);
 
 /**
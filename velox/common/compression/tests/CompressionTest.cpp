@@ -48,6 +48,53 @@ TEST_F(CompressionTest, compressionKindToCodec) {
       facebook::velox::VeloxException);
 }
 
+TEST_F(CompressionTest, zstdDictionary) {
+  std::vector<std::string> pages;
+  for (int i = 0; i < 200; ++i) {
+    std::string page;
+    for (int j = 0; j < 20; ++j) {
+      page += fmt::format(
+          "{{\"orderkey\": {}, \"status\": \"{}\", "
+          "\"priority\": \"{}-URGENT\"}}",
+          i * 20 + j,
+          j % 3 == 0 ? "FINISHED" : "PENDING",
+          j % 5);
+    }
+    pages.push_back(std::move(page));
+  }
+  const auto dictionary = ZstdDictionary::train(
+      std::vector<std::string_view>(pages.begin(), pages.end()), 4 << 10);
+  ASSERT_NE(dictionary, nullptr);
+  ASSERT_LE(dictionary->data().size(), 4 << 10);
+
+  auto codec = compressionKindToCodec(CompressionKind_ZSTD, dictionary);
+  ASSERT_EQ(codec->type(), folly::io::CodecType::ZSTD);
+  auto plainCodec = compressionKindToCodec(CompressionKind_ZSTD, nullptr);
+  uint64_t compressedSize{0};
+  uint64_t plainCompressedSize{0};
+  for (const auto& page : pages) {
+    auto input = folly::IOBuf::copyBuffer(page);
+    auto compressed = codec->compress(input.get());
+    compressedSize += compressed->computeChainDataLength();
+    plainCompressedSize +=
+        plainCodec->compress(input.get())->computeChainDataLength();
+
+    auto uncompressed = codec->uncompress(compressed.get(), page.size());
+    ASSERT_EQ(uncompressed->moveToFbString().toStdString(), page);
+    // The uncompressed size is also recorded in the frame.
+    uncompressed = codec->uncompress(compressed.get());
+    ASSERT_EQ(uncompressed->moveToFbString().toStdString(), page);
+  }
+  ASSERT_LT(compressedSize, plainCompressedSize);
+
+  // Too little data to train on.
+  ASSERT_EQ(ZstdDictionary::train({"abc", "abd"}, 4 << 10), nullptr);
+
+  VELOX_ASSERT_THROW(
+      compressionKindToCodec(CompressionKind_LZ4, dictionary),
+      "Compression dictionaries are only supported by zstd");
+}
+
 TEST_F(CompressionTest, stringToCompressionKind) {
   EXPECT_EQ(stringToCompressionKind("none"), CompressionKind_NONE);
   EXPECT_EQ(stringToCompressionKind("zlib"), CompressionKind_ZLIB);
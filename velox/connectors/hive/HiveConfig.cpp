@@ -303,4 +303,10 @@ bool HiveConfig::cacheNoRetention(const Config* session) const {
       config_->get<bool>(kCacheNoRetention, /*defaultValue=*/false));
 }
 
+bool HiveConfig::preserveFlatMapsInMemory(const Config* session) const {
+  return session->get<bool>(
+      kPreserveFlatMapsInMemorySession,
+      config_->get<bool>(kPreserveFlatMapsInMemory, false));
+}
+
 } // namespace facebook::velox::connector::hive
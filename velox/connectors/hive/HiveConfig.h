@@ -240,6 +240,13 @@ class HiveConfig {
   static constexpr const char* kCacheNoRetention = "cache.no_retention";
   static constexpr const char* kCacheNoRetentionSession = "cache.no_retention";
 
+  /// Reads DWRF flat map columns into FlatMapVectors, which keep the values of
+  /// each key in a separate vector, instead of MapVectors.
+  static constexpr const char* kPreserveFlatMapsInMemory =
+      "hive.preserve-flat-maps-in-memory";
+  static constexpr const char* kPreserveFlatMapsInMemorySession =
+      "hive.preserve_flat_maps_in_memory";
+
   InsertExistingPartitionsBehavior insertExistingPartitionsBehavior(
       const Config* session) const;
 
@@ -344,6 +351,9 @@ class HiveConfig {
   /// locality.
   bool cacheNoRetention(const Config* session) const;
 
+  /// Returns true if DWRF flat map columns are read into FlatMapVectors.
+  bool preserveFlatMapsInMemory(const Config* session) const;
+
   HiveConfig(std::shared_ptr<const Config> config) {
     VELOX_CHECK_NOT_NULL(
         config, "Config is null for HiveConfig initialization");
@@ -273,6 +273,9 @@ void SplitReader::createReader(
       std::move(metadataFilter),
       ROW(std::move(columnNames), std::move(columnTypes)),
       hiveSplit_);
+  baseRowReaderOpts_.setPreserveFlatMapsInMemory(
+      hiveConfig_->preserveFlatMapsInMemory(
+          connectorQueryCtx_->sessionProperties()));
 }
 
 bool SplitReader::checkIfSplitIsEmpty(
@@ -110,6 +110,7 @@ AggregationNode::AggregationNode(
     const std::vector<Aggregate>& aggregates,
     const std::vector<vector_size_t>& globalGroupingSets,
     const std::optional<FieldAccessTypedExprPtr>& groupId,
+    bool incrementalGroupingSets,
     bool ignoreNullKeys,
     PlanNodePtr source)
     : PlanNode(id),
@@ -121,6 +122,7 @@ AggregationNode::AggregationNode(
       ignoreNullKeys_(ignoreNullKeys),
       groupId_(groupId),
       globalGroupingSets_(globalGroupingSets),
+      incrementalGroupingSets_(incrementalGroupingSets),
       sources_{source},
       outputType_(getAggregationOutputType(
           groupingKeys_,
@@ -165,8 +167,71 @@ AggregationNode::AggregationNode(
     VELOX_USER_CHECK(
         groupId_.has_value(), "Global grouping sets require GroupId key");
   }
+
+  if (incrementalGroupingSets_) {
+    const auto* groupIdNode =
+        dynamic_cast<const GroupIdNode*>(sources_[0].get());
+    VELOX_USER_CHECK_NOT_NULL(
+        groupIdNode,
+        "Incremental grouping sets require a GroupIdNode source");
+    VELOX_USER_CHECK(
+        step_ == Step::kPartial || step_ == Step::kSingle,
+        "Incremental grouping sets require raw input: {}",
+        stepName(step_));
+    VELOX_USER_CHECK(
+        preGroupedKeys_.empty(),
+        "Incremental grouping sets do not support pre-grouped keys");
+    VELOX_USER_CHECK(
+        !aggregates_.empty(),
+        "Incremental grouping sets require at least one aggregate");
+    VELOX_USER_CHECK_GT(
+        groupingKeyNames.count(groupIdNode->groupIdName()),
+        0,
+        "GroupId column {} must be one of the grouping keys",
+        groupIdNode->groupIdName());
+    VELOX_USER_CHECK_EQ(
+        groupingKeys_.size(),
+        groupIdNode->numGroupingKeys() + 1,
+        "Incremental grouping sets require all GroupId grouping keys to be aggregation grouping keys");
+    VELOX_USER_CHECK(
+        std::any_of(
+            groupIdNode->groupingSets().begin(),
+            groupIdNode->groupingSets().end(),
+            [](const auto& groupingSet) { return !groupingSet.empty(); }),
+        "Incremental grouping sets require at least one non-global grouping set");
+    for (const auto& aggregate : aggregates_) {
+      VELOX_USER_CHECK(
+          !aggregate.distinct && aggregate.sortingKeys.empty(),
+          "Incremental grouping sets do not support distinct or sorted aggregates: {}",
+          aggregate.call->toString());
+    }
+  }
 }
 
+AggregationNode::AggregationNode(
+    const PlanNodeId& id,
+    Step step,
+    const std::vector<FieldAccessTypedExprPtr>& groupingKeys,
+    const std::vector<FieldAccessTypedExprPtr>& preGroupedKeys,
+    const std::vector<std::string>& aggregateNames,
+    const std::vector<Aggregate>& aggregates,
+    const std::vector<vector_size_t>& globalGroupingSets,
+    const std::optional<FieldAccessTypedExprPtr>& groupId,
+    bool ignoreNullKeys,
+    PlanNodePtr source)
+    : AggregationNode(
+          id,
+          step,
+          groupingKeys,
+          preGroupedKeys,
+          aggregateNames,
+          aggregates,
+          globalGroupingSets,
+          groupId,
+          false,
+          ignoreNullKeys,
+          source) {}
+
 AggregationNode::AggregationNode(
     const PlanNodeId& id,
     Step step,
@@ -185,6 +250,7 @@ AggregationNode::AggregationNode(
           aggregates,
           {},
           std::nullopt,
+          false,
           ignoreNullKeys,
           source) {}
 
@@ -276,6 +342,10 @@ void AggregationNode::addDetails(std::stringstream& stream) const {
   if (groupId_.has_value()) {
     stream << " Group Id key: " << groupId_.value()->name();
   }
+
+  if (incrementalGroupingSets_) {
+    stream << " incremental grouping sets";
+  }
 }
 
 namespace {
@@ -329,6 +399,7 @@ folly::dynamic AggregationNode::serialize() const {
   if (groupId_.has_value()) {
     obj["groupId"] = ISerializable::serialize(groupId_.value());
   }
+  obj["incrementalGroupingSets"] = incrementalGroupingSets_;
   obj["ignoreNullKeys"] = ignoreNullKeys_;
   return obj;
 }
@@ -429,6 +500,10 @@ PlanNodePtr AggregationNode::create(const folly::dynamic& obj, void* context) {
         obj["groupId"], context);
   }
 
+  const bool incrementalGroupingSets = obj.count("incrementalGroupingSets")
+      ? obj["incrementalGroupingSets"].asBool()
+      : false;
+
   return std::make_shared<AggregationNode>(
       deserializePlanNodeId(obj),
       stepFromName(obj["step"].asString()),
@@ -438,6 +513,7 @@ PlanNodePtr AggregationNode::create(const folly::dynamic& obj, void* context) {
       aggregates,
       globalGroupingSets,
       groupId,
+      incrementalGroupingSets,
       obj["ignoreNullKeys"].asBool(),
       deserializeSingleSource(obj, context));
 }
@@ -1210,6 +1286,242 @@ PlanNodePtr NestedLoopJoinNode::create(
       outputType);
 }
 
+namespace {
+std::unordered_map<RangeJoinNode::Comparison, std::string> comparisonNames() {
+  return {
+      {RangeJoinNode::Comparison::kLessThan, "<"},
+      {RangeJoinNode::Comparison::kLessThanOrEqual, "<="},
+      {RangeJoinNode::Comparison::kGreaterThan, ">"},
+      {RangeJoinNode::Comparison::kGreaterThanOrEqual, ">="},
+  };
+}
+} // namespace
+
+// static
+const char* RangeJoinNode::comparisonName(Comparison comparison) {
+  static const auto kComparisons = comparisonNames();
+  return kComparisons.at(comparison).c_str();
+}
+
+// static
+RangeJoinNode::Comparison RangeJoinNode::comparisonFromName(
+    const std::string& name) {
+  static const auto kComparisons = invertMap(comparisonNames());
+  return kComparisons.at(name);
+}
+
+folly::dynamic RangeJoinNode::Condition::serialize() const {
+  folly::dynamic obj = folly::dynamic::object();
+  obj["left"] = left->serialize();
+  obj["comparison"] = comparisonName(comparison);
+  obj["right"] = right->serialize();
+  return obj;
+}
+
+// static
+RangeJoinNode::Condition RangeJoinNode::Condition::deserialize(
+    const folly::dynamic& obj,
+    void* context) {
+  return {
+      ISerializable::deserialize<FieldAccessTypedExpr>(obj["left"], context),
+      comparisonFromName(obj["comparison"].asString()),
+      ISerializable::deserialize<FieldAccessTypedExpr>(obj["right"], context)};
+}
+
+RangeJoinNode::RangeJoinNode(
+    const PlanNodeId& id,
+    JoinType joinType,
+    std::vector<Condition> conditions,
+    TypedExprPtr filter,
+    PlanNodePtr left,
+    PlanNodePtr right,
+    RowTypePtr outputType)
+    : PlanNode(id),
+      joinType_(joinType),
+      conditions_(std::move(conditions)),
+      filter_(std::move(filter)),
+      sources_({std::move(left), std::move(right)}),
+      outputType_(std::move(outputType)) {
+  VELOX_USER_CHECK(
+      core::isInnerJoin(joinType_) || core::isLeftJoin(joinType_),
+      "{} unsupported, RangeJoin only supports inner and left join",
+      joinTypeName(joinType_));
+  VELOX_USER_CHECK(
+      conditions_.size() == 1 || conditions_.size() == 2,
+      "RangeJoin requires one or two range conditions");
+
+  const auto& leftType = sources_[0]->outputType();
+  const auto& rightType = sources_[1]->outputType();
+  for (const auto& condition : conditions_) {
+    VELOX_USER_CHECK(
+        leftType->containsChild(condition.left->name()),
+        "Range condition left key not found in the left side: {}",
+        condition.left->name());
+    VELOX_USER_CHECK(
+        rightType->containsChild(condition.right->name()),
+        "Range condition right key not found in the right side: {}",
+        condition.right->name());
+    VELOX_USER_CHECK(
+        condition.left->type()->equivalent(*condition.right->type()),
+        "Range condition keys must have the same type: {} vs. {}",
+        condition.left->type()->toString(),
+        condition.right->type()->toString());
+    VELOX_USER_CHECK(
+        condition.left->type()->isPrimitiveType() &&
+            condition.left->type()->isOrderable(),
+        "Range condition keys must be of an orderable primitive type: {}",
+        condition.left->type()->toString());
+    VELOX_USER_CHECK(
+        condition.left->type()->equivalent(*conditions_[0].left->type()),
+        "Range conditions must have keys of the same type: {} vs. {}",
+        condition.left->type()->toString(),
+        conditions_[0].left->type()->toString());
+  }
+
+  for (const auto& name : outputType_->names()) {
+    const bool leftContains = leftType->containsChild(name);
+    const bool rightContains = rightType->containsChild(name);
+    VELOX_USER_CHECK(
+        !(leftContains && rightContains),
+        "Duplicate column name found on join's left and right sides: {}",
+        name);
+    VELOX_USER_CHECK(
+        leftContains || rightContains,
+        "Join's output column not found in either left or right sides: {}",
+        name);
+  }
+}
+
+void RangeJoinNode::addDetails(std::stringstream& stream) const {
+  stream << joinTypeName(joinType_) << " ";
+  for (auto i = 0; i < conditions_.size(); ++i) {
+    if (i > 0) {
+      stream << " AND ";
+    }
+    const auto& condition = conditions_[i];
+    stream << condition.left->name() << " "
+           << comparisonName(condition.comparison) << " "
+           << condition.right->name();
+  }
+  if (filter_) {
+    stream << ", filter: " << filter_->toString();
+  }
+}
+
+folly::dynamic RangeJoinNode::serialize() const {
+  auto obj = PlanNode::serialize();
+  obj["joinType"] = joinTypeName(joinType_);
+  obj["conditions"] = folly::dynamic::array();
+  for (const auto& condition : conditions_) {
+    obj["conditions"].push_back(condition.serialize());
+  }
+  if (filter_) {
+    obj["filter"] = filter_->serialize();
+  }
+  obj["outputType"] = outputType_->serialize();
+  return obj;
+}
+
+// static
+PlanNodePtr RangeJoinNode::create(const folly::dynamic& obj, void* context) {
+  auto sources = deserializeSources(obj, context);
+  VELOX_CHECK_EQ(2, sources.size());
+
+  std::vector<Condition> conditions;
+  for (const auto& condition : obj["conditions"]) {
+    conditions.push_back(Condition::deserialize(condition, context));
+  }
+
+  TypedExprPtr filter;
+  if (obj.count("filter")) {
+    filter = ISerializable::deserialize<ITypedExpr>(obj["filter"], context);
+  }
+
+  auto outputType = deserializeRowType(obj["outputType"]);
+
+  return std::make_shared<RangeJoinNode>(
+      deserializePlanNodeId(obj),
+      joinTypeFromName(obj["joinType"].asString()),
+      std::move(conditions),
+      filter,
+      sources[0],
+      sources[1],
+      outputType);
+}
+
+AsofJoinNode::AsofJoinNode(
+    const PlanNodeId& id,
+    JoinType joinType,
+    const std::vector<FieldAccessTypedExprPtr>& leftKeys,
+    const std::vector<FieldAccessTypedExprPtr>& rightKeys,
+    Comparison comparison,
+    PlanNodePtr left,
+    PlanNodePtr right,
+    RowTypePtr outputType)
+    : AbstractJoinNode(
+          id,
+          joinType,
+          leftKeys,
+          rightKeys,
+          nullptr,
+          std::move(left),
+          std::move(right),
+          std::move(outputType)),
+      comparison_(comparison) {
+  VELOX_USER_CHECK(
+      isInnerJoin() || isLeftJoin(),
+      "{} unsupported, AsofJoin only supports inner and left join",
+      joinTypeName(joinType_));
+
+  const auto& asofType = leftKeys_.back()->type();
+  VELOX_USER_CHECK(
+      asofType->equivalent(*rightKeys_.back()->type()),
+      "ASOF keys must have the same type: {} vs. {}",
+      asofType->toString(),
+      rightKeys_.back()->type()->toString());
+  VELOX_USER_CHECK(
+      asofType->isPrimitiveType() && asofType->isOrderable(),
+      "ASOF key must be of an orderable primitive type: {}",
+      asofType->toString());
+}
+
+void AsofJoinNode::addDetails(std::stringstream& stream) const {
+  stream << joinTypeName(joinType_) << " ";
+  for (auto i = 0; i < numEqualityKeys(); ++i) {
+    stream << leftKeys_[i]->name() << "=" << rightKeys_[i]->name() << " AND ";
+  }
+  stream << leftKeys_.back()->name() << " "
+         << RangeJoinNode::comparisonName(comparison_) << " "
+         << rightKeys_.back()->name();
+}
+
+folly::dynamic AsofJoinNode::serialize() const {
+  auto obj = serializeBase();
+  obj["comparison"] = RangeJoinNode::comparisonName(comparison_);
+  return obj;
+}
+
+// static
+PlanNodePtr AsofJoinNode::create(const folly::dynamic& obj, void* context) {
+  auto sources = deserializeSources(obj, context);
+  VELOX_CHECK_EQ(2, sources.size());
+
+  auto leftKeys = deserializeFields(obj["leftKeys"], context);
+  auto rightKeys = deserializeFields(obj["rightKeys"], context);
+
+  auto outputType = deserializeRowType(obj["outputType"]);
+
+  return std::make_shared<AsofJoinNode>(
+      deserializePlanNodeId(obj),
+      joinTypeFromName(obj["joinType"].asString()),
+      std::move(leftKeys),
+      std::move(rightKeys),
+      RangeJoinNode::comparisonFromName(obj["comparison"].asString()),
+      sources[0],
+      sources[1],
+      outputType);
+}
+
 AssignUniqueIdNode::AssignUniqueIdNode(
     const PlanNodeId& id,
     const std::string& idName,
@@ -2234,6 +2546,8 @@ void PlanNode::registerSerDe() {
   registry.Register("MergeExchangeNode", MergeExchangeNode::create);
   registry.Register("MergeJoinNode", MergeJoinNode::create);
   registry.Register("NestedLoopJoinNode", NestedLoopJoinNode::create);
+  registry.Register("RangeJoinNode", RangeJoinNode::create);
+  registry.Register("AsofJoinNode", AsofJoinNode::create);
   registry.Register("LimitNode", LimitNode::create);
   registry.Register("LocalMergeNode", LocalMergeNode::create);
   registry.Register("LocalPartitionNode", LocalPartitionNode::create);
@@ -554,6 +554,27 @@ class AggregationNode : public PlanNode {
       bool ignoreNullKeys,
       PlanNodePtr source);
 
+  /// @param incrementalGroupingSets If true, 'source' must be a GroupIdNode.
+  /// Instead of replicating every input row once per grouping set, the
+  /// aggregation is computed once for the finest grouping set (the union of
+  /// all grouping keys) and the results for the grouping sets are derived by
+  /// re-aggregating the intermediate results of the finest grouping set. The
+  /// GroupIdNode is fused into the aggregation operator unless the
+  /// aggregation can spill. Requires raw input (partial or single step), at
+  /// least one aggregate and no distinct or sorted aggregates.
+  AggregationNode(
+      const PlanNodeId& id,
+      Step step,
+      const std::vector<FieldAccessTypedExprPtr>& groupingKeys,
+      const std::vector<FieldAccessTypedExprPtr>& preGroupedKeys,
+      const std::vector<std::string>& aggregateNames,
+      const std::vector<Aggregate>& aggregates,
+      const std::vector<vector_size_t>& globalGroupingSets,
+      const std::optional<FieldAccessTypedExprPtr>& groupId,
+      bool incrementalGroupingSets,
+      bool ignoreNullKeys,
+      PlanNodePtr source);
+
   const std::vector<PlanNodePtr>& sources() const override {
     return sources_;
   }
@@ -607,6 +628,12 @@ class AggregationNode : public PlanNode {
     return groupId_;
   }
 
+  /// Returns true if grouping sets produced by the source GroupIdNode are
+  /// computed by re-aggregating the results of the finest grouping set.
+  bool incrementalGroupingSets() const {
+    return incrementalGroupingSets_;
+  }
+
   std::string_view name() const override {
     return "Aggregation";
   }
@@ -637,6 +664,7 @@ class AggregationNode : public PlanNode {
 
   std::optional<FieldAccessTypedExprPtr> groupId_;
   std::vector<vector_size_t> globalGroupingSets_;
+  const bool incrementalGroupingSets_;
 
   const std::vector<PlanNodePtr> sources_;
   const RowTypePtr outputType_;
@@ -1722,6 +1750,156 @@ class NestedLoopJoinNode : public PlanNode {
   const RowTypePtr outputType_;
 };
 
+/// Represents inner and left joins with one or two range conditions between
+/// the left and right inputs, e.g. a.ts BETWEEN b.start AND b.end, which is
+/// expressed as two conditions: a.ts >= b.start and a.ts <= b.end. Translates
+/// to an exec::RangeJoinProbe and exec::RangeJoinBuild. A separate pipeline is
+/// produced for the build side when generating exec::Operators.
+///
+/// The build (right) side is sorted once on the right key of the first
+/// condition. Each probe row finds the build rows matching the first condition
+/// with a binary search and the subset of these matching the second condition
+/// using a min/max segment tree over the right key of the second condition.
+/// This takes O((n + m) * log(m) + output) time instead of evaluating the
+/// condition on every pair of rows as NestedLoopJoinNode does.
+///
+/// An optional 'filter' is evaluated on the pairs of rows matching the range
+/// conditions.
+class RangeJoinNode : public PlanNode {
+ public:
+  /// Comparison between the left and the right key of a range condition.
+  enum class Comparison {
+    kLessThan,
+    kLessThanOrEqual,
+    kGreaterThan,
+    kGreaterThanOrEqual,
+  };
+
+  static const char* comparisonName(Comparison comparison);
+
+  static Comparison comparisonFromName(const std::string& name);
+
+  /// Range condition: 'left' 'comparison' 'right', e.g. a.ts >= b.start. The
+  /// left key must be a column of the left input and the right key a column
+  /// of the right input. Both keys must have the same type.
+  struct Condition {
+    FieldAccessTypedExprPtr left;
+    Comparison comparison;
+    FieldAccessTypedExprPtr right;
+
+    folly::dynamic serialize() const;
+
+    static Condition deserialize(const folly::dynamic& obj, void* context);
+  };
+
+  /// @param conditions One or two range conditions. If there are two, the
+  /// keys of both conditions must have the same type.
+  /// @param filter Optional filter evaluated on the pairs of rows matching
+  /// the conditions.
+  RangeJoinNode(
+      const PlanNodeId& id,
+      JoinType joinType,
+      std::vector<Condition> conditions,
+      TypedExprPtr filter,
+      PlanNodePtr left,
+      PlanNodePtr right,
+      RowTypePtr outputType);
+
+  const std::vector<PlanNodePtr>& sources() const override {
+    return sources_;
+  }
+
+  const RowTypePtr& outputType() const override {
+    return outputType_;
+  }
+
+  std::string_view name() const override {
+    return "RangeJoin";
+  }
+
+  JoinType joinType() const {
+    return joinType_;
+  }
+
+  const std::vector<Condition>& conditions() const {
+    return conditions_;
+  }
+
+  const TypedExprPtr& filter() const {
+    return filter_;
+  }
+
+  folly::dynamic serialize() const override;
+
+  static PlanNodePtr create(const folly::dynamic& obj, void* context);
+
+ private:
+  void addDetails(std::stringstream& stream) const override;
+
+  const JoinType joinType_;
+  const std::vector<Condition> conditions_;
+  const TypedExprPtr filter_;
+  const std::vector<PlanNodePtr> sources_;
+  const RowTypePtr outputType_;
+};
+
+/// Represents inner and left ASOF joins. For each row on the left side, finds
+/// the row on the right side with equal values of the equality keys and the
+/// nearest value of the ASOF key that satisfies 'comparison', e.g. the most
+/// recent quote for each trade:
+///
+///   trades ASOF JOIN quotes
+///     ON trades.symbol = quotes.symbol AND trades.ts >= quotes.ts
+///
+/// 'leftKeys' and 'rightKeys' list the equality keys followed by the ASOF key.
+/// kGreaterThanOrEqual and kGreaterThan match the right row with the largest
+/// ASOF key not greater than (less than) the left ASOF key. kLessThanOrEqual
+/// and kLessThan match the right row with the smallest ASOF key not less than
+/// (greater than) the left ASOF key. Each left row matches at most one right
+/// row.
+///
+/// Translates to an exec::AsofJoin operator. Like MergeJoinNode, assumes that
+/// both inputs are sorted in ascending order on the join keys and produces a
+/// separate pipeline that puts the right side into exec::MergeJoinSource.
+class AsofJoinNode : public AbstractJoinNode {
+ public:
+  using Comparison = RangeJoinNode::Comparison;
+
+  AsofJoinNode(
+      const PlanNodeId& id,
+      JoinType joinType,
+      const std::vector<FieldAccessTypedExprPtr>& leftKeys,
+      const std::vector<FieldAccessTypedExprPtr>& rightKeys,
+      Comparison comparison,
+      PlanNodePtr left,
+      PlanNodePtr right,
+      RowTypePtr outputType);
+
+  std::string_view name() const override {
+    return "AsofJoin";
+  }
+
+  /// Comparison between the left and the right ASOF keys.
+  Comparison comparison() const {
+    return comparison_;
+  }
+
+  /// Number of equality keys. The ASOF key follows them in 'leftKeys' and
+  /// 'rightKeys'.
+  size_t numEqualityKeys() const {
+    return leftKeys_.size() - 1;
+  }
+
+  folly::dynamic serialize() const override;
+
+  static PlanNodePtr create(const folly::dynamic& obj, void* context);
+
+ private:
+  void addDetails(std::stringstream& stream) const override;
+
+  const Comparison comparison_;
+};
+
 // Represents the 'SortBy' node in the plan.
 class OrderByNode : public PlanNode {
  public:
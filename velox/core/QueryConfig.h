@@ -101,6 +101,12 @@ class QueryConfig {
   static constexpr const char* kExprTrackCpuUsage =
       "expression.track_cpu_usage";
 
+  /// Whether the expression compiler reuses the results of constant folding
+  /// computed by earlier compilations of the same constant subexpressions with
+  /// the same config. False by default.
+  static constexpr const char* kExprConstantFoldingCacheEnabled =
+      "expression.constant_folding_cache_enabled";
+
   /// Whether to track CPU usage for stages of individual operators. True by
   /// default. Can be expensive when processing small batches, e.g. < 10K rows.
   static constexpr const char* kOperatorTrackCpuUsage =
@@ -301,6 +307,12 @@ class QueryConfig {
   static constexpr const char* kSparkBloomFilterMaxNumBits =
       "spark.bloom_filter.max_num_bits";
 
+  /// If true, bloom_filter_agg builds split block bloom filters, which are
+  /// faster to build and probe. Otherwise it builds the classic bloom filters,
+  /// whose serialized format is expected by readers that only know that one.
+  static constexpr const char* kSparkBloomFilterSplitBlock =
+      "spark.bloom_filter.split_block";
+
   /// The current spark partition id.
   static constexpr const char* kSparkPartitionId = "spark.partition_id";
 
@@ -322,6 +334,28 @@ class QueryConfig {
   static constexpr const char* kMinTableRowsForParallelJoinBuild =
       "min_table_rows_for_parallel_join_build";
 
+  /// If true, a chain of inner hash joins in the same pipeline that all probe
+  /// with keys from the input of the first join is executed by a single
+  /// MultiHashProbe operator. Joins with a filter, null-aware joins and joins
+  /// that can spill are not fused.
+  static constexpr const char* kMultiHashJoinEnabled =
+      "multi_hash_join_enabled";
+
+  /// The maximum fraction of probe rows with a match for which a hash probe
+  /// checks its input against a bloom filter of the build side keys before
+  /// probing the hash table. The fraction is measured on the first probe
+  /// batches. 0 disables the bloom filter.
+  static constexpr const char* kHashProbeBloomFilterMaxHitRate =
+      "hash_probe_bloom_filter_max_hit_rate";
+
+  /// The maximum number of window partition groups a Window operator
+  /// evaluates concurrently on the query executor once it has received all
+  /// its input. Each group is a run of consecutive partitions. The output
+  /// order is unchanged. Only applies to sort based window builds that have
+  /// not spilled. 1 disables parallel evaluation.
+  static constexpr const char* kWindowPartitionParallelism =
+      "window_partition_parallelism";
+
   /// If set to true, then during execution of tasks, the output vectors of
   /// every operator are validated for consistency. This is an expensive check
   /// so should only be used for debugging. It can help debug issues where
@@ -655,6 +689,10 @@ class QueryConfig {
     return value;
   }
 
+  bool sparkBloomFilterSplitBlock() const {
+    return get<bool>(kSparkBloomFilterSplitBlock, false);
+  }
+
   int32_t sparkPartitionId() const {
     auto id = get<int32_t>(kSparkPartitionId);
     VELOX_CHECK(id.has_value(), "Spark partition id is not set.");
@@ -667,6 +705,10 @@ class QueryConfig {
     return get<bool>(kExprTrackCpuUsage, false);
   }
 
+  bool exprConstantFoldingCacheEnabled() const {
+    return get<bool>(kExprConstantFoldingCacheEnabled, false);
+  }
+
   bool operatorTrackCpuUsage() const {
     return get<bool>(kOperatorTrackCpuUsage, true);
   }
@@ -684,10 +726,22 @@ class QueryConfig {
     return get<bool>(kHashProbeFinishEarlyOnEmptyBuild, true);
   }
 
+  bool multiHashJoinEnabled() const {
+    return get<bool>(kMultiHashJoinEnabled, false);
+  }
+
+  double hashProbeBloomFilterMaxHitRate() const {
+    return get<double>(kHashProbeBloomFilterMaxHitRate, 0.25);
+  }
+
   uint32_t minTableRowsForParallelJoinBuild() const {
     return get<uint32_t>(kMinTableRowsForParallelJoinBuild, 1'000);
   }
 
+  uint32_t windowPartitionParallelism() const {
+    return get<uint32_t>(kWindowPartitionParallelism, 1);
+  }
+
   bool validateOutputFromOperators() const {
     return get<bool>(kValidateOutputFromOperators, false);
   }
@@ -737,6 +791,11 @@ class QueryConfig {
     return std::optional<T>(config_->get<T>(key));
   }
 
+  /// Returns all the config properties.
+  const std::unordered_map<std::string, std::string>& rawConfigs() const {
+    return config_->values();
+  }
+
   /// Test-only method to override the current query config properties.
   /// It is not thread safe.
   void testingOverrideConfigUnsafe(
@@ -15,6 +15,9 @@
  */
 
 #include "velox/core/QueryCtx.h"
+
+#include <algorithm>
+
 #include "velox/common/base/SpillConfig.h"
 
 namespace facebook::velox::core {
@@ -108,6 +111,23 @@ uint64_t QueryCtx::MemoryReclaimer::reclaim(
   return memory::MemoryReclaimer::reclaim(pool, targetBytes, maxWaitMs, stats);
 }
 
+const std::string& QueryCtx::queryConfigKey() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  if (!queryConfigKey_.has_value()) {
+    const auto& values = queryConfig_.rawConfigs();
+    std::vector<std::pair<std::string, std::string>> sorted(
+        values.begin(), values.end());
+    std::sort(sorted.begin(), sorted.end());
+
+    std::string key;
+    for (const auto& [name, value] : sorted) {
+      key.append(name).append(1, '=').append(value).append(1, '\n');
+    }
+    queryConfigKey_ = std::move(key);
+  }
+  return queryConfigKey_.value();
+}
+
 bool QueryCtx::checkUnderArbitration(ContinueFuture* future) {
   VELOX_CHECK_NOT_NULL(future);
   std::lock_guard<std::mutex> l(mutex_);
@@ -72,6 +72,12 @@ class QueryCtx : public std::enable_shared_from_this<QueryCtx> {
     return queryConfig_;
   }
 
+  /// Returns a string identifying the properties of queryConfig(). Queries
+  /// with the same properties have the same key. Computed on first use. Used
+  /// to share state that depends on the config across queries, e.g. by
+  /// exec::ConstantFoldingCache.
+  const std::string& queryConfigKey() const;
+
   Config* connectorSessionProperties(const std::string& connectorId) const {
     auto it = connectorSessionProperties_.find(connectorId);
     if (it == connectorSessionProperties_.end()) {
@@ -85,6 +91,7 @@ class QueryCtx : public std::enable_shared_from_this<QueryCtx> {
   void testingOverrideConfigUnsafe(
       std::unordered_map<std::string, std::string>&& values) {
     this->queryConfig_.testingOverrideConfigUnsafe(std::move(values));
+    queryConfigKey_.reset();
   }
 
   // Overrides the previous connector-specific configuration. Note that this
@@ -208,6 +215,8 @@ class QueryCtx : public std::enable_shared_from_this<QueryCtx> {
   std::atomic<uint64_t> numSpilledBytes_{0};
 
   mutable std::mutex mutex_;
+  // Set by the first call to queryConfigKey().
+  mutable std::optional<std::string> queryConfigKey_;
   // Indicates if this query is under memory arbitration or not.
   bool underArbitration_{false};
   std::vector<ContinuePromise> arbitrationPromises_;
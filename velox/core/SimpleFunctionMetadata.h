@@ -42,6 +42,17 @@ struct udf_is_deterministic<
     util::detail::void_t<decltype(T::is_deterministic)>>
     : std::integral_constant<bool, T::is_deterministic> {};
 
+// Constant folding results of a function are reused across queries unless the
+// function opts out, e.g. because it reads the clock.
+template <class T, class = void>
+struct udf_is_foldable_across_queries : std::true_type {};
+
+template <class T>
+struct udf_is_foldable_across_queries<
+    T,
+    util::detail::void_t<decltype(T::is_foldable_across_queries)>>
+    : std::integral_constant<bool, T::is_foldable_across_queries> {};
+
 // Most functions are producing ASCII results for ASCII inputs, but we assume
 // they are not unless specified explicitly.
 template <class T, class = void>
@@ -386,6 +397,7 @@ class ISimpleFunctionMetadata {
   virtual TypePtr tryResolveReturnType() const = 0;
   virtual std::string getName() const = 0;
   virtual bool isDeterministic() const = 0;
+  virtual bool isFoldableAcrossQueries() const = 0;
   virtual bool defaultNullBehavior() const = 0;
   virtual uint32_t priority() const = 0;
   virtual const std::shared_ptr<exec::FunctionSignature> signature() const = 0;
@@ -458,6 +470,10 @@ class SimpleFunctionMetadata : public ISimpleFunctionMetadata {
     return udf_is_deterministic<Fun>();
   }
 
+  bool isFoldableAcrossQueries() const final {
+    return udf_is_foldable_across_queries<Fun>();
+  }
+
   bool defaultNullBehavior() const final {
     return defaultNullBehavior_;
   }
@@ -126,6 +126,7 @@ class RowReaderOptions {
   bool preloadStripe;
   bool projectSelectedType;
   bool returnFlatVector_ = false;
+  bool preserveFlatMapsInMemory_ = false;
   ErrorTolerance errorTolerance_;
   std::shared_ptr<ColumnSelector> selector_;
   RowTypePtr requestedType_;
@@ -256,6 +257,18 @@ class RowReaderOptions {
     returnFlatVector_ = value;
   }
 
+  /// Returns true if flat map columns are read into FlatMapVectors instead of
+  /// MapVectors.
+  bool preserveFlatMapsInMemory() const {
+    return preserveFlatMapsInMemory_;
+  }
+
+  /// Requests that flat map columns be read into FlatMapVectors, which keep
+  /// the values of each key in a separate vector like the file does.
+  void setPreserveFlatMapsInMemory(bool value) {
+    preserveFlatMapsInMemory_ = value;
+  }
+
   /// Request that the selected type be projected.
   void setProjectSelectedType(bool vProjectSelectedType) {
     projectSelectedType = vProjectSelectedType;
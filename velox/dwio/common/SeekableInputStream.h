@@ -63,7 +63,9 @@ class SeekableInputStream : public google::protobuf::io::ZeroCopyInputStream {
     return SkipInt64(count);
   }
 
-  void readFully(char* buffer, size_t bufferSize);
+  /// Reads exactly 'bufferSize' bytes into 'buffer'. Throws if the stream
+  /// ends before.
+  virtual void readFully(char* buffer, size_t bufferSize);
 };
 
 /**
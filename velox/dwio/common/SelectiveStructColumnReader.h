@@ -17,6 +17,7 @@
 #pragma once
 
 #include "velox/dwio/common/SelectiveColumnReaderInternal.h"
+#include "velox/vector/FlatMapVector.h"
 
 namespace facebook::velox::dwio::common {
 
@@ -216,7 +217,15 @@ class SelectiveFlatMapColumnReaderHelper {
 
   void getValues(RowSet rows, VectorPtr* result);
 
+  /// Same as getValues() but returns a FlatMapVector that keeps the values of
+  /// each key in a separate vector instead of copying them into a MapVector.
+  void getFlatMapValues(RowSet rows, VectorPtr* result);
+
  private:
+  // Returns the keys of 'keyNodes_' as a flat vector, in the order of
+  // 'keyNodes_'.
+  const VectorPtr& distinctKeys();
+
   MapVector& prepareResult(VectorPtr& result, vector_size_t size) {
     if (result && result->encoding() == VectorEncoding::Simple::MAP &&
         result.unique()) {
@@ -262,6 +271,7 @@ class SelectiveFlatMapColumnReaderHelper {
   std::vector<uint64_t> columnRowBits_;
   int columnBitsWords_;
   std::vector<BaseVector::CopyRange> copyRanges_;
+  VectorPtr distinctKeys_;
 };
 
 template <typename T, typename KeyNode, typename FormatData>
@@ -549,4 +559,67 @@ void SelectiveFlatMapColumnReaderHelper<T, KeyNode, FormatData>::getValues(
   result->get()->setNulls(reader_.resultNulls());
 }
 
+template <typename T, typename KeyNode, typename FormatData>
+const VectorPtr&
+SelectiveFlatMapColumnReaderHelper<T, KeyNode, FormatData>::distinctKeys() {
+  if (distinctKeys_ == nullptr) {
+    distinctKeys_ = BaseVector::create(
+        reader_.requestedType_->childAt(0),
+        keyNodes_.size(),
+        &reader_.memoryPool_);
+    auto* flatKeys = distinctKeys_->template asFlatVector<T>();
+    for (int k = 0; k < keyNodes_.size(); ++k) {
+      flatKeys->set(k, keyNodes_[k].key.get());
+    }
+  }
+  return distinctKeys_;
+}
+
+template <typename T, typename KeyNode, typename FormatData>
+void SelectiveFlatMapColumnReaderHelper<T, KeyNode, FormatData>::
+    getFlatMapValues(RowSet rows, VectorPtr* result) {
+  auto* nulls = reader_.nullsInReadRange_
+      ? reader_.nullsInReadRange_->as<uint64_t>()
+      : nullptr;
+  const bool dense = rows.back() == rows.size() - 1;
+  std::vector<VectorPtr> mapValues(reader_.children_.size());
+  std::vector<BufferPtr> inMaps(reader_.children_.size());
+  for (int k = 0; k < reader_.children_.size(); ++k) {
+    reader_.children_[k]->getValues(rows, &mapValues[k]);
+    auto* inMap =
+        static_cast<const FormatData&>(reader_.children_[k]->formatData())
+            .inMap();
+    if (!inMap) {
+      // The key is in all non-null maps.
+      continue;
+    }
+    inMaps[k] =
+        AlignedBuffer::allocate<bool>(rows.size(), &reader_.memoryPool_);
+    auto* rawInMap = inMaps[k]->template asMutable<uint64_t>();
+    if (dense) {
+      bits::copyBits(inMap, 0, rawInMap, 0, rows.size());
+    } else {
+      for (vector_size_t i = 0; i < rows.size(); ++i) {
+        bits::setBit(rawInMap, i, bits::isBitSet(inMap, rows[i]));
+      }
+    }
+  }
+  if (!reader_.returnReaderNulls_ && nulls) {
+    for (vector_size_t i = 0; i < rows.size(); ++i) {
+      if (bits::isBitNull(nulls, rows[i])) {
+        bits::setNull(reader_.rawResultNulls_, i);
+        reader_.anyNulls_ = true;
+      }
+    }
+  }
+  *result = std::make_shared<FlatMapVector>(
+      &reader_.memoryPool_,
+      reader_.requestedType_,
+      reader_.resultNulls(),
+      rows.size(),
+      distinctKeys(),
+      std::move(mapValues),
+      std::move(inMaps));
+}
+
 } // namespace facebook::velox::dwio::common
@@ -390,9 +390,10 @@ uint64_t Lz4Decompressor::decompressInternal(
   return static_cast<uint64_t>(result);
 }
 
-// NOTE: We do not keep `ZSTD_DCtx' around on purpose, because if we keep it
-// around, in flat map column reader we have hundreds of thousands of
-// decompressors at same time and causing OOM.
+// NOTE: We do not keep a `ZSTD_DCtx' per decompressor on purpose, because in
+// flat map column reader we have hundreds of thousands of decompressors at same
+// time and causing OOM. Instead each thread reuses one context, which avoids
+// allocating and initializing a context on every block.
 class ZstdDecompressor : public Decompressor {
  public:
   explicit ZstdDecompressor(
@@ -416,7 +417,11 @@ uint64_t ZstdDecompressor::decompress(
     uint64_t srcLength,
     char* dest,
     uint64_t destLength) {
-  auto ret = ZSTD_decompress(dest, destLength, src, srcLength);
+  thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> context{
+      ZSTD_createDCtx(), ZSTD_freeDCtx};
+  DWIO_ENSURE_NOT_NULL(context.get(), "Failed to create ZSTD context");
+  auto ret = ZSTD_decompressDCtx(
+      context.get(), dest, destLength, src, srcLength);
   DWIO_ENSURE(
       !ZSTD_isError(ret),
       "ZSTD returned an error: ",
@@ -109,8 +109,44 @@ bool PagedInputStream::Next(const void** data, int32_t* size) {
   return readOrSkip(data, size);
 }
 
-// Read into `data' if it is not null; otherwise skip some of the pending.
+void PagedInputStream::readFully(char* buffer, size_t bufferSize) {
+  if (!decompressor_ || decrypter_) {
+    SeekableInputStream::readFully(buffer, bufferSize);
+    return;
+  }
+  VELOX_CHECK(skipAllPending(), "bad read in readFully");
+  size_t pos = 0;
+  while (pos < bufferSize) {
+    const void* chunk;
+    int32_t length;
+    VELOX_CHECK(
+        readOrSkipImpl(&chunk, &length, buffer + pos, bufferSize - pos),
+        "bad read in readFully");
+    const auto* bytes = reinterpret_cast<const char*>(chunk);
+    if (bytes == buffer + pos) {
+      pos += length;
+      continue;
+    }
+    const size_t bytesToCopy =
+        std::min(static_cast<size_t>(length), bufferSize - pos);
+    std::copy(bytes, bytes + bytesToCopy, buffer + pos);
+    pos += bytesToCopy;
+    if (bytesToCopy < length) {
+      BackUp(length - bytesToCopy);
+    }
+  }
+}
+
 bool PagedInputStream::readOrSkip(const void** data, int32_t* size) {
+  return readOrSkipImpl(data, size, nullptr, 0);
+}
+
+// Read into `data' if it is not null; otherwise skip some of the pending.
+bool PagedInputStream::readOrSkipImpl(
+    const void** data,
+    int32_t* size,
+    char* destination,
+    size_t destinationSize) {
   if (data) {
     VELOX_CHECK_EQ(pendingSkip_, 0);
   }
@@ -184,6 +220,16 @@ bool PagedInputStream::readOrSkip(const void** data, int32_t* size) {
     if (!data && exact && decompressedLength <= pendingSkip_) {
       *size = decompressedLength;
       outputBufferPtr_ = nullptr;
+    } else if (
+        data && destination && exact &&
+        decompressedLength <= destinationSize) {
+      *size = static_cast<int32_t>(decompressor_->decompress(
+          input, remainingLength_, destination, decompressedLength));
+      *data = destination;
+      // 'destination' belongs to the caller. Backing up into it is not
+      // possible and seeking into this block must re-read the input.
+      outputBufferPtr_ = nullptr;
+      lastHeaderOffset_ = std::numeric_limits<uint64_t>::max();
     } else {
       prepareOutputBuffer(decompressedLength);
       outputBufferLength_ = decompressor_->decompress(
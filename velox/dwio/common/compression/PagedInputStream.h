@@ -53,6 +53,10 @@ class PagedInputStream : public dwio::common::SeekableInputStream {
   bool Next(const void** data, int32_t* size) override;
   void BackUp(int32_t count) override;
 
+  /// Decompresses the blocks that fit entirely in 'buffer' directly into
+  /// 'buffer' instead of into 'outputBuffer_' followed by a copy.
+  void readFully(char* buffer, size_t bufferSize) override;
+
   // NOTE: This always returns true.
   bool SkipInt64(int64_t count) override;
 
@@ -121,6 +125,15 @@ class PagedInputStream : public dwio::common::SeekableInputStream {
 
   virtual bool readOrSkip(const void** data, int32_t* size);
 
+  // Same as readOrSkip(). If 'destination' is set and the next block is
+  // compressed and its decompressed size is known and at most
+  // 'destinationSize', decompresses the block into 'destination'.
+  bool readOrSkipImpl(
+      const void** data,
+      int32_t* size,
+      char* destination,
+      size_t destinationSize);
+
   // input stream where to read compressed/encrypted data
   std::unique_ptr<SeekableInputStream> input_;
   memory::MemoryPool& pool_;
@@ -209,7 +209,10 @@ class SelectiveFlatMapReader : public SelectiveStructColumnReaderBase {
             scanSpec),
         flatMap_(
             *this,
-            getKeyNodes<T>(requestedType, fileType, params, scanSpec, false)) {}
+            getKeyNodes<T>(requestedType, fileType, params, scanSpec, false)),
+        preserveFlatMap_(params.stripeStreams()
+                             .getRowReaderOptions()
+                             .preserveFlatMapsInMemory()) {}
 
   void read(vector_size_t offset, RowSet rows, const uint64_t* incomingNulls)
       override {
@@ -217,12 +220,18 @@ class SelectiveFlatMapReader : public SelectiveStructColumnReaderBase {
   }
 
   void getValues(RowSet rows, VectorPtr* result) override {
-    flatMap_.getValues(rows, result);
+    if (preserveFlatMap_) {
+      flatMap_.getFlatMapValues(rows, result);
+    } else {
+      flatMap_.getValues(rows, result);
+    }
   }
 
  private:
   dwio::common::SelectiveFlatMapColumnReaderHelper<T, KeyNode<T>, DwrfData>
       flatMap_;
+  // If true, returns FlatMapVectors instead of MapVectors.
+  const bool preserveFlatMap_;
 };
 
 template <typename T>
@@ -241,6 +241,52 @@ TEST_P(CompressionTest, compressRandomBytes) {
       memSink, kind_, block, testData, dataSize, *pool_, decrypter_);
 }
 
+TEST_P(CompressionTest, readFully) {
+  MemorySink memSink(DEFAULT_MEM_STREAM_SIZE, {.pool = pool_.get()});
+
+  constexpr uint64_t block = 1024;
+  constexpr size_t dataSize = 256 * 1024;
+
+  std::vector<char> testData(dataSize);
+  generateRandomData(testData.data(), dataSize / 2, true);
+  std::memset(testData.data() + dataSize / 2, 'a', dataSize / 2);
+  compressAndVerify(
+      kind_, memSink, block, *pool_, testData.data(), dataSize, encrypter_);
+
+  auto decompressStream = createDecompressor(
+      kind_,
+      std::make_unique<SeekableArrayInputStream>(
+          memSink.data(), memSink.size()),
+      block,
+      *pool_,
+      "Test Comrpession",
+      decrypter_);
+
+  // Mixes reads smaller than a block, reads spanning several blocks and reads
+  // following a BackUp().
+  std::vector<char> result(dataSize);
+  const std::vector<size_t> readSizes = {1, 100, 3 * block, 7, 5 * block + 3};
+  size_t pos = 0;
+  for (auto i = 0; pos < dataSize; ++i) {
+    const auto readSize =
+        std::min(readSizes[i % readSizes.size()], dataSize - pos);
+    decompressStream->readFully(result.data() + pos, readSize);
+    pos += readSize;
+    if (i % 3 == 0 && pos < dataSize) {
+      const void* chunk;
+      int32_t size;
+      ASSERT_TRUE(decompressStream->Next(&chunk, &size));
+      ASSERT_GT(size, 0);
+      decompressStream->BackUp(size);
+    }
+  }
+  ASSERT_EQ(testData, result);
+
+  const void* chunk;
+  int32_t size;
+  ASSERT_FALSE(decompressStream->Next(&chunk, &size));
+}
+
 void verifyProto(
     const MemorySink& memSink,
     CompressionKind kind,
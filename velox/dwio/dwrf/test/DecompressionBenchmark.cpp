@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/Benchmark.h>
+#include <folly/Random.h>
+#include <folly/init/Init.h>
+#include <lz4.h>
+#include <snappy.h>
+#include <zlib.h>
+#include <zstd.h>
+
+#include "velox/common/memory/Memory.h"
+#include "velox/dwio/dwrf/common/Compression.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::dwio::common;
+using namespace facebook::velox::dwrf;
+
+namespace {
+
+constexpr uint64_t kBlockSize = 256 << 10;
+constexpr size_t kDataSize = 64 << 20;
+constexpr size_t kReadSize = 1 << 20;
+
+// Column-like data: runs of a few distinct values with random lengths.
+std::string makeData() {
+  std::string data(kDataSize, 0);
+  folly::Random::DefaultGenerator rng(1);
+  size_t i = 0;
+  while (i < kDataSize) {
+    const auto value = static_cast<char>('a' + folly::Random::rand32(8, rng));
+    const auto length =
+        std::min<size_t>(1 + folly::Random::rand32(16, rng), kDataSize - i);
+    std::memset(data.data() + i, value, length);
+    i += length;
+  }
+  return data;
+}
+
+size_t compressBlock(
+    common::CompressionKind kind,
+    const char* input,
+    size_t inputSize,
+    char* output,
+    size_t outputSize) {
+  switch (kind) {
+    case common::CompressionKind_ZLIB: {
+      z_stream stream{};
+      VELOX_CHECK_EQ(
+          deflateInit2(
+              &stream,
+              Z_DEFAULT_COMPRESSION,
+              Z_DEFLATED,
+              Compressor::DWRF_ORC_ZLIB_WINDOW_BITS,
+              8,
+              Z_DEFAULT_STRATEGY),
+          Z_OK);
+      stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input));
+      stream.avail_in = inputSize;
+      stream.next_out = reinterpret_cast<Bytef*>(output);
+      stream.avail_out = outputSize;
+      VELOX_CHECK_EQ(deflate(&stream, Z_FINISH), Z_STREAM_END);
+      deflateEnd(&stream);
+      return stream.total_out;
+    }
+    case common::CompressionKind_ZSTD: {
+      auto size = ZSTD_compress(output, outputSize, input, inputSize, 3);
+      VELOX_CHECK(!ZSTD_isError(size));
+      return size;
+    }
+    case common::CompressionKind_LZ4:
+      return LZ4_compress_default(input, output, inputSize, outputSize);
+    case common::CompressionKind_SNAPPY: {
+      size_t size;
+      snappy::RawCompress(input, inputSize, output, &size);
+      return size;
+    }
+    default:
+      VELOX_UNREACHABLE();
+  }
+}
+
+// Compresses 'data' into a stream of dwrf compression blocks, each preceded
+// by its 3 byte header.
+std::string compress(common::CompressionKind kind, const std::string& data) {
+  std::string result;
+  std::string block(2 * kBlockSize, 0);
+  for (size_t offset = 0; offset < data.size(); offset += kBlockSize) {
+    const auto inputSize = std::min<size_t>(kBlockSize, data.size() - offset);
+    const auto size = compressBlock(
+        kind, data.data() + offset, inputSize, block.data(), block.size());
+    VELOX_CHECK_LT(size, inputSize);
+    const uint32_t header = size << 1;
+    result.push_back(static_cast<char>(header));
+    result.push_back(static_cast<char>(header >> 8));
+    result.push_back(static_cast<char>(header >> 16));
+    result.append(block.data(), size);
+  }
+  return result;
+}
+
+struct BenchmarkData {
+  std::string data = makeData();
+  std::unordered_map<common::CompressionKind, std::string> compressed;
+
+  const std::string& get(common::CompressionKind kind) {
+    auto it = compressed.find(kind);
+    if (it == compressed.end()) {
+      it = compressed.emplace(kind, compress(kind, data)).first;
+    }
+    return it->second;
+  }
+};
+
+BenchmarkData& benchmarkData() {
+  static BenchmarkData data;
+  return data;
+}
+
+std::unique_ptr<SeekableInputStream> makeStream(
+    common::CompressionKind kind,
+    memory::MemoryPool& pool) {
+  const auto& compressed = benchmarkData().get(kind);
+  return createDecompressor(
+      kind,
+      std::make_unique<SeekableArrayInputStream>(
+          compressed.data(), compressed.size()),
+      kBlockSize,
+      pool,
+      "DecompressionBenchmark");
+}
+
+// Reads the whole stream with Next().
+void next(uint32_t iterations, common::CompressionKind kind) {
+  auto pool = memory::memoryManager()->addLeafPool();
+  folly::BenchmarkSuspender suspender;
+  benchmarkData().get(kind);
+  suspender.dismiss();
+  for (uint32_t i = 0; i < iterations; ++i) {
+    auto stream = makeStream(kind, *pool);
+    const void* data;
+    int32_t size;
+    size_t total = 0;
+    while (stream->Next(&data, &size)) {
+      total += size;
+    }
+    VELOX_CHECK_EQ(total, kDataSize);
+  }
+}
+
+// Reads the whole stream into a caller-owned buffer with readFully().
+void readFully(uint32_t iterations, common::CompressionKind kind) {
+  auto pool = memory::memoryManager()->addLeafPool();
+  folly::BenchmarkSuspender suspender;
+  benchmarkData().get(kind);
+  std::string buffer(kReadSize, 0);
+  suspender.dismiss();
+  for (uint32_t i = 0; i < iterations; ++i) {
+    auto stream = makeStream(kind, *pool);
+    for (size_t offset = 0; offset < kDataSize; offset += kReadSize) {
+      stream->readFully(buffer.data(), kReadSize);
+    }
+    folly::doNotOptimizeAway(buffer);
+  }
+}
+
+} // namespace
+
+BENCHMARK_NAMED_PARAM(next, zlib, common::CompressionKind_ZLIB);
+BENCHMARK_RELATIVE_NAMED_PARAM(
+    readFully,
+    zlib,
+    common::CompressionKind_ZLIB);
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(next, zstd, common::CompressionKind_ZSTD);
+BENCHMARK_RELATIVE_NAMED_PARAM(
+    readFully,
+    zstd,
+    common::CompressionKind_ZSTD);
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(next, lz4, common::CompressionKind_LZ4);
+BENCHMARK_RELATIVE_NAMED_PARAM(readFully, lz4, common::CompressionKind_LZ4);
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(next, snappy, common::CompressionKind_SNAPPY);
+BENCHMARK_RELATIVE_NAMED_PARAM(
+    readFully,
+    snappy,
+    common::CompressionKind_SNAPPY);
+
+int32_t main(int32_t argc, char* argv[]) {
+  folly::Init init{&argc, &argv};
+  memory::MemoryManager::initialize({});
+  folly::runBenchmarks();
+  return 0;
+}
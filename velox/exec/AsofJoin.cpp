@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/AsofJoin.h"
+#include "velox/exec/OperatorUtils.h"
+#include "velox/exec/Task.h"
+
+namespace facebook::velox::exec {
+
+AsofJoin::AsofJoin(
+    int32_t operatorId,
+    DriverCtx* driverCtx,
+    const std::shared_ptr<const core::AsofJoinNode>& joinNode)
+    : Operator(
+          driverCtx,
+          joinNode->outputType(),
+          operatorId,
+          joinNode->id(),
+          "AsofJoin"),
+      joinType_{joinNode->joinType()},
+      comparison_{joinNode->comparison()},
+      matchPreceding_{
+          comparison_ == core::AsofJoinNode::Comparison::kGreaterThan ||
+          comparison_ == core::AsofJoinNode::Comparison::kGreaterThanOrEqual},
+      joinNode_(joinNode),
+      numEqualityKeys_{joinNode->numEqualityKeys()} {}
+
+void AsofJoin::initialize() {
+  Operator::initialize();
+  VELOX_CHECK_NOT_NULL(joinNode_);
+
+  const auto& leftType = joinNode_->sources()[0]->outputType();
+  for (const auto& key : joinNode_->leftKeys()) {
+    leftKeys_.push_back(leftType->getChildIdx(key->name()));
+  }
+
+  const auto& rightType = joinNode_->sources()[1]->outputType();
+  for (const auto& key : joinNode_->rightKeys()) {
+    rightKeys_.push_back(rightType->getChildIdx(key->name()));
+  }
+
+  for (auto i = 0; i < leftType->size(); ++i) {
+    auto outIndex = outputType_->getChildIdxIfExists(leftType->nameOf(i));
+    if (outIndex.has_value()) {
+      leftProjections_.emplace_back(i, outIndex.value());
+    }
+  }
+
+  for (auto i = 0; i < rightType->size(); ++i) {
+    auto outIndex = outputType_->getChildIdxIfExists(rightType->nameOf(i));
+    if (outIndex.has_value()) {
+      rightProjections_.emplace_back(i, outIndex.value());
+    }
+  }
+
+  joinNode_.reset();
+}
+
+BlockingReason AsofJoin::isBlocked(ContinueFuture* future) {
+  if (futureRightSideInput_.valid()) {
+    *future = std::move(futureRightSideInput_);
+    return BlockingReason::kWaitForMergeJoinRightSide;
+  }
+
+  return BlockingReason::kNotBlocked;
+}
+
+void AsofJoin::addInput(RowVectorPtr input) {
+  // Left-side columns are wrapped in dictionaries. Lazy vectors cannot be
+  // wrapped in dictionaries, hence, load them here.
+  for (auto& child : input->children()) {
+    child->loadedVector();
+  }
+  input_ = std::move(input);
+  index_ = 0;
+
+  const auto numRows = input_->size();
+  leftIndices_ = allocateIndices(numRows, pool());
+  rightOutput_.resize(rightProjections_.size());
+  for (auto i = 0; i < rightProjections_.size(); ++i) {
+    rightOutput_[i] = BaseVector::create(
+        outputType_->childAt(rightProjections_[i].outputChannel),
+        numRows,
+        pool());
+  }
+  numOutputRows_ = 0;
+}
+
+RowVectorPtr AsofJoin::getOutput() {
+  if (input_ == nullptr) {
+    return nullptr;
+  }
+
+  while (index_ < input_->size()) {
+    std::optional<std::pair<RowVectorPtr, vector_size_t>> match;
+    if (!findMatch(match)) {
+      return nullptr;
+    }
+    addOutputRow(match);
+    ++index_;
+  }
+
+  auto output = makeOutput();
+  input_ = nullptr;
+  return output;
+}
+
+bool AsofJoin::ensureRightInput() {
+  if (rightInput_ != nullptr && rightIndex_ < rightInput_->size()) {
+    return true;
+  }
+  rightInput_ = nullptr;
+
+  if (!rightSource_) {
+    rightSource_ = operatorCtx_->task()->getMergeJoinSource(
+        operatorCtx_->driverCtx()->splitGroupId, planNodeId());
+  }
+
+  while (!noMoreRightInput_) {
+    if (futureRightSideInput_.valid()) {
+      return false;
+    }
+    auto blockingReason =
+        rightSource_->next(&futureRightSideInput_, &rightInput_);
+    if (blockingReason != BlockingReason::kNotBlocked) {
+      return false;
+    }
+
+    if (rightInput_ == nullptr) {
+      noMoreRightInput_ = true;
+    } else if (rightInput_->size() > 0) {
+      rightIndex_ = 0;
+      return true;
+    } else {
+      rightInput_ = nullptr;
+    }
+  }
+  return true;
+}
+
+// static
+bool AsofJoin::hasNullKeys(
+    const RowVectorPtr& input,
+    vector_size_t index,
+    const std::vector<column_index_t>& keys) {
+  for (auto key : keys) {
+    if (input->childAt(key)->isNullAt(index)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int32_t AsofJoin::compareEqualityKeys(
+    const RowVectorPtr& right,
+    vector_size_t rightIndex) const {
+  for (auto i = 0; i < numEqualityKeys_; ++i) {
+    auto compare = input_->childAt(leftKeys_[i])
+                       ->compare(
+                           right->childAt(rightKeys_[i]).get(),
+                           index_,
+                           rightIndex);
+    if (compare != 0) {
+      return compare;
+    }
+  }
+  return 0;
+}
+
+bool AsofJoin::rightPrecedesLeft() const {
+  const auto compare = compareEqualityKeys(rightInput_, rightIndex_);
+  if (compare != 0) {
+    return compare > 0;
+  }
+
+  const auto asofCompare =
+      rightInput_->childAt(rightKeys_.back())
+          ->compare(
+              input_->childAt(leftKeys_.back()).get(), rightIndex_, index_);
+  switch (comparison_) {
+    case core::AsofJoinNode::Comparison::kGreaterThanOrEqual:
+    case core::AsofJoinNode::Comparison::kLessThan:
+      return asofCompare <= 0;
+    case core::AsofJoinNode::Comparison::kGreaterThan:
+    case core::AsofJoinNode::Comparison::kLessThanOrEqual:
+      return asofCompare < 0;
+  }
+  VELOX_UNREACHABLE();
+}
+
+bool AsofJoin::findMatch(
+    std::optional<std::pair<RowVectorPtr, vector_size_t>>& match) {
+  if (hasNullKeys(input_, index_, leftKeys_)) {
+    return true;
+  }
+
+  for (;;) {
+    if (!ensureRightInput()) {
+      return false;
+    }
+    if (rightInput_ == nullptr) {
+      break;
+    }
+    if (hasNullKeys(rightInput_, rightIndex_, rightKeys_)) {
+      ++rightIndex_;
+      continue;
+    }
+    if (!rightPrecedesLeft()) {
+      break;
+    }
+    if (matchPreceding_) {
+      lastPrecedingInput_ = rightInput_;
+      lastPrecedingIndex_ = rightIndex_;
+    }
+    ++rightIndex_;
+  }
+
+  if (matchPreceding_) {
+    if (lastPrecedingInput_ != nullptr &&
+        compareEqualityKeys(lastPrecedingInput_, lastPrecedingIndex_) == 0) {
+      match = std::make_pair(lastPrecedingInput_, lastPrecedingIndex_);
+    }
+  } else if (
+      rightInput_ != nullptr &&
+      compareEqualityKeys(rightInput_, rightIndex_) == 0) {
+    match = std::make_pair(rightInput_, rightIndex_);
+  }
+  return true;
+}
+
+void AsofJoin::addOutputRow(
+    const std::optional<std::pair<RowVectorPtr, vector_size_t>>& match) {
+  if (!match.has_value() && isInnerJoin(joinType_)) {
+    return;
+  }
+
+  leftIndices_->asMutable<vector_size_t>()[numOutputRows_] = index_;
+  for (auto i = 0; i < rightProjections_.size(); ++i) {
+    if (match.has_value()) {
+      rightOutput_[i]->copy(
+          match->first->childAt(rightProjections_[i].inputChannel).get(),
+          numOutputRows_,
+          match->second,
+          1);
+    } else {
+      rightOutput_[i]->setNull(numOutputRows_, true);
+    }
+  }
+  ++numOutputRows_;
+}
+
+RowVectorPtr AsofJoin::makeOutput() {
+  if (numOutputRows_ == 0) {
+    return nullptr;
+  }
+
+  std::vector<VectorPtr> children(outputType_->size());
+  // All left rows are in the output in order if this is a left join or if all
+  // rows matched. No need to wrap them in dictionaries.
+  projectChildren(
+      children,
+      input_,
+      leftProjections_,
+      numOutputRows_,
+      numOutputRows_ == input_->size() ? nullptr : leftIndices_);
+  for (auto i = 0; i < rightProjections_.size(); ++i) {
+    rightOutput_[i]->resize(numOutputRows_);
+    children[rightProjections_[i].outputChannel] = std::move(rightOutput_[i]);
+  }
+
+  return std::make_shared<RowVector>(
+      pool(), outputType_, nullptr, numOutputRows_, std::move(children));
+}
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/exec/MergeSource.h"
+#include "velox/exec/Operator.h"
+
+namespace facebook::velox::exec {
+
+/// Implements core::AsofJoinNode. Assumes both streams, left (from addInput())
+/// and right (from MergeJoinSource), are sorted in ascending order on the
+/// equality keys followed by the ASOF key. Rows with a null key never match and
+/// may appear anywhere in the streams.
+///
+/// Both streams are consumed in a single pass. For each left row, advances the
+/// right stream past the rows that precede the left row in the join key order.
+/// For kGreaterThan(OrEqual), the last of these rows is the match if it has
+/// the same equality keys. For kLessThan(OrEqual), the first right row not
+/// skipped is the match if it has the same equality keys. Only the current
+/// right batch and the batch with the last skipped row are kept in memory.
+///
+/// Produces one output batch per left batch. Left-side columns are wrapped in
+/// dictionaries. Right-side columns are copied.
+class AsofJoin : public Operator {
+ public:
+  AsofJoin(
+      int32_t operatorId,
+      DriverCtx* driverCtx,
+      const std::shared_ptr<const core::AsofJoinNode>& joinNode);
+
+  void initialize() override;
+
+  BlockingReason isBlocked(ContinueFuture* future) override;
+
+  bool needsInput() const override {
+    return input_ == nullptr;
+  }
+
+  void addInput(RowVectorPtr input) override;
+
+  RowVectorPtr getOutput() override;
+
+  bool isFinished() override {
+    return noMoreInput_ && input_ == nullptr;
+  }
+
+  void close() override {
+    if (rightSource_) {
+      rightSource_->close();
+    }
+    Operator::close();
+  }
+
+ private:
+  // Makes 'rightInput_' point to a batch with unprocessed rows. Returns false
+  // if blocked waiting for the right side. Returns true and sets 'rightInput_'
+  // to nullptr if the right side is exhausted.
+  bool ensureRightInput();
+
+  // Returns a negative number, zero or positive number if the equality keys of
+  // 'index_' row of 'input_' are less than, equal to or greater than the
+  // equality keys of 'rightIndex' row of 'right'.
+  int32_t compareEqualityKeys(
+      const RowVectorPtr& right,
+      vector_size_t rightIndex) const;
+
+  // Returns true if 'rightIndex_' row of 'rightInput_' precedes 'index_' row
+  // of 'input_' in the order of the join keys, i.e. it can no longer match any
+  // of the following left rows.
+  bool rightPrecedesLeft() const;
+
+  // Sets 'match' to the right row matching 'index_' row of 'input_'. Returns
+  // false if blocked waiting for the right side.
+  bool findMatch(std::optional<std::pair<RowVectorPtr, vector_size_t>>& match);
+
+  // Adds 'index_' row of 'input_' with 'match' or nulls to the output.
+  void addOutputRow(
+      const std::optional<std::pair<RowVectorPtr, vector_size_t>>& match);
+
+  // Wraps the output rows for 'input_' into a RowVector. Returns nullptr if
+  // there are no output rows.
+  RowVectorPtr makeOutput();
+
+  static bool hasNullKeys(
+      const RowVectorPtr& input,
+      vector_size_t index,
+      const std::vector<column_index_t>& keys);
+
+  const core::JoinType joinType_;
+  const core::AsofJoinNode::Comparison comparison_;
+  // True if the match is the last right row preceding the left row, false if
+  // it is the first right row not preceding the left row.
+  const bool matchPreceding_;
+
+  std::shared_ptr<const core::AsofJoinNode> joinNode_;
+
+  // Channels of the equality keys followed by the ASOF key.
+  std::vector<column_index_t> leftKeys_;
+  std::vector<column_index_t> rightKeys_;
+  size_t numEqualityKeys_;
+
+  std::vector<IdentityProjection> leftProjections_;
+  std::vector<IdentityProjection> rightProjections_;
+
+  // Next row of 'input_' to process.
+  vector_size_t index_{0};
+
+  std::shared_ptr<MergeJoinSource> rightSource_;
+  ContinueFuture futureRightSideInput_{ContinueFuture::makeEmpty()};
+  bool noMoreRightInput_{false};
+  RowVectorPtr rightInput_;
+  vector_size_t rightIndex_{0};
+
+  // Last right row with non-null keys that preceded the processed left rows.
+  // Used if 'matchPreceding_' is true.
+  RowVectorPtr lastPrecedingInput_;
+  vector_size_t lastPrecedingIndex_{0};
+
+  // Output being accumulated for 'input_'.
+  BufferPtr leftIndices_;
+  std::vector<VectorPtr> rightOutput_;
+  vector_size_t numOutputRows_{0};
+};
+
+} // namespace facebook::velox::exec
@@ -885,6 +885,9 @@ void Driver::closeOperators() {
   for (auto& op : operators_) {
     auto stats = op->stats(true);
     stats.numDrivers = 1;
+    for (auto& fusedStats : stats.fusedPlanNodeStats) {
+      fusedStats.numDrivers = 1;
+    }
     task()->addOperatorStats(stats);
   }
 }
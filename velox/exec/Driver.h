@@ -598,6 +598,8 @@ struct DriverFactory {
   folly::F14FastSet<core::PlanNodeId> mixedExecutionModeHashJoinNodeIds;
   /// Same as 'mixedExecutionModeHashJoinNodeIds' but for Nested Loop Joins.
   folly::F14FastSet<core::PlanNodeId> mixedExecutionModeNestedLoopJoinNodeIds;
+  /// Same as 'mixedExecutionModeHashJoinNodeIds' but for Range Joins.
+  folly::F14FastSet<core::PlanNodeId> mixedExecutionModeRangeJoinNodeIds;
 
   std::shared_ptr<Driver> createDriver(
       std::unique_ptr<DriverCtx> ctx,
@@ -673,6 +675,10 @@ struct DriverFactory {
   /// based on this pipeline.
   std::vector<core::PlanNodeId> needsNestedLoopJoinBridges() const;
 
+  /// Returns plan node IDs for which Range Join Bridges must be created based
+  /// on this pipeline.
+  std::vector<core::PlanNodeId> needsRangeJoinBridges() const;
+
   static std::vector<DriverAdapter> adapters;
 };
 
@@ -24,6 +24,13 @@ HashAggregation::HashAggregation(
     int32_t operatorId,
     DriverCtx* driverCtx,
     const std::shared_ptr<const core::AggregationNode>& aggregationNode)
+    : HashAggregation(operatorId, driverCtx, aggregationNode, nullptr) {}
+
+HashAggregation::HashAggregation(
+    int32_t operatorId,
+    DriverCtx* driverCtx,
+    const std::shared_ptr<const core::AggregationNode>& aggregationNode,
+    const std::shared_ptr<const core::GroupIdNode>& groupIdNode)
     : Operator(
           driverCtx,
           aggregationNode->outputType(),
@@ -36,6 +43,8 @@ HashAggregation::HashAggregation(
               ? driverCtx->makeSpillConfig(operatorId)
               : std::nullopt),
       aggregationNode_(aggregationNode),
+      groupIdNode_(groupIdNode),
+      incrementalGroupingSets_(groupIdNode != nullptr),
       isPartialOutput_(isPartialOutput(aggregationNode->step())),
       isGlobal_(aggregationNode->groupingKeys().empty()),
       isDistinct_(!isGlobal_ && aggregationNode->aggregates().empty()),
@@ -46,28 +55,40 @@ HashAggregation::HashAggregation(
       abandonPartialAggregationMinPct_(
           driverCtx->queryConfig().abandonPartialAggregationMinPct()),
       maxPartialAggregationMemoryUsage_(
-          driverCtx->queryConfig().maxPartialAggregationMemoryUsage()) {}
+          driverCtx->queryConfig().maxPartialAggregationMemoryUsage()) {
+  if (incrementalGroupingSets_) {
+    VELOX_CHECK(aggregationNode_->incrementalGroupingSets());
+    VELOX_CHECK_EQ(aggregationNode_->sources()[0].get(), groupIdNode_.get());
+  }
+}
 
 void HashAggregation::initialize() {
   Operator::initialize();
 
   VELOX_CHECK(pool()->trackUsage());
 
-  const auto& inputType = aggregationNode_->sources()[0]->outputType();
-  auto hashers =
-      createVectorHashers(inputType, aggregationNode_->groupingKeys());
-  auto numHashers = hashers.size();
-
+  RowTypePtr inputType;
+  std::vector<std::unique_ptr<VectorHasher>> hashers;
   std::vector<column_index_t> preGroupedChannels;
-  preGroupedChannels.reserve(aggregationNode_->preGroupedKeys().size());
-  for (const auto& key : aggregationNode_->preGroupedKeys()) {
-    auto channel = exprToChannel(key.get(), inputType);
-    preGroupedChannels.push_back(channel);
-  }
+  std::vector<AggregateInfo> aggregateInfos;
+  if (incrementalGroupingSets_) {
+    aggregateInfos = initializeIncrementalGroupingSets(hashers);
+    inputType = groupingSetsInputType_;
+  } else {
+    inputType = aggregationNode_->sources()[0]->outputType();
+    hashers = createVectorHashers(inputType, aggregationNode_->groupingKeys());
 
-  std::shared_ptr<core::ExpressionEvaluator> expressionEvaluator;
-  std::vector<AggregateInfo> aggregateInfos = toAggregateInfo(
-      *aggregationNode_, *operatorCtx_, numHashers, expressionEvaluator);
+    preGroupedChannels.reserve(aggregationNode_->preGroupedKeys().size());
+    for (const auto& key : aggregationNode_->preGroupedKeys()) {
+      auto channel = exprToChannel(key.get(), inputType);
+      preGroupedChannels.push_back(channel);
+    }
+
+    std::shared_ptr<core::ExpressionEvaluator> expressionEvaluator;
+    aggregateInfos = toAggregateInfo(
+        *aggregationNode_, *operatorCtx_, hashers.size(), expressionEvaluator);
+  }
+  const auto numHashers = hashers.size();
 
   // Check that aggregate result type match the output type.
   for (auto i = 0; i < aggregateInfos.size(); i++) {
@@ -101,7 +122,9 @@ void HashAggregation::initialize() {
       std::move(aggregateInfos),
       aggregationNode_->ignoreNullKeys(),
       isPartialOutput_,
-      isRawInput(aggregationNode_->step()),
+      // With incremental grouping sets the input is the intermediate results
+      // of the finest grouping set.
+      !incrementalGroupingSets_ && isRawInput(aggregationNode_->step()),
       aggregationNode_->globalGroupingSets(),
       groupIdChannel,
       spillConfig_.has_value() ? &spillConfig_.value() : nullptr,
@@ -110,6 +133,213 @@ void HashAggregation::initialize() {
       &spillStats_);
 
   aggregationNode_.reset();
+  groupIdNode_.reset();
+}
+
+std::vector<AggregateInfo> HashAggregation::initializeIncrementalGroupingSets(
+    std::vector<std::unique_ptr<VectorHasher>>& hashers) {
+  const auto& rawInputType = groupIdNode_->sources()[0]->outputType();
+  finestInputType_ = groupIdNode_->outputType();
+  const auto numGroupingKeys = groupIdNode_->numGroupingKeys();
+  const auto numAggregates = aggregationNode_->aggregates().size();
+
+  // The GroupId output layout is grouping keys, aggregation inputs and the
+  // group id.
+  std::unordered_map<std::string, column_index_t> keyInputChannels;
+  for (const auto& keyInfo : groupIdNode_->groupingKeyInfos()) {
+    keyInputChannels[keyInfo.output] =
+        rawInputType->getChildIdx(keyInfo.input->name());
+  }
+  finestInputChannels_.reserve(finestInputType_->size() - 1);
+  for (auto i = 0; i < numGroupingKeys; ++i) {
+    finestInputChannels_.push_back(
+        keyInputChannels.at(finestInputType_->nameOf(i)));
+  }
+  for (const auto& input : groupIdNode_->aggregationInputs()) {
+    finestInputChannels_.push_back(rawInputType->getChildIdx(input->name()));
+  }
+
+  // The finest grouping set contains every grouping key that appears in at
+  // least one grouping set.
+  std::unordered_set<std::string> finestKeyNames;
+  for (const auto& groupingSet : groupIdNode_->groupingSets()) {
+    finestKeyNames.insert(groupingSet.begin(), groupingSet.end());
+  }
+  std::vector<core::FieldAccessTypedExprPtr> finestKeys;
+  for (auto i = 0; i < numGroupingKeys; ++i) {
+    const auto& name = finestInputType_->nameOf(i);
+    if (finestKeyNames.count(name) > 0) {
+      finestKeys.push_back(std::make_shared<core::FieldAccessTypedExpr>(
+          finestInputType_->childAt(i), name));
+    }
+  }
+
+  // Partial aggregation over the finest grouping set producing intermediate
+  // results.
+  std::vector<core::AggregationNode::Aggregate> partialAggregates;
+  partialAggregates.reserve(numAggregates);
+  for (const auto& aggregate : aggregationNode_->aggregates()) {
+    auto partialAggregate = aggregate;
+    partialAggregate.call = std::make_shared<core::CallTypedExpr>(
+        Aggregate::intermediateType(
+            aggregate.call->name(), aggregate.rawInputTypes),
+        aggregate.call->inputs(),
+        aggregate.call->name());
+    partialAggregates.push_back(std::move(partialAggregate));
+  }
+  const auto finestNode = std::make_shared<core::AggregationNode>(
+      aggregationNode_->id(),
+      core::AggregationNode::Step::kPartial,
+      finestKeys,
+      std::vector<core::FieldAccessTypedExprPtr>{},
+      aggregationNode_->aggregateNames(),
+      partialAggregates,
+      /*ignoreNullKeys*/ false,
+      groupIdNode_);
+  finestOutputType_ = finestNode->outputType();
+
+  std::shared_ptr<core::ExpressionEvaluator> expressionEvaluator;
+  auto finestAggregateInfos = toAggregateInfo(
+      *finestNode, *operatorCtx_, finestKeys.size(), expressionEvaluator);
+  finestGroupingSet_ = std::make_unique<GroupingSet>(
+      finestInputType_,
+      createVectorHashers(finestInputType_, finestKeys),
+      std::vector<column_index_t>{},
+      std::move(finestAggregateInfos),
+      /*ignoreNullKeys*/ false,
+      /*isPartial*/ true,
+      /*isRawInput*/ true,
+      std::vector<vector_size_t>{},
+      std::nullopt,
+      /*spillConfig*/ nullptr,
+      &nonReclaimableSection_,
+      operatorCtx_.get(),
+      &spillStats_);
+
+  // The grouping sets are computed from the intermediate results with the
+  // missing grouping keys set to null.
+  std::vector<std::string> names;
+  std::vector<TypePtr> types;
+  for (auto i = 0; i < numGroupingKeys; ++i) {
+    names.push_back(finestInputType_->nameOf(i));
+    types.push_back(finestInputType_->childAt(i));
+  }
+  for (auto i = 0; i < numAggregates; ++i) {
+    names.push_back(aggregationNode_->aggregateNames()[i]);
+    types.push_back(finestOutputType_->childAt(finestKeys.size() + i));
+  }
+  names.push_back(groupIdNode_->groupIdName());
+  types.push_back(BIGINT());
+  groupingSetsInputType_ = ROW(std::move(names), std::move(types));
+
+  groupingSetKeys_.reserve(groupIdNode_->groupingSets().size());
+  for (const auto& groupingSet : groupIdNode_->groupingSets()) {
+    std::vector<std::optional<column_index_t>> keys(numGroupingKeys);
+    for (const auto& name : groupingSet) {
+      keys[finestInputType_->getChildIdx(name)] =
+          finestOutputType_->getChildIdx(name);
+    }
+    groupingSetKeys_.push_back(std::move(keys));
+  }
+
+  hashers = createVectorHashers(
+      groupingSetsInputType_, aggregationNode_->groupingKeys());
+
+  // Aggregation over the intermediate results of the finest grouping set.
+  // The functions merge intermediate results: a single aggregation finishes
+  // with a final step, a partial aggregation with an intermediate step.
+  const auto mergeNode = std::make_shared<core::AggregationNode>(
+      aggregationNode_->id(),
+      aggregationNode_->step() == core::AggregationNode::Step::kSingle
+          ? core::AggregationNode::Step::kFinal
+          : core::AggregationNode::Step::kIntermediate,
+      aggregationNode_->groupingKeys(),
+      aggregationNode_->preGroupedKeys(),
+      aggregationNode_->aggregateNames(),
+      aggregationNode_->aggregates(),
+      aggregationNode_->globalGroupingSets(),
+      aggregationNode_->groupId(),
+      aggregationNode_->ignoreNullKeys(),
+      groupIdNode_);
+  auto aggregateInfos = toAggregateInfo(
+      *mergeNode, *operatorCtx_, hashers.size(), expressionEvaluator);
+  for (auto i = 0; i < numAggregates; ++i) {
+    auto& info = aggregateInfos[i];
+    info.inputs = {static_cast<column_index_t>(numGroupingKeys + i)};
+    info.constantInputs = {nullptr};
+    info.mask = std::nullopt;
+  }
+  return aggregateInfos;
+}
+
+RowVectorPtr HashAggregation::makeFinestGroupingSetInput(
+    const RowVectorPtr& input) {
+  const auto numRows = input->size();
+  std::vector<VectorPtr> children;
+  children.reserve(finestInputType_->size());
+  for (auto channel : finestInputChannels_) {
+    children.push_back(input->childAt(channel));
+  }
+  // The group id is not used by the finest grouping set.
+  children.push_back(BaseVector::createNullConstant(BIGINT(), numRows, pool()));
+  return std::make_shared<RowVector>(
+      pool(), finestInputType_, nullptr, numRows, std::move(children));
+}
+
+void HashAggregation::addFinestGroupingSetResults() {
+  VELOX_CHECK_NOT_NULL(finestGroupingSet_);
+
+  const auto& queryConfig = operatorCtx_->driverCtx()->queryConfig();
+  const auto maxOutputRows = queryConfig.preferredOutputBatchRows();
+  const auto numGroupingKeys = groupingSetKeys_[0].size();
+  const auto numAggregates =
+      groupingSetsInputType_->size() - numGroupingKeys - 1;
+  const auto numFinestKeys = finestOutputType_->size() - numAggregates;
+
+  RowContainerIterator iterator;
+  for (;;) {
+    auto finestResult = std::static_pointer_cast<RowVector>(
+        BaseVector::create(finestOutputType_, maxOutputRows, pool()));
+    if (!finestGroupingSet_->getOutput(
+            maxOutputRows,
+            queryConfig.preferredOutputBatchBytes(),
+            iterator,
+            finestResult)) {
+      break;
+    }
+
+    const auto numRows = finestResult->size();
+    for (auto groupingSetIndex = 0; groupingSetIndex < groupingSetKeys_.size();
+         ++groupingSetIndex) {
+      const auto& keys = groupingSetKeys_[groupingSetIndex];
+      std::vector<VectorPtr> children;
+      children.reserve(groupingSetsInputType_->size());
+      for (auto i = 0; i < numGroupingKeys; ++i) {
+        if (keys[i].has_value()) {
+          children.push_back(finestResult->childAt(keys[i].value()));
+        } else {
+          children.push_back(BaseVector::createNullConstant(
+              groupingSetsInputType_->childAt(i), numRows, pool()));
+        }
+      }
+      for (auto i = numFinestKeys; i < finestResult->childrenSize(); ++i) {
+        children.push_back(finestResult->childAt(i));
+      }
+      children.push_back(std::make_shared<ConstantVector<int64_t>>(
+          pool(), numRows, false, BIGINT(), groupingSetIndex));
+
+      groupingSet_->addInput(
+          std::make_shared<RowVector>(
+              pool(),
+              groupingSetsInputType_,
+              nullptr,
+              numRows,
+              std::move(children)),
+          false);
+    }
+  }
+
+  finestGroupingSet_->resetTable();
 }
 
 bool HashAggregation::abandonPartialAggregationEarly(int64_t numOutput) const {
@@ -119,6 +349,19 @@ bool HashAggregation::abandonPartialAggregationEarly(int64_t numOutput) const {
 }
 
 void HashAggregation::addInput(RowVectorPtr input) {
+  if (incrementalGroupingSets_) {
+    finestGroupingSet_->addInput(makeFinestGroupingSetInput(input), false);
+    numInputRows_ += input->size();
+    // A partial aggregation flushes the grouping sets computed so far once the
+    // finest grouping set reaches the partial aggregation memory limit.
+    if (isPartialOutput_ &&
+        finestGroupingSet_->isPartialFull(maxPartialAggregationMemoryUsage_)) {
+      addFinestGroupingSetResults();
+      partialFull_ = true;
+    }
+    return;
+  }
+
   if (!pushdownChecked_) {
     mayPushdown_ = operatorCtx_->driver()->mayPushdownAggregation(this);
     pushdownChecked_ = true;
@@ -218,7 +461,9 @@ void HashAggregation::resetPartialOutputIfNeed() {
   }
   groupingSet_->resetTable();
   partialFull_ = false;
-  if (!finished_) {
+  // Partial aggregation with incremental grouping sets is never abandoned:
+  // 'groupingSet_' does not take raw input.
+  if (!finished_ && !incrementalGroupingSets_) {
     maybeIncreasePartialAggregationMemoryUsage(aggregationPct);
   }
   numOutputRows_ = 0;
@@ -380,6 +625,10 @@ RowVectorPtr HashAggregation::getDistinctOutput() {
 }
 
 void HashAggregation::noMoreInput() {
+  if (incrementalGroupingSets_) {
+    addFinestGroupingSetResults();
+    finestGroupingSet_.reset();
+  }
   updateEstimatedOutputRowSize();
   groupingSet_->noMoreInput();
   Operator::noMoreInput();
@@ -438,6 +687,7 @@ void HashAggregation::close() {
   Operator::close();
 
   output_ = nullptr;
+  finestGroupingSet_.reset();
   groupingSet_.reset();
 }
 
@@ -27,6 +27,16 @@ class HashAggregation : public Operator {
       DriverCtx* driverCtx,
       const std::shared_ptr<const core::AggregationNode>& aggregationNode);
 
+  /// Used for aggregations with incremental grouping sets. 'groupIdNode' is
+  /// the source of 'aggregationNode' and is fused into this operator: the
+  /// input is aggregated once over the finest grouping set and the results are
+  /// re-aggregated into each grouping set after all input has been received.
+  HashAggregation(
+      int32_t operatorId,
+      DriverCtx* driverCtx,
+      const std::shared_ptr<const core::AggregationNode>& aggregationNode,
+      const std::shared_ptr<const core::GroupIdNode>& groupIdNode);
+
   void initialize() override;
 
   void addInput(RowVectorPtr input) override;
@@ -74,8 +84,30 @@ class HashAggregation : public Operator {
 
   void updateEstimatedOutputRowSize();
 
+  // Sets up 'finestGroupingSet_' which aggregates raw input over the union of
+  // the grouping keys of all grouping sets and produces intermediate results.
+  // Returns the aggregate infos for 'groupingSet_' which re-aggregates these
+  // intermediate results into the grouping sets.
+  std::vector<AggregateInfo> initializeIncrementalGroupingSets(
+      std::vector<std::unique_ptr<VectorHasher>>& hashers);
+
+  // Returns 'input' arranged in the GroupId output layout with all grouping
+  // keys present.
+  RowVectorPtr makeFinestGroupingSetInput(const RowVectorPtr& input);
+
+  // Re-aggregates the intermediate results of 'finestGroupingSet_' into
+  // 'groupingSet_' once for each grouping set and clears
+  // 'finestGroupingSet_'. Called when all input is received and, for a
+  // partial aggregation, whenever 'finestGroupingSet_' is full.
+  void addFinestGroupingSetResults();
+
   std::shared_ptr<const core::AggregationNode> aggregationNode_;
 
+  // Set if the source GroupIdNode is fused into this operator to compute
+  // grouping sets incrementally. Reset after initialization.
+  std::shared_ptr<const core::GroupIdNode> groupIdNode_;
+  const bool incrementalGroupingSets_;
+
   const bool isPartialOutput_;
   const bool isGlobal_;
   const bool isDistinct_;
@@ -114,6 +146,32 @@ class HashAggregation : public Operator {
 
   // Possibly reusable output vector.
   RowVectorPtr output_;
+
+  // The following members are used only with incremental grouping sets.
+
+  // GroupId output layout used as the input type of 'finestGroupingSet_'.
+  RowTypePtr finestInputType_;
+
+  // For each column of 'finestInputType_' except the trailing group id, the
+  // index of the corresponding column in the raw input.
+  std::vector<column_index_t> finestInputChannels_;
+
+  // Aggregates the raw input over the finest grouping set. Cleared after its
+  // results have been re-aggregated into 'groupingSet_'. Reset after all input
+  // is received.
+  std::unique_ptr<GroupingSet> finestGroupingSet_;
+
+  // Layout of the intermediate results produced by 'finestGroupingSet_'.
+  RowTypePtr finestOutputType_;
+
+  // Input type of 'groupingSet_': the grouping keys, the intermediate
+  // results and the group id.
+  RowTypePtr groupingSetsInputType_;
+
+  // For each grouping set, the index of every grouping key of
+  // 'groupingSetsInputType_' in the output of 'finestGroupingSet_' or
+  // std::nullopt if the key is not part of the grouping set.
+  std::vector<std::vector<std::optional<column_index_t>>> groupingSetKeys_;
 };
 
 } // namespace facebook::velox::exec
@@ -64,6 +64,7 @@ HashBuild::HashBuild(
       joinType_{joinNode_->joinType()},
       nullAware_{joinNode_->isNullAware()},
       needProbedFlagSpill_{needRightSideJoin(joinType_)},
+      dropDuplicates_{isKeyOnlyHashJoinTable(joinNode_)},
       joinBridge_(operatorCtx_->task()->getHashJoinBridgeLocked(
           operatorCtx_->driverCtx()->splitGroupId,
           planNodeId())),
@@ -91,9 +92,10 @@ HashBuild::HashBuild(
     types.emplace_back(inputType->childAt(channel));
   }
 
-  // Identify the non-key build side columns and make a decoder for each.
+  // Identify the non-key build side columns and make a decoder for each. Key
+  // only tables do not store them.
   const int32_t numDependents = inputType->size() - numKeys;
-  if (numDependents > 0) {
+  if (numDependents > 0 && !dropDuplicates_) {
     // Number of join keys (numKeys) may be less then number of input columns
     // (inputType->size()). In this case numDependents is negative and cannot be
     // used to call 'reserve'. This happens when we join different probe side
@@ -102,7 +104,7 @@ HashBuild::HashBuild(
     dependentChannels_.reserve(numDependents);
     decoders_.reserve(numDependents);
   }
-  for (auto i = 0; i < inputType->size(); ++i) {
+  for (auto i = 0; i < inputType->size() && !dropDuplicates_; ++i) {
     if (keyChannelMap_.find(i) == keyChannelMap_.end()) {
       dependentChannels_.emplace_back(i);
       decoders_.emplace_back(std::make_unique<DecodedVector>());
@@ -155,11 +157,6 @@ void HashBuild::setupTable() {
             .minTableRowsForParallelJoinBuild(),
         pool());
   } else {
-    // (Left) semi and anti join with no extra filter only needs to know whether
-    // there is a match. Hence, no need to store entries with duplicate keys.
-    const bool dropDuplicates = !joinNode_->filter() &&
-        (joinNode_->isLeftSemiFilterJoin() ||
-         joinNode_->isLeftSemiProjectJoin() || isAntiJoin(joinType_));
     // Right semi join needs to tag build rows that were probed.
     const bool needProbedFlag = joinNode_->isRightSemiFilterJoin();
     if (isLeftNullAwareJoinWithFilter(joinNode_)) {
@@ -168,7 +165,7 @@ void HashBuild::setupTable() {
       table_ = HashTable<false>::createForJoin(
           std::move(keyHashers),
           dependentTypes,
-          !dropDuplicates, // allowDuplicates
+          !dropDuplicates_, // allowDuplicates
           needProbedFlag, // hasProbedFlag
           operatorCtx_->driverCtx()
               ->queryConfig()
@@ -179,7 +176,7 @@ void HashBuild::setupTable() {
       table_ = HashTable<true>::createForJoin(
           std::move(keyHashers),
           dependentTypes,
-          !dropDuplicates, // allowDuplicates
+          !dropDuplicates_, // allowDuplicates
           needProbedFlag, // hasProbedFlag
           operatorCtx_->driverCtx()
               ->queryConfig()
@@ -188,6 +185,9 @@ void HashBuild::setupTable() {
     }
   }
   analyzeKeys_ = table_->hashMode() != BaseHashTable::HashMode::kHash;
+  if (dropDuplicates_) {
+    lookup_ = std::make_unique<HashLookup>(table_->hashers());
+  }
 }
 
 void HashBuild::setupSpiller(SpillPartition* spillPartition) {
@@ -381,6 +381,19 @@ void HashBuild::addInput(RowVectorPtr input) {
     return;
   }
 
+  if (dropDuplicates_ && !abandonDedup_) {
+    if (!shouldAbandonDedup()) {
+      insertDistinctRows(input);
+      return;
+    }
+    // The rows inserted so far stay in 'table_'. The hash table over them is
+    // rebuilt with the other rows when the join table is prepared.
+    abandonDedup_ = true;
+    lookup_.reset();
+    analyzeKeys_ = table_->hashMode() != BaseHashTable::HashMode::kHash;
+    addRuntimeStat(kAbandonedBuildDedup, RuntimeCounter(1));
+  }
+
   if (analyzeKeys_ && hashes_.size() < activeRows_.end()) {
     hashes_.resize(activeRows_.end());
   }
@@ -425,6 +438,29 @@ void HashBuild::addInput(RowVectorPtr input) {
   });
 }
 
+void HashBuild::insertDistinctRows(const RowVectorPtr& input) {
+  const auto startPartitionBit = isInputFromSpill()
+      ? spillConfig()->startPartitionBit
+      : BaseHashTable::kNoSpillInputStartPartitionBit;
+  numDedupInputRows_ += activeRows_.countSelected();
+  table_->prepareForGroupProbe(
+      *lookup_, input, activeRows_, startPartitionBit);
+  if (lookup_->rows.empty()) {
+    return;
+  }
+  table_->groupProbe(*lookup_, startPartitionBit);
+}
+
+bool HashBuild::shouldAbandonDedup() const {
+  // Checking for duplicates costs a hash table lookup per input row. Keep
+  // doing it only if it drops a good share of the rows.
+  constexpr int64_t kAbandonDedupMinRows = 100'000;
+  constexpr int64_t kAbandonDedupMinPct = 80;
+  return numDedupInputRows_ >= kAbandonDedupMinRows &&
+      static_cast<int64_t>(table_->numDistinct()) * 100 >=
+      numDedupInputRows_ * kAbandonDedupMinPct;
+}
+
 void HashBuild::ensureInputFits(RowVectorPtr& input) {
   // NOTE: we don't need memory reservation if all the partitions are spilling
   // as we spill all the input rows to disk directly.
@@ -717,6 +753,7 @@ bool HashBuild::finishHashBuild() {
       build->stateCleared_ = true;
       VELOX_CHECK_NOT_NULL(build->table_);
       otherTables.push_back(std::move(build->table_));
+      build->lookup_.reset();
       spiller = std::move(build->spiller_);
     }
     if (spiller != nullptr) {
@@ -762,6 +799,7 @@ bool HashBuild::finishHashBuild() {
       RuntimeCounter(timing.wallNanos, RuntimeCounter::Unit::kNanos));
 
   addRuntimeStats();
+  lookup_.reset();
   joinBridge_->setHashTable(
       std::move(table_), std::move(spillPartitions), joinHasNullKeys_);
   if (spillEnabled()) {
@@ -873,6 +911,7 @@ void HashBuild::setupSpillInput(HashJoinBridge::SpillInput spillInput) {
     return;
   }
 
+  lookup_.reset();
   table_.reset();
   spiller_.reset();
   spillInputReader_.reset();
@@ -1187,6 +1226,7 @@ void HashBuild::close() {
     stateCleared_ = true;
     joinBridge_.reset();
     spiller_.reset();
+    lookup_.reset();
     table_.reset();
   }
 }
@@ -58,6 +58,10 @@ class HashBuild final : public Operator {
   };
   static std::string stateName(State state);
 
+  /// Runtime stat set if a build side that drops duplicate join keys stops
+  /// dropping them on insert because the input has few duplicates.
+  static inline const std::string kAbandonedBuildDedup{"abandonedBuildDedup"};
+
   HashBuild(
       int32_t operatorId,
       DriverCtx* driverCtx,
@@ -141,6 +145,14 @@ class HashBuild final : public Operator {
   // enabled.
   void ensureInputFits(RowVectorPtr& input);
 
+  // Inserts the active rows of 'input' with a key not in 'table_' yet. Used
+  // if 'dropDuplicates_' is true.
+  void insertDistinctRows(const RowVectorPtr& input);
+
+  // Returns true if dropping duplicates on insert should be abandoned because
+  // most input rows so far had distinct keys.
+  bool shouldAbandonDedup() const;
+
   // Invoked to ensure there is sufficient memory to build the join table with
   // the specified 'numRows' if spilling is enabled. The function throws to fail
   // the query if the memory reservation fails.
@@ -221,6 +233,13 @@ class HashBuild final : public Operator {
   // not.
   const bool needProbedFlagSpill_;
 
+  // True if the hash table drops rows with duplicate join keys. (Left) semi and
+  // anti joins with no extra filter only need to know whether there is a
+  // match. The input rows are then inserted with groupProbe() so that the
+  // duplicates are dropped on insert instead of being stored and dropped when
+  // the table is built.
+  const bool dropDuplicates_;
+
   std::shared_ptr<HashJoinBridge> joinBridge_;
 
   bool exceededMaxSpillLevelLimit_{false};
@@ -269,6 +288,17 @@ class HashBuild final : public Operator {
   // Set of active rows during addInput().
   SelectivityVector activeRows_;
 
+  // Used to insert the input rows into 'table_' if 'dropDuplicates_' is true.
+  std::unique_ptr<HashLookup> lookup_;
+
+  // Number of input rows inserted with insertDistinctRows().
+  int64_t numDedupInputRows_{0};
+
+  // True if dropping duplicates on insert was abandoned. The following input
+  // rows are stored as is and the duplicates are dropped when the table is
+  // built.
+  bool abandonDedup_{false};
+
   // True if this is a build side of an anti or left semi project join and has
   // at least one entry with null join keys.
   bool joinHasNullKeys_{false};
@@ -192,6 +192,13 @@ bool isLeftNullAwareJoinWithFilter(
       joinNode->isNullAware() && (joinNode->filter() != nullptr);
 }
 
+bool isKeyOnlyHashJoinTable(
+    const std::shared_ptr<const core::HashJoinNode>& joinNode) {
+  return (joinNode->isAntiJoin() || joinNode->isLeftSemiProjectJoin() ||
+          joinNode->isLeftSemiFilterJoin()) &&
+      (joinNode->filter() == nullptr);
+}
+
 uint64_t HashJoinMemoryReclaimer::reclaim(
     memory::MemoryPool* pool,
     uint64_t targetBytes,
@@ -238,6 +245,29 @@ bool needRightSideJoin(core::JoinType joinType) {
       isRightSemiFilterJoin(joinType) || isRightSemiProjectJoin(joinType);
 }
 
+RowTypePtr hashJoinTableType(
+    const RowType* buildType,
+    const std::vector<core::FieldAccessTypedExprPtr>& keys) {
+  std::vector<std::string> names;
+  std::vector<TypePtr> types;
+  std::unordered_set<column_index_t> keyChannels(keys.size());
+  names.reserve(buildType->size());
+  types.reserve(buildType->size());
+  for (const auto& key : keys) {
+    auto channel = buildType->getChildIdx(key->name());
+    names.emplace_back(buildType->nameOf(channel));
+    types.emplace_back(buildType->childAt(channel));
+    keyChannels.insert(channel);
+  }
+  for (auto i = 0; i < buildType->size(); ++i) {
+    if (keyChannels.find(i) == keyChannels.end()) {
+      names.emplace_back(buildType->nameOf(i));
+      types.emplace_back(buildType->childAt(i));
+    }
+  }
+  return ROW(std::move(names), std::move(types));
+}
+
 RowTypePtr hashJoinTableSpillType(
     const RowTypePtr& tableType,
     core::JoinType joinType) {
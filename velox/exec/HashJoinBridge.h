@@ -145,6 +145,13 @@ class HashJoinBridge : public JoinBridge {
 bool isLeftNullAwareJoinWithFilter(
     const std::shared_ptr<const core::HashJoinNode>& joinNode);
 
+/// Returns true if the hash table built for 'joinNode' only needs to store the
+/// join keys. Left semi and anti joins without a filter only check whether a
+/// probe row has a match and never output build side columns. Their hash
+/// tables drop duplicate keys and do not store the non-key build side columns.
+bool isKeyOnlyHashJoinTable(
+    const std::shared_ptr<const core::HashJoinNode>& joinNode);
+
 class HashJoinMemoryReclaimer final : public MemoryReclaimer {
  public:
   static std::unique_ptr<memory::MemoryReclaimer> create() {
@@ -172,6 +179,12 @@ bool isHashProbeMemoryPool(const memory::MemoryPool& pool);
 
 bool needRightSideJoin(core::JoinType joinType);
 
+/// Returns the type of the hash table rows built from 'buildType': build side
+/// keys first, then dependent build side columns.
+RowTypePtr hashJoinTableType(
+    const RowType* buildType,
+    const std::vector<core::FieldAccessTypedExprPtr>& keys);
+
 /// Returns the type used to spill a given hash table type. The function
 /// might attach a boolean column at the end of 'tableType' if 'joinType' needs
 /// right side join processing. It is used by the hash join table spilling
@@ -31,32 +31,6 @@ namespace {
 // Batch size used when iterating the row container.
 constexpr int kBatchSize = 1024;
 
-// Returns the type for the hash table row. Build side keys first,
-// then dependent build side columns.
-RowTypePtr makeTableType(
-    const RowType* type,
-    const std::vector<std::shared_ptr<const core::FieldAccessTypedExpr>>&
-        keys) {
-  std::vector<std::string> names;
-  std::vector<TypePtr> types;
-  std::unordered_set<column_index_t> keyChannels(keys.size());
-  names.reserve(type->size());
-  types.reserve(type->size());
-  for (const auto& key : keys) {
-    auto channel = type->getChildIdx(key->name());
-    names.emplace_back(type->nameOf(channel));
-    types.emplace_back(type->childAt(channel));
-    keyChannels.insert(channel);
-  }
-  for (auto i = 0; i < type->size(); ++i) {
-    if (keyChannels.find(i) == keyChannels.end()) {
-      names.emplace_back(type->nameOf(i));
-      types.emplace_back(type->childAt(i));
-    }
-  }
-  return ROW(std::move(names), std::move(types));
-}
-
 // Copy values from 'rows' of 'table' according to 'projections' in
 // 'result'. Reuses 'result' children where possible.
 void extractColumns(
@@ -128,6 +102,8 @@ HashProbe::HashProbe(
       joinType_{joinNode_->joinType()},
       nullAware_{joinNode_->isNullAware()},
       probeType_(joinNode_->sources()[0]->outputType()),
+      bloomFilterMaxHitRate_{
+          driverCtx->queryConfig().hashProbeBloomFilterMaxHitRate()},
       joinBridge_(operatorCtx_->task()->getHashJoinBridgeLocked(
           operatorCtx_->driverCtx()->splitGroupId,
           planNodeId())),
@@ -151,7 +127,7 @@ void HashProbe::initialize() {
   VELOX_CHECK_NULL(lookup_);
   lookup_ = std::make_unique<HashLookup>(hashers_);
   auto buildType = joinNode_->sources()[1]->outputType();
-  auto tableType = makeTableType(buildType.get(), joinNode_->rightKeys());
+  auto tableType = hashJoinTableType(buildType.get(), joinNode_->rightKeys());
   if (joinNode_->filter()) {
     initializeFilter(joinNode_->filter(), probeType_, tableType);
   }
@@ -310,6 +286,10 @@ void HashProbe::asyncWaitForHashTable() {
 
   table_ = std::move(hashBuildResult->table);
   VELOX_CHECK_NOT_NULL(table_);
+  bloomFilter_ = nullptr;
+  bloomFilterDecided_ = bloomFilterMaxHitRate_ <= 0;
+  numSampledProbeRows_ = 0;
+  numSampledProbeHits_ = 0;
 
   maybeSetupSpillInputReader(hashBuildResult->restoredPartitionId);
   maybeSetupInputSpiller(hashBuildResult->spillPartitionIds);
@@ -375,6 +355,7 @@ void HashProbe::prepareForSpillRestore() {
     table_->clear(true);
   }
   table_.reset();
+  bloomFilter_ = nullptr;
   inputSpiller_.reset();
   spillInputReader_.reset();
   spillInputPartitionIds_.clear();
@@ -634,6 +615,9 @@ void HashProbe::addInput(RowVectorPtr input) {
   }
 
   table_->prepareForJoinProbe(*lookup_.get(), input_, activeRows_, false);
+  if (bloomFilter_ != nullptr) {
+    filterProbeRowsWithBloomFilter();
+  }
 
   if (joinIncludesMissesFromLeft(joinType_)) {
     // Make sure to allocate an entry in 'hits' for every input row to allow for
@@ -646,6 +630,7 @@ void HashProbe::addInput(RowVectorPtr input) {
     if (!lookup_->rows.empty()) {
       table_->joinProbe(*lookup_);
     }
+    maybeEnableBloomFilter();
 
     // Update lookup_->rows to include all input rows, not just
     // activeRows_ as we need to include all rows in the output.
@@ -659,10 +644,53 @@ void HashProbe::addInput(RowVectorPtr input) {
     }
     lookup_->hits.resize(lookup_->rows.back() + 1);
     table_->joinProbe(*lookup_);
+    maybeEnableBloomFilter();
   }
   results_.reset(*lookup_);
 }
 
+void HashProbe::filterProbeRowsWithBloomFilter() {
+  auto& rows = lookup_->rows;
+  const auto& hashes = lookup_->hashes;
+  vector_size_t numPassed = 0;
+  for (auto i = 0; i < rows.size(); ++i) {
+    const auto row = rows[i];
+    rows[numPassed] = row;
+    numPassed += bloomFilter_->mayContain(hashes[row]);
+  }
+  const auto numSkipped = rows.size() - numPassed;
+  if (numSkipped > 0) {
+    rows.resize(numPassed);
+    addRuntimeStat("bloomFilterSkippedRows", RuntimeCounter(numSkipped));
+  }
+}
+
+void HashProbe::maybeEnableBloomFilter() {
+  // Number of probe rows to measure the hit rate on.
+  static constexpr uint64_t kNumSampleRows = 10'000;
+  // Smaller tables are likely to stay in the cache.
+  static constexpr uint64_t kMinTableRows = 10'000;
+
+  if (bloomFilterDecided_) {
+    return;
+  }
+  const auto& hits = lookup_->hits;
+  for (auto row : lookup_->rows) {
+    numSampledProbeHits_ += hits[row] != nullptr;
+  }
+  numSampledProbeRows_ += lookup_->rows.size();
+  if (numSampledProbeRows_ < kNumSampleRows) {
+    return;
+  }
+  bloomFilterDecided_ = true;
+  if (table_->hashMode() != BaseHashTable::HashMode::kHash ||
+      table_->numDistinct() < kMinTableRows ||
+      numSampledProbeHits_ > bloomFilterMaxHitRate_ * numSampledProbeRows_) {
+    return;
+  }
+  bloomFilter_ = table_->joinBloomFilter();
+}
+
 void HashProbe::prepareOutput(vector_size_t size) {
   // Try to re-use memory for the output vectors that contain build-side data.
   // We expect output vectors containing probe-side data to be null (reset in
@@ -1876,8 +1904,9 @@ void HashProbe::prepareTableSpill(
     names.emplace_back(tableInputType->nameOf(channel));
     types.emplace_back(tableInputType->childAt(channel));
   }
-  const auto numDependents = tableInputType->size() - numKeys;
-  for (auto i = 0; i < tableInputType->size(); ++i) {
+  // Key only tables do not store the non-key build side columns.
+  const bool keyOnly = isKeyOnlyHashJoinTable(joinNode_);
+  for (auto i = 0; i < tableInputType->size() && !keyOnly; ++i) {
     if (keyChannelMap.find(i) == keyChannelMap.end()) {
       names.emplace_back(tableInputType->nameOf(i));
       types.emplace_back(tableInputType->childAt(i));
@@ -125,6 +125,15 @@ class HashProbe : public Operator {
   // for right join and full join.
   RowVectorPtr getBuildSideOutput();
 
+  // Removes the rows whose hash is not in 'bloomFilter_' from 'lookup_->rows'.
+  // These rows have no match in 'table_'.
+  void filterProbeRowsWithBloomFilter();
+
+  // Counts the probed rows with a match on the first input batches after
+  // 'table_' is set. Sets 'bloomFilter_' if few rows match and 'table_' is
+  // large enough for its lookups to miss the cache.
+  void maybeEnableBloomFilter();
+
   // Applies 'filter_' to 'outputTableRows_' and updates 'outputRowMapping_'.
   // Returns the number of passing rows.
   vector_size_t evalFilter(vector_size_t numRows);
@@ -313,6 +322,10 @@ class HashProbe : public Operator {
 
   const RowTypePtr probeType_;
 
+  // The maximum fraction of probe rows with a match for which 'bloomFilter_'
+  // is used. 0 disables the bloom filter.
+  const double bloomFilterMaxHitRate_;
+
   std::shared_ptr<HashJoinBridge> joinBridge_;
 
   ProbeOperatorState state_{ProbeOperatorState::kWaitForBuild};
@@ -365,6 +378,18 @@ class HashProbe : public Operator {
   // pipeline.
   std::shared_ptr<BaseHashTable> table_;
 
+  // Bloom filter of the build side keys of 'table_'. If set, the probe rows
+  // are checked against it before probing 'table_'.
+  const BaseHashTable::JoinBloomFilter* bloomFilter_{nullptr};
+
+  // True once the use of 'bloomFilter_' has been decided for 'table_'.
+  bool bloomFilterDecided_{false};
+
+  // Number of probed rows and of probed rows with a match before the use of
+  // 'bloomFilter_' is decided.
+  uint64_t numSampledProbeRows_{0};
+  uint64_t numSampledProbeHits_{0};
+
   // Indicates whether there was no input. Used for right semi join project.
   bool noInput_{true};
 
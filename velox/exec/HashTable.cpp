@@ -1711,6 +1711,19 @@ void HashTable<ignoreNullKeys>::prepareJoinTable(
     otherTables_.emplace_back(std::unique_ptr<HashTable<ignoreNullKeys>>(
         dynamic_cast<HashTable<ignoreNullKeys>*>(table.release())));
   }
+  // A build side that drops duplicate keys on insert fills its tables with
+  // groupProbe(). Free these and rebuild the table of 'this' below over the
+  // rows of all the tables.
+  for (auto& other : otherTables_) {
+    if (other->table_ != nullptr) {
+      other->rows_->pool()->freeContiguous(other->tableAllocation_);
+      other->table_ = nullptr;
+      other->capacity_ = 0;
+    }
+  }
+  if (table_ != nullptr) {
+    capacity_ = 0;
+  }
   bool useValueIds = mayUseValueIds(*this);
   if (useValueIds) {
     for (auto& other : otherTables_) {
@@ -1749,6 +1762,43 @@ void HashTable<ignoreNullKeys>::prepareJoinTable(
   }
 }
 
+template <bool ignoreNullKeys>
+const BaseHashTable::JoinBloomFilter*
+HashTable<ignoreNullKeys>::joinBloomFilter() {
+  if (hashMode_ != HashMode::kHash) {
+    return nullptr;
+  }
+  std::call_once(joinBloomFilterOnce_, [&]() {
+    auto filter = std::make_unique<JoinBloomFilter>(
+        memory::StlAllocator<uint64_t>(*rows_->pool()));
+    filter->reset(std::min<int64_t>(
+        numDistinct_, std::numeric_limits<int32_t>::max() / 2));
+    raw_vector<uint64_t> hashes;
+    hashes.resize(kHashBatchSize);
+    char* rows[kHashBatchSize];
+    // The rows of the other tables have the same layout as the rows of 'this',
+    // so they are hashed with the hashers of 'this' like in rehash().
+    for (int32_t i = 0; i <= otherTables_.size(); ++i) {
+      auto* rowContainer =
+          (i == 0 ? this : otherTables_[i - 1].get())->rows();
+      RowContainerIterator iterator;
+      for (;;) {
+        const auto numRows =
+            rowContainer->listRows(&iterator, kHashBatchSize, rows);
+        if (numRows == 0) {
+          break;
+        }
+        hashRows(folly::Range<char**>(rows, numRows), false, hashes);
+        for (auto j = 0; j < numRows; ++j) {
+          filter->insert(hashes[j]);
+        }
+      }
+    }
+    joinBloomFilter_ = std::move(filter);
+  });
+  return joinBloomFilter_.get();
+}
+
 template <bool ignoreNullKeys>
 int32_t HashTable<ignoreNullKeys>::listJoinResults(
     JoinResultIterator& iter,
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "velox/common/base/BloomFilter.h"
 #include "velox/common/base/Portability.h"
 #include "velox/common/memory/MemoryAllocator.h"
 #include "velox/exec/Operator.h"
@@ -304,6 +305,14 @@ class BaseHashTable {
   /// VectorHashers of 'this'.
   virtual HashMode hashMode() const = 0;
 
+  using JoinBloomFilter = BloomFilter<memory::StlAllocator<uint64_t>>;
+
+  /// Returns a bloom filter over the hash numbers of the keys of a hash join
+  /// table in kHash mode. A probe row whose hash is not in the filter has no
+  /// match. The filter is built by the first caller and is shared by all
+  /// probe threads. Returns nullptr if the table is not in kHash mode.
+  virtual const JoinBloomFilter* joinBloomFilter() = 0;
+
   /// Disables use of array or normalized key hash modes.
   void forceGenericHashMode(int8_t spillInputStartPartitionBit) {
     setHashMode(HashMode::kHash, 0, spillInputStartPartitionBit);
@@ -549,6 +558,8 @@ class HashTable : public BaseHashTable {
     return hashMode_;
   }
 
+  const JoinBloomFilter* joinBloomFilter() override;
+
   void decideHashMode(
       int32_t numNew,
       int8_t spillInputStartPartitionBit,
@@ -565,7 +576,9 @@ class HashTable : public BaseHashTable {
   /// kArray or kNormalizedKey representation. After all the build
   /// tables are filled, they are combined into one top level table
   /// with prepareJoinTable. This then takes ownership of all the data
-  /// and VectorHashers and decides the hash mode and representation.
+  /// and VectorHashers and decides the hash mode and representation. A build
+  /// side that drops duplicate keys fills its tables with groupProbe()
+  /// instead. Their hash tables are discarded and rebuilt here.
   void prepareJoinTable(
       std::vector<std::unique_ptr<BaseHashTable>> tables,
       int8_t spillInputStartPartitionBit,
@@ -999,6 +1012,12 @@ class HashTable : public BaseHashTable {
   // Owns the memory of multiple build side hash join tables that are
   // combined into a single probe hash table.
   std::vector<std::unique_ptr<HashTable<ignoreNullKeys>>> otherTables_;
+
+  // Bloom filter over the key hashes of all rows of a join table. Built on
+  // first call to joinBloomFilter().
+  std::once_flag joinBloomFilterOnce_;
+  std::unique_ptr<JoinBloomFilter> joinBloomFilter_;
+
   // Statistics maintained if kTrackLoads is set.
 
   // Number of times a row is looked up or inserted.
@@ -16,6 +16,7 @@
 #include "velox/exec/LocalPlanner.h"
 #include "velox/core/PlanFragment.h"
 #include "velox/exec/ArrowStream.h"
+#include "velox/exec/AsofJoin.h"
 #include "velox/exec/AssignUniqueId.h"
 #include "velox/exec/CallbackSink.h"
 #include "velox/exec/EnforceSingleRow.h"
@@ -30,10 +31,13 @@
 #include "velox/exec/MarkDistinct.h"
 #include "velox/exec/Merge.h"
 #include "velox/exec/MergeJoin.h"
+#include "velox/exec/MultiHashProbe.h"
 #include "velox/exec/NestedLoopJoinBuild.h"
 #include "velox/exec/NestedLoopJoinProbe.h"
 #include "velox/exec/OrderBy.h"
 #include "velox/exec/PartitionedOutput.h"
+#include "velox/exec/RangeJoinBuild.h"
+#include "velox/exec/RangeJoinProbe.h"
 #include "velox/exec/RowNumber.h"
 #include "velox/exec/StreamingAggregation.h"
 #include "velox/exec/TableScan.h"
@@ -118,7 +122,14 @@ OperatorSupplier makeConsumerSupplier(
   }
 
   if (auto join =
-          std::dynamic_pointer_cast<const core::MergeJoinNode>(planNode)) {
+          std::dynamic_pointer_cast<const core::RangeJoinNode>(planNode)) {
+    return [join](int32_t operatorId, DriverCtx* ctx) {
+      return std::make_unique<RangeJoinBuild>(operatorId, ctx, join);
+    };
+  }
+
+  if (std::dynamic_pointer_cast<const core::MergeJoinNode>(planNode) ||
+      std::dynamic_pointer_cast<const core::AsofJoinNode>(planNode)) {
     auto planNodeId = planNode->id();
     return [planNodeId](int32_t operatorId, DriverCtx* ctx) {
       auto source =
@@ -166,8 +177,9 @@ void plan(
 // Sometimes consumer limits the number of drivers its producer can run.
 uint32_t maxDriversForConsumer(
     const std::shared_ptr<const core::PlanNode>& node) {
-  if (std::dynamic_pointer_cast<const core::MergeJoinNode>(node)) {
-    // MergeJoinNode must run single-threaded.
+  if (std::dynamic_pointer_cast<const core::MergeJoinNode>(node) ||
+      std::dynamic_pointer_cast<const core::AsofJoinNode>(node)) {
+    // MergeJoinNode and AsofJoinNode must run single-threaded.
     return 1;
   }
   return std::numeric_limits<uint32_t>::max();
@@ -224,6 +236,9 @@ uint32_t maxDrivers(
     } else if (std::dynamic_pointer_cast<const core::MergeJoinNode>(node)) {
       // Merge join must run single-threaded.
       return 1;
+    } else if (std::dynamic_pointer_cast<const core::AsofJoinNode>(node)) {
+      // ASOF join must run single-threaded.
+      return 1;
     } else if (
         auto join = std::dynamic_pointer_cast<const core::HashJoinNode>(node)) {
       // Right semi project doesn't support multi-threaded execution.
@@ -384,6 +399,21 @@ void LocalPlanner::markMixedJoinBridges(
             break;
           }
         }
+      } else if (
+          auto joinNode =
+              std::dynamic_pointer_cast<const core::RangeJoinNode>(planNode)) {
+        // See if the build source (2nd) belongs to an ungrouped execution.
+        auto& buildSourceNode = planNode->sources()[1];
+        for (auto& factoryOther : driverFactories) {
+          if (!factoryOther->groupedExecution &&
+              buildSourceNode->id() == factoryOther->outputNodeId()) {
+            factoryOther->mixedExecutionModeRangeJoinNodeIds.emplace(
+                planNode->id());
+            factory->mixedExecutionModeRangeJoinNodeIds.emplace(
+                planNode->id());
+            break;
+          }
+        }
       }
     }
   }
@@ -404,6 +434,29 @@ bool eagerFlush(const core::PlanNode& node) {
   return eagerFlush(*node.sources()[0]);
 }
 
+// Returns the number of rows needed by a Limit that consumes the output of the
+// table scan at 'planNodes[scanIndex]' in the same pipeline. Only projections
+// are allowed in between since they do not drop rows. Returns std::nullopt if
+// there is no such Limit.
+std::optional<int64_t> scanLimit(
+    const std::vector<std::shared_ptr<const core::PlanNode>>& planNodes,
+    size_t scanIndex) {
+  for (auto i = scanIndex + 1; i < planNodes.size(); ++i) {
+    if (auto limit =
+            std::dynamic_pointer_cast<const core::LimitNode>(planNodes[i])) {
+      if (limit->count() >
+          std::numeric_limits<int64_t>::max() - limit->offset()) {
+        return std::nullopt;
+      }
+      return limit->offset() + limit->count();
+    }
+    if (!std::dynamic_pointer_cast<const core::ProjectNode>(planNodes[i])) {
+      return std::nullopt;
+    }
+  }
+  return std::nullopt;
+}
+
 } // namespace
 
 std::shared_ptr<Driver> DriverFactory::createDriver(
@@ -451,8 +504,8 @@ std::shared_ptr<Driver> DriverFactory::createDriver(
     } else if (
         auto tableScanNode =
             std::dynamic_pointer_cast<const core::TableScanNode>(planNode)) {
-      operators.push_back(
-          std::make_unique<TableScan>(id, ctx.get(), tableScanNode));
+      operators.push_back(std::make_unique<TableScan>(
+          id, ctx.get(), tableScanNode, scanLimit(planNodes, i)));
     } else if (
         auto tableWriteNode =
             std::dynamic_pointer_cast<const core::TableWriteNode>(planNode)) {
@@ -486,6 +539,20 @@ std::shared_ptr<Driver> DriverFactory::createDriver(
     } else if (
         auto joinNode =
             std::dynamic_pointer_cast<const core::HashJoinNode>(planNode)) {
+      const auto numJoins = MultiHashProbe::numFusibleJoins(
+          planNodes, i, ctx->queryConfig());
+      if (numJoins > 1) {
+        std::vector<std::shared_ptr<const core::HashJoinNode>> joinNodes;
+        for (auto j = 0; j < numJoins; ++j) {
+          joinNodes.push_back(
+              std::dynamic_pointer_cast<const core::HashJoinNode>(
+                  planNodes[i + j]));
+        }
+        operators.push_back(std::make_unique<MultiHashProbe>(
+            id, ctx.get(), std::move(joinNodes)));
+        i += numJoins - 1;
+        continue;
+      }
       operators.push_back(std::make_unique<HashProbe>(id, ctx.get(), joinNode));
     } else if (
         auto joinNode =
@@ -493,9 +560,16 @@ std::shared_ptr<Driver> DriverFactory::createDriver(
                 planNode)) {
       operators.push_back(
           std::make_unique<NestedLoopJoinProbe>(id, ctx.get(), joinNode));
+    } else if (
+        auto joinNode =
+            std::dynamic_pointer_cast<const core::RangeJoinNode>(planNode)) {
+      operators.push_back(
+          std::make_unique<RangeJoinProbe>(id, ctx.get(), joinNode));
     } else if (
         auto aggregationNode =
             std::dynamic_pointer_cast<const core::AggregationNode>(planNode)) {
+      // An aggregation with incremental grouping sets that is not fused with
+      // its GroupIdNode source aggregates the replicated input rows.
       if (aggregationNode->isPreGrouped()) {
         operators.push_back(std::make_unique<StreamingAggregation>(
             id, ctx.get(), aggregationNode));
@@ -510,6 +584,20 @@ std::shared_ptr<Driver> DriverFactory::createDriver(
     } else if (
         auto groupIdNode =
             std::dynamic_pointer_cast<const core::GroupIdNode>(planNode)) {
+      if (i < planNodes.size() - 1) {
+        auto aggregationNode =
+            std::dynamic_pointer_cast<const core::AggregationNode>(
+                planNodes[i + 1]);
+        // The finest grouping set is not spillable. An aggregation that can
+        // spill runs over the replicated rows of a GroupId operator instead.
+        if (aggregationNode && aggregationNode->incrementalGroupingSets() &&
+            !aggregationNode->canSpill(ctx->queryConfig())) {
+          operators.push_back(std::make_unique<HashAggregation>(
+              id, ctx.get(), aggregationNode, groupIdNode));
+          i++;
+          continue;
+        }
+      }
       operators.push_back(
           std::make_unique<GroupId>(id, ctx.get(), groupIdNode));
     } else if (
@@ -557,6 +645,12 @@ std::shared_ptr<Driver> DriverFactory::createDriver(
       auto mergeJoinOp = std::make_unique<MergeJoin>(id, ctx.get(), mergeJoin);
       ctx->task->createMergeJoinSource(ctx->splitGroupId, mergeJoin->id());
       operators.push_back(std::move(mergeJoinOp));
+    } else if (
+        auto asofJoin =
+            std::dynamic_pointer_cast<const core::AsofJoinNode>(planNode)) {
+      auto asofJoinOp = std::make_unique<AsofJoin>(id, ctx.get(), asofJoin);
+      ctx->task->createMergeJoinSource(ctx->splitGroupId, asofJoin->id());
+      operators.push_back(std::move(asofJoinOp));
     } else if (
         auto localPartitionNode =
             std::dynamic_pointer_cast<const core::LocalPartitionNode>(
@@ -696,6 +790,28 @@ std::vector<core::PlanNodeId> DriverFactory::needsNestedLoopJoinBridges()
   return planNodeIds;
 }
 
+std::vector<core::PlanNodeId> DriverFactory::needsRangeJoinBridges() const {
+  std::vector<core::PlanNodeId> planNodeIds;
+  // Ungrouped execution pipelines need to take care of cross-mode bridges.
+  if (!groupedExecution && !mixedExecutionModeRangeJoinNodeIds.empty()) {
+    planNodeIds.insert(
+        planNodeIds.end(),
+        mixedExecutionModeRangeJoinNodeIds.begin(),
+        mixedExecutionModeRangeJoinNodeIds.end());
+  }
+  for (const auto& planNode : planNodes) {
+    if (auto joinNode =
+            std::dynamic_pointer_cast<const core::RangeJoinNode>(planNode)) {
+      // Grouped execution pipelines should not create cross-mode bridges.
+      if (!groupedExecution ||
+          !mixedExecutionModeRangeJoinNodeIds.contains(joinNode->id())) {
+        planNodeIds.emplace_back(joinNode->id());
+      }
+    }
+  }
+  return planNodeIds;
+}
+
 // static
 void DriverFactory::registerAdapter(DriverAdapter adapter) {
   adapters.push_back(std::move(adapter));
@@ -0,0 +1,401 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/MultiHashProbe.h"
+#include "velox/exec/OperatorUtils.h"
+#include "velox/exec/Task.h"
+
+namespace facebook::velox::exec {
+
+namespace {
+std::shared_ptr<const core::HashJoinNode> asFusibleJoin(
+    const core::PlanNodePtr& planNode,
+    const core::QueryConfig& queryConfig) {
+  auto join = std::dynamic_pointer_cast<const core::HashJoinNode>(planNode);
+  if (join == nullptr || !join->isInnerJoin() || join->filter() != nullptr ||
+      join->isNullAware() || join->canSpill(queryConfig)) {
+    return nullptr;
+  }
+  return join;
+}
+} // namespace
+
+MultiHashProbe::MultiHashProbe(
+    int32_t operatorId,
+    DriverCtx* driverCtx,
+    std::vector<std::shared_ptr<const core::HashJoinNode>> joinNodes)
+    : Operator(
+          driverCtx,
+          joinNodes.back()->outputType(),
+          operatorId,
+          joinNodes.back()->id(),
+          "MultiHashProbe"),
+      outputBatchSize_{outputBatchRows()},
+      probeType_(joinNodes.front()->sources()[0]->outputType()) {
+  VELOX_CHECK_GE(joinNodes.size(), 2);
+  joins_.resize(joinNodes.size());
+  for (auto i = 0; i < joinNodes.size(); ++i) {
+    auto& join = joins_[i];
+    join.joinNode = std::move(joinNodes[i]);
+    join.bridge = operatorCtx_->task()->getHashJoinBridgeLocked(
+        operatorCtx_->driverCtx()->splitGroupId, join.joinNode->id());
+    VELOX_CHECK_NOT_NULL(join.bridge);
+  }
+  matchIndices_.resize(joins_.size(), 0);
+  outputBuildRows_.resize(joins_.size());
+
+  auto lockedStats = stats_.wlock();
+  for (auto i = 0; i < joins_.size() - 1; ++i) {
+    lockedStats->fusedPlanNodeStats.emplace_back(
+        operatorId,
+        driverCtx->pipelineId,
+        joins_[i].joinNode->id(),
+        operatorType());
+  }
+}
+
+// static
+size_t MultiHashProbe::numFusibleJoins(
+    const std::vector<core::PlanNodePtr>& planNodes,
+    size_t start,
+    const core::QueryConfig& queryConfig) {
+  if (!queryConfig.multiHashJoinEnabled()) {
+    return 0;
+  }
+  const auto first = asFusibleJoin(planNodes[start], queryConfig);
+  if (first == nullptr) {
+    return 0;
+  }
+
+  const auto& probeType = first->sources()[0]->outputType();
+  std::vector<RowTypePtr> buildTypes{first->sources()[1]->outputType()};
+  for (auto i = start + 1; i < planNodes.size(); ++i) {
+    const auto join = asFusibleJoin(planNodes[i], queryConfig);
+    if (join == nullptr || join->sources()[0] != planNodes[i - 1]) {
+      break;
+    }
+
+    // All probe keys must come from the input of the first join. Keys that
+    // are build side columns of a previous join cannot be probed before that
+    // join produces its output.
+    bool keysFromInput = true;
+    for (const auto& key : join->leftKeys()) {
+      if (!probeType->containsChild(key->name())) {
+        keysFromInput = false;
+        break;
+      }
+      for (const auto& buildType : buildTypes) {
+        if (buildType->containsChild(key->name())) {
+          keysFromInput = false;
+          break;
+        }
+      }
+    }
+    if (!keysFromInput) {
+      break;
+    }
+    buildTypes.push_back(join->sources()[1]->outputType());
+  }
+  return buildTypes.size();
+}
+
+void MultiHashProbe::initialize() {
+  Operator::initialize();
+
+  std::vector<RowTypePtr> tableTypes;
+  tableTypes.reserve(joins_.size());
+  for (auto& join : joins_) {
+    VELOX_CHECK(join.hashers.empty());
+    join.hashers = createVectorHashers(probeType_, join.joinNode->leftKeys());
+    join.lookup = std::make_unique<HashLookup>(join.hashers);
+    tableTypes.push_back(hashJoinTableType(
+        join.joinNode->sources()[1]->outputType().get(),
+        join.joinNode->rightKeys()));
+  }
+
+  // An output column comes from the build side of the last join whose build
+  // side has a column of that name. Otherwise, it comes from the input.
+  for (column_index_t i = 0; i < outputType_->size(); ++i) {
+    const auto& name = outputType_->nameOf(i);
+    bool fromBuild = false;
+    for (auto j = joins_.size(); j-- > 0;) {
+      const auto& buildType = joins_[j].joinNode->sources()[1]->outputType();
+      if (buildType->containsChild(name)) {
+        joins_[j].outputProjections.emplace_back(
+            tableTypes[j]->getChildIdx(name), i);
+        fromBuild = true;
+        break;
+      }
+    }
+    if (!fromBuild) {
+      identityProjections_.emplace_back(probeType_->getChildIdx(name), i);
+    }
+  }
+}
+
+BlockingReason MultiHashProbe::isBlocked(ContinueFuture* future) {
+  for (auto& join : joins_) {
+    if (join.table != nullptr) {
+      continue;
+    }
+
+    auto hashBuildResult = join.bridge->tableOrFuture(future);
+    if (!hashBuildResult.has_value()) {
+      VELOX_CHECK(future->valid());
+      return BlockingReason::kWaitForJoinBuild;
+    }
+    // Fused joins are never null-aware and never spill.
+    VELOX_CHECK(!hashBuildResult->hasNullKeys);
+    VELOX_CHECK(!hashBuildResult->restoredPartitionId.has_value());
+    VELOX_CHECK(hashBuildResult->spillPartitionIds.empty());
+
+    join.table = std::move(hashBuildResult->table);
+    VELOX_CHECK_NOT_NULL(join.table);
+    if (join.table->numDistinct() == 0) {
+      // Inner join with an empty build side produces no output.
+      skipInput_ = true;
+    } else {
+      maybeCreateDynamicFilters(join);
+    }
+  }
+
+  if (skipInput_ && !noMoreInput_ &&
+      operatorCtx_->driverCtx()
+          ->queryConfig()
+          .hashProbeFinishEarlyOnEmptyBuild()) {
+    input_ = nullptr;
+    noMoreInput();
+  }
+  return BlockingReason::kNotBlocked;
+}
+
+void MultiHashProbe::maybeCreateDynamicFilters(const Join& join) {
+  if (join.table->hashMode() == BaseHashTable::HashMode::kHash) {
+    return;
+  }
+
+  std::vector<column_index_t> keyChannels;
+  keyChannels.reserve(join.hashers.size());
+  for (const auto& hasher : join.hashers) {
+    keyChannels.push_back(hasher->channel());
+  }
+  const auto channels =
+      operatorCtx_->driverCtx()->driver->canPushdownFilters(this, keyChannels);
+
+  const auto& buildHashers = join.table->hashers();
+  for (auto i = 0; i < keyChannels.size(); ++i) {
+    // Keep the first filter if several joins probe with the same column.
+    if (channels.find(keyChannels[i]) == channels.end() ||
+        dynamicFilters_.count(keyChannels[i]) > 0) {
+      continue;
+    }
+    if (auto filter = buildHashers[i]->getFilter(false)) {
+      dynamicFilters_.emplace(keyChannels[i], std::move(filter));
+    }
+  }
+}
+
+void MultiHashProbe::addInput(RowVectorPtr input) {
+  if (skipInput_) {
+    return;
+  }
+
+  input_ = std::move(input);
+
+  const auto numInput = input_->size();
+  activeRows_.resize(numInput);
+  activeRows_.setAll();
+  numCombinations_.assign(numInput, 1);
+
+  std::vector<uint64_t> numJoinInputRows(joins_.size(), 0);
+  std::vector<uint64_t> numJoinOutputRows(joins_.size(), 0);
+  uint64_t numRows = numInput;
+  for (auto i = 0; i < joins_.size() && activeRows_.hasSelections(); ++i) {
+    numJoinInputRows[i] = numRows;
+    numRows = probe(i);
+    numJoinOutputRows[i] = numRows;
+  }
+  updateJoinStats(numJoinInputRows, numJoinOutputRows);
+
+  if (!activeRows_.hasSelections()) {
+    input_ = nullptr;
+    return;
+  }
+
+  probeRows_.clear();
+  activeRows_.applyToSelected([&](auto row) { probeRows_.push_back(row); });
+  nextProbeRow_ = 0;
+  std::fill(matchIndices_.begin(), matchIndices_.end(), 0);
+
+  // Load only the input rows that have a match in all the joins.
+  for (const auto& projection : identityProjections_) {
+    LazyVector::ensureLoadedRows(
+        input_->childAt(projection.inputChannel), activeRows_);
+  }
+}
+
+uint64_t MultiHashProbe::probe(size_t joinIndex) {
+  auto& join = joins_[joinIndex];
+  auto& lookup = *join.lookup;
+
+  // Decodes the keys of 'activeRows_' and removes rows with null keys or keys
+  // which cannot match.
+  join.table->prepareForJoinProbe(lookup, input_, activeRows_, true);
+
+  auto& hits = lookup.hits;
+  hits.resize(input_->size());
+  std::fill(hits.data(), hits.data() + hits.size(), nullptr);
+  if (!lookup.rows.empty()) {
+    join.table->joinProbe(lookup);
+  }
+
+  // 'lookup.rows' are the rows of 'activeRows_' that may have a match.
+  activeRows_.clearAll();
+  uint64_t numOutputRows = 0;
+  for (auto row : lookup.rows) {
+    if (hits[row] == nullptr) {
+      continue;
+    }
+    activeRows_.setValid(row, true);
+    numCombinations_[row] *= matches(joinIndex, row).size();
+    numOutputRows += numCombinations_[row];
+  }
+  activeRows_.updateBounds();
+  return numOutputRows;
+}
+
+folly::Range<char**> MultiHashProbe::matches(
+    size_t joinIndex,
+    vector_size_t row) {
+  auto& join = joins_[joinIndex];
+  auto& hit = join.lookup->hits[row];
+  if (join.table->hasDuplicateKeys()) {
+    if (auto* duplicates = join.table->rows()->getNextRowVector(hit)) {
+      return folly::Range<char**>(duplicates->data(), duplicates->size());
+    }
+  }
+  return folly::Range<char**>(&hit, 1);
+}
+
+void MultiHashProbe::updateJoinStats(
+    const std::vector<uint64_t>& numInputRows,
+    const std::vector<uint64_t>& numOutputRows) {
+  auto lockedStats = stats_.wlock();
+  auto& joinStats = lockedStats->fusedPlanNodeStats;
+  for (auto i = 0; i < joinStats.size(); ++i) {
+    joinStats[i].inputPositions += numInputRows[i];
+    joinStats[i].outputPositions += numOutputRows[i];
+  }
+}
+
+RowVectorPtr MultiHashProbe::getOutput() {
+  if (input_ == nullptr) {
+    return nullptr;
+  }
+
+  outputProbeRows_.resize(outputBatchSize_);
+  for (auto& buildRows : outputBuildRows_) {
+    buildRows.resize(outputBatchSize_);
+  }
+
+  // Lists the combinations of matches of the probe rows until the batch is
+  // full. 'nextProbeRow_' and 'matchIndices_' tell where to continue.
+  const int32_t numJoins = joins_.size();
+  vector_size_t size = 0;
+  while (size < outputBatchSize_ && nextProbeRow_ < probeRows_.size()) {
+    const auto row = probeRows_[nextProbeRow_];
+    outputProbeRows_[size] = row;
+    for (auto j = 0; j < numJoins; ++j) {
+      outputBuildRows_[j][size] = matches(j, row)[matchIndices_[j]];
+    }
+    ++size;
+
+    auto j = numJoins - 1;
+    for (; j >= 0; --j) {
+      if (++matchIndices_[j] < matches(j, row).size()) {
+        break;
+      }
+      matchIndices_[j] = 0;
+    }
+    if (j < 0) {
+      ++nextProbeRow_;
+    }
+  }
+
+  auto mapping = allocateIndices(size, pool());
+  std::copy(
+      outputProbeRows_.begin(),
+      outputProbeRows_.begin() + size,
+      mapping->asMutable<vector_size_t>());
+
+  std::vector<VectorPtr> children(outputType_->size());
+  for (const auto& projection : identityProjections_) {
+    children[projection.outputChannel] =
+        wrapChild(size, mapping, input_->childAt(projection.inputChannel));
+  }
+  for (auto j = 0; j < numJoins; ++j) {
+    const auto& join = joins_[j];
+    for (const auto& projection : join.outputProjections) {
+      auto& child = children[projection.outputChannel];
+      child = BaseVector::create(
+          outputType_->childAt(projection.outputChannel), size, pool());
+      join.table->rows()->extractColumn(
+          outputBuildRows_[j].data(), size, projection.inputChannel, child);
+    }
+  }
+
+  if (nextProbeRow_ == probeRows_.size()) {
+    input_ = nullptr;
+  }
+
+  return std::make_shared<RowVector>(
+      pool(), outputType_, nullptr, size, std::move(children));
+}
+
+void MultiHashProbe::noMoreInput() {
+  Operator::noMoreInput();
+
+  std::vector<ContinuePromise> promises;
+  std::vector<std::shared_ptr<Driver>> peers;
+  // The last operator to finish tells the join bridges that probing is done.
+  if (operatorCtx_->task()->allPeersFinished(
+          planNodeId(), operatorCtx_->driver(), nullptr, promises, peers)) {
+    lastProber_ = true;
+  }
+}
+
+void MultiHashProbe::close() {
+  if (lastProber_) {
+    // Lets the build sides of the joins release their tables.
+    for (auto& join : joins_) {
+      if (join.table != nullptr) {
+        join.bridge->probeFinished();
+      }
+    }
+  }
+  Operator::close();
+
+  // Free up major memory usage.
+  for (auto& join : joins_) {
+    join.lookup.reset();
+    join.table.reset();
+    join.bridge.reset();
+  }
+  numCombinations_.clear();
+  probeRows_.clear();
+  outputProbeRows_.clear();
+  outputBuildRows_.clear();
+}
+} // namespace facebook::velox::exec
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/exec/HashJoinBridge.h"
+#include "velox/exec/HashTable.h"
+#include "velox/exec/Operator.h"
+#include "velox/exec/VectorHasher.h"
+
+namespace facebook::velox::exec {
+
+/// Probes the hash tables of a chain of inner hash joins in one pass per input
+/// batch. The joins are consecutive nodes of one pipeline, the first join
+/// probes the pipeline input and each following join probes the output of
+/// the previous one. All probe keys must come from the input of the first
+/// join, e.g. a fact table joined with several dimension tables.
+///
+/// Each hash table is built by the HashBuild operators of its join node and
+/// handed over by the join's HashJoinBridge. The joins are probed one after the
+/// other on the input rows that matched all the previous joins. The
+/// combinations of matching build rows are then listed at most
+/// 'outputBatchSize_' at a time. Only the columns of the last join's output
+/// are materialized.
+///
+/// The operator reports its stats under the id of the last join. The input and
+/// output rows of the other joins are reported in
+/// OperatorStats::fusedPlanNodeStats under their own ids.
+class MultiHashProbe : public Operator {
+ public:
+  /// 'joinNodes' are ordered from the join closest to the pipeline input to
+  /// the join producing the output.
+  MultiHashProbe(
+      int32_t operatorId,
+      DriverCtx* driverCtx,
+      std::vector<std::shared_ptr<const core::HashJoinNode>> joinNodes);
+
+  /// Returns the number of consecutive hash joins starting at
+  /// 'planNodes[start]' that can be executed by one MultiHashProbe. Returns 0
+  /// if 'planNodes[start]' is not a hash join that can be fused or if
+  /// 'multi_hash_join_enabled' is false. Fusion applies to two joins or more.
+  static size_t numFusibleJoins(
+      const std::vector<core::PlanNodePtr>& planNodes,
+      size_t start,
+      const core::QueryConfig& queryConfig);
+
+  void initialize() override;
+
+  bool needsInput() const override {
+    return !noMoreInput_ && input_ == nullptr;
+  }
+
+  void addInput(RowVectorPtr input) override;
+
+  RowVectorPtr getOutput() override;
+
+  BlockingReason isBlocked(ContinueFuture* future) override;
+
+  void noMoreInput() override;
+
+  bool isFinished() override {
+    return noMoreInput_ && input_ == nullptr;
+  }
+
+  void close() override;
+
+ private:
+  // State of one of the fused joins.
+  struct Join {
+    std::shared_ptr<const core::HashJoinNode> joinNode;
+
+    std::shared_ptr<HashJoinBridge> bridge;
+
+    // Hashers for the probe keys. Channels refer to the operator input.
+    std::vector<std::unique_ptr<VectorHasher>> hashers;
+
+    std::unique_ptr<HashLookup> lookup;
+
+    // Set once the table is built.
+    std::shared_ptr<BaseHashTable> table;
+
+    // Maps hash table columns to output channels.
+    std::vector<IdentityProjection> outputProjections;
+  };
+
+  // Probes 'joins_[joinIndex]' with the rows of 'activeRows_' and removes
+  // the rows without a match from 'activeRows_'. Returns the number of
+  // output rows of the join.
+  uint64_t probe(size_t joinIndex);
+
+  // Returns the build rows of 'joins_[joinIndex]' that match input 'row'.
+  folly::Range<char**> matches(size_t joinIndex, vector_size_t row);
+
+  // Adds the input and output rows of the joins other than the last to
+  // the operator stats.
+  void updateJoinStats(
+      const std::vector<uint64_t>& numInputRows,
+      const std::vector<uint64_t>& numOutputRows);
+
+  // Creates dynamic filters on the join keys of 'join' for upstream operators
+  // which can accept them.
+  void maybeCreateDynamicFilters(const Join& join);
+
+  const vector_size_t outputBatchSize_;
+
+  const RowTypePtr probeType_;
+
+  std::vector<Join> joins_;
+
+  // Set if one of the build sides is empty. The join produces no output.
+  bool skipInput_{false};
+
+  // Set if this is the last of the peer operators to finish probing. Tells
+  // the join bridges that probing is done.
+  bool lastProber_{false};
+
+  SelectivityVector activeRows_;
+
+  // Number of combinations of matching build rows for each input row over the
+  // joins probed so far.
+  std::vector<uint64_t> numCombinations_;
+
+  // Input rows that match all the joins.
+  std::vector<vector_size_t> probeRows_;
+
+  // Index into 'probeRows_' of the input row of the next output row.
+  vector_size_t nextProbeRow_{0};
+
+  // Index of the next output row's build row in the matches of each join. The
+  // last join advances first.
+  std::vector<vector_size_t> matchIndices_;
+
+  // Probe row and one build row per join for each row of the output batch.
+  // Sized to 'outputBatchSize_'.
+  std::vector<vector_size_t> outputProbeRows_;
+  std::vector<std::vector<char*>> outputBuildRows_;
+};
+} // namespace facebook::velox::exec
@@ -45,13 +45,19 @@ NestedLoopJoinBuild::NestedLoopJoinBuild(
     int32_t operatorId,
     DriverCtx* driverCtx,
     std::shared_ptr<const core::NestedLoopJoinNode> joinNode)
-    : Operator(
-          driverCtx,
-          nullptr,
+    : NestedLoopJoinBuild(
           operatorId,
+          driverCtx,
           joinNode->id(),
           "NestedLoopJoinBuild") {}
 
+NestedLoopJoinBuild::NestedLoopJoinBuild(
+    int32_t operatorId,
+    DriverCtx* driverCtx,
+    const core::PlanNodeId& planNodeId,
+    const std::string& operatorType)
+    : Operator(driverCtx, nullptr, operatorId, planNodeId, operatorType) {}
+
 void NestedLoopJoinBuild::addInput(RowVectorPtr input) {
   if (input->size() > 0) {
     // Load lazy vectors before storing.
@@ -105,10 +111,14 @@ void NestedLoopJoinBuild::noMoreInput() {
     }
   }
 
+  setBridgeData(std::move(dataVectors_));
+}
+
+void NestedLoopJoinBuild::setBridgeData(std::vector<RowVectorPtr> dataVectors) {
   operatorCtx_->task()
       ->getNestedLoopJoinBridge(
           operatorCtx_->driverCtx()->splitGroupId, planNodeId())
-      ->setData(std::move(dataVectors_));
+      ->setData(std::move(dataVectors));
 }
 
 bool NestedLoopJoinBuild::isFinished() {
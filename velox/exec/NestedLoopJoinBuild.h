@@ -58,6 +58,19 @@ class NestedLoopJoinBuild : public Operator {
     Operator::close();
   }
 
+ protected:
+  // Used by operators that gather the build side the same way, e.g.
+  // RangeJoinBuild.
+  NestedLoopJoinBuild(
+      int32_t operatorId,
+      DriverCtx* driverCtx,
+      const core::PlanNodeId& planNodeId,
+      const std::string& operatorType);
+
+  // Hands over the build vectors gathered from all build Drivers to the probe
+  // side. Called once by the last build Driver to finish.
+  virtual void setBridgeData(std::vector<RowVectorPtr> dataVectors);
+
  private:
   std::vector<RowVectorPtr> dataVectors_;
 
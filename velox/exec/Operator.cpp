@@ -508,6 +508,14 @@ void OperatorStats::add(const OperatorStats& other) {
   numNullKeys += other.numNullKeys;
 
   dynamicFilterStats.add(other.dynamicFilterStats);
+
+  for (auto i = 0; i < other.fusedPlanNodeStats.size(); ++i) {
+    if (i < fusedPlanNodeStats.size()) {
+      fusedPlanNodeStats[i].add(other.fusedPlanNodeStats[i]);
+    } else {
+      fusedPlanNodeStats.push_back(other.fusedPlanNodeStats[i]);
+    }
+  }
 }
 
 void OperatorStats::clear() {
@@ -543,6 +551,10 @@ void OperatorStats::clear() {
   spilledFiles = 0;
 
   dynamicFilterStats.clear();
+
+  for (auto& fusedStats : fusedPlanNodeStats) {
+    fusedStats.clear();
+  }
 }
 
 std::unique_ptr<memory::MemoryReclaimer> Operator::MemoryReclaimer::create(
@@ -184,6 +184,11 @@ struct OperatorStats {
 
   int numDrivers = 0;
 
+  /// Stats of the plan nodes other than 'planNodeId' that the operator
+  /// executes, e.g. the earlier joins fused into a MultiHashProbe. These are
+  /// reported under their own plan node ids.
+  std::vector<OperatorStats> fusedPlanNodeStats;
+
   OperatorStats() = default;
 
   OperatorStats(
@@ -128,14 +128,9 @@ std::unordered_map<core::PlanNodeId, PlanNodeStats> toPlanStats(
 
   for (const auto& pipelineStats : taskStats.pipelineStats) {
     for (const auto& opStats : pipelineStats.operatorStats) {
-      const auto& planNodeId = opStats.planNodeId;
-      auto it = planStats.find(planNodeId);
-      if (it != planStats.end()) {
-        it->second.add(opStats);
-      } else {
-        PlanNodeStats nodeStats;
-        nodeStats.add(opStats);
-        planStats.emplace(planNodeId, std::move(nodeStats));
+      planStats[opStats.planNodeId].add(opStats);
+      for (const auto& fusedStats : opStats.fusedPlanNodeStats) {
+        planStats[fusedStats.planNodeId].add(fusedStats);
       }
     }
   }
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/RangeJoinBuild.h"
+#include "velox/exec/Task.h"
+
+namespace facebook::velox::exec {
+
+void RangeJoinBridge::setBuildSide(RangeJoinBuildSide buildSide) {
+  std::vector<ContinuePromise> promises;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    VELOX_CHECK(
+        !buildSide_.has_value(), "setBuildSide must be called only once");
+    buildSide_ = std::move(buildSide);
+    promises = std::move(promises_);
+  }
+  notify(std::move(promises));
+}
+
+std::optional<RangeJoinBuildSide> RangeJoinBridge::buildSideOrFuture(
+    ContinueFuture* future) {
+  std::lock_guard<std::mutex> l(mutex_);
+  VELOX_CHECK(!cancelled_, "Getting data after the build side is aborted");
+  if (buildSide_.has_value()) {
+    return buildSide_;
+  }
+  promises_.emplace_back("RangeJoinBridge::buildSideOrFuture");
+  *future = promises_.back().getSemiFuture();
+  return std::nullopt;
+}
+
+RangeJoinBuild::RangeJoinBuild(
+    int32_t operatorId,
+    DriverCtx* driverCtx,
+    const std::shared_ptr<const core::RangeJoinNode>& joinNode)
+    : NestedLoopJoinBuild(
+          operatorId,
+          driverCtx,
+          joinNode->id(),
+          "RangeJoinBuild"),
+      buildType_(joinNode->sources()[1]->outputType()) {
+  for (const auto& condition : joinNode->conditions()) {
+    comparisons_.push_back(condition.comparison);
+    buildKeyChannels_.push_back(
+        buildType_->getChildIdx(condition.right->name()));
+  }
+}
+
+void RangeJoinBuild::setBridgeData(std::vector<RowVectorPtr> dataVectors) {
+  // The index refers to rows by their position, so the build side must be a
+  // single vector.
+  RowVectorPtr data;
+  if (dataVectors.size() == 1) {
+    data = std::move(dataVectors.front());
+  } else {
+    vector_size_t numRows = 0;
+    for (const auto& vector : dataVectors) {
+      numRows += vector->size();
+    }
+    data = BaseVector::create<RowVector>(buildType_, numRows, pool());
+    vector_size_t offset = 0;
+    for (const auto& vector : dataVectors) {
+      data->copy(vector.get(), offset, 0, vector->size());
+      offset += vector->size();
+    }
+    dataVectors.clear();
+  }
+
+  std::vector<VectorPtr> buildKeys;
+  buildKeys.reserve(buildKeyChannels_.size());
+  for (auto channel : buildKeyChannels_) {
+    buildKeys.push_back(data->childAt(channel));
+  }
+  std::shared_ptr<const RangeJoinIndex> index =
+      RangeJoinIndex::create(comparisons_, buildKeys);
+
+  operatorCtx_->task()
+      ->getRangeJoinBridge(
+          operatorCtx_->driverCtx()->splitGroupId, planNodeId())
+      ->setBuildSide({std::move(data), std::move(index)});
+}
+
+} // namespace facebook::velox::exec
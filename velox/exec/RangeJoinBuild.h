@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/exec/NestedLoopJoinBuild.h"
+#include "velox/exec/RangeJoinIndex.h"
+
+namespace facebook::velox::exec {
+
+/// Build side of a range join shared by all probe operators: the build rows
+/// combined into a single vector and the index over them.
+struct RangeJoinBuildSide {
+  RowVectorPtr data;
+  std::shared_ptr<const RangeJoinIndex> index;
+};
+
+/// Hands over the build side of a range join to the probe side.
+class RangeJoinBridge : public JoinBridge {
+ public:
+  void setBuildSide(RangeJoinBuildSide buildSide);
+
+  /// Returns the build side if it is ready. Otherwise, returns std::nullopt
+  /// and sets 'future' to wait for it.
+  std::optional<RangeJoinBuildSide> buildSideOrFuture(ContinueFuture* future);
+
+ private:
+  std::optional<RangeJoinBuildSide> buildSide_;
+};
+
+/// Gathers the build side of a range join the same way as NestedLoopJoinBuild.
+/// The last build Driver to finish combines the build vectors, builds the
+/// RangeJoinIndex over them and hands both over to the probe side through a
+/// RangeJoinBridge. All RangeJoinProbe operators share the same index.
+class RangeJoinBuild : public NestedLoopJoinBuild {
+ public:
+  RangeJoinBuild(
+      int32_t operatorId,
+      DriverCtx* driverCtx,
+      const std::shared_ptr<const core::RangeJoinNode>& joinNode);
+
+ protected:
+  void setBridgeData(std::vector<RowVectorPtr> dataVectors) override;
+
+ private:
+  const RowTypePtr buildType_;
+
+  // Comparisons of the range conditions and the channels of their keys in the
+  // build input.
+  std::vector<RangeJoinIndex::Comparison> comparisons_;
+  std::vector<column_index_t> buildKeyChannels_;
+};
+
+} // namespace facebook::velox::exec
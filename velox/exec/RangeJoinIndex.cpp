@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/RangeJoinIndex.h"
+#include "velox/type/FloatingPointUtil.h"
+
+namespace facebook::velox::exec {
+
+namespace {
+using Comparison = RangeJoinIndex::Comparison;
+
+// Orders NaN after all other floating point values, consistent with the
+// comparison functions.
+template <typename T>
+bool lessThan(const T& left, const T& right) {
+  if constexpr (std::is_floating_point_v<T>) {
+    return util::floating_point::NaNAwareLessThan<T>{}(left, right);
+  } else {
+    return left < right;
+  }
+}
+
+// Returns true if 'probe' 'comparison' 'build' holds.
+template <typename T>
+bool matches(Comparison comparison, const T& probe, const T& build) {
+  switch (comparison) {
+    case Comparison::kLessThan:
+      return lessThan(probe, build);
+    case Comparison::kLessThanOrEqual:
+      return !lessThan(build, probe);
+    case Comparison::kGreaterThan:
+      return lessThan(build, probe);
+    case Comparison::kGreaterThanOrEqual:
+      return !lessThan(probe, build);
+  }
+  VELOX_UNREACHABLE();
+}
+
+template <typename T>
+class RangeJoinIndexImpl : public RangeJoinIndex {
+ public:
+  RangeJoinIndexImpl(
+      const std::vector<Comparison>& comparisons,
+      const std::vector<VectorPtr>& buildKeys)
+      : comparisons_(comparisons) {
+    const auto numRows = buildKeys[0]->size();
+    SelectivityVector allRows(numRows);
+    std::vector<DecodedVector> decodedKeys(buildKeys.size());
+    for (auto i = 0; i < buildKeys.size(); ++i) {
+      decodedKeys[i].decode(*buildKeys[i], allRows);
+    }
+
+    // Rows with a null key never match.
+    rows_.reserve(numRows);
+    for (auto row = 0; row < numRows; ++row) {
+      if (std::none_of(
+              decodedKeys.begin(), decodedKeys.end(), [&](const auto& key) {
+                return key.isNullAt(row);
+              })) {
+        rows_.push_back(row);
+      }
+    }
+
+    const auto& firstKey = decodedKeys[0];
+    std::sort(rows_.begin(), rows_.end(), [&](auto left, auto right) {
+      return lessThan(
+          firstKey.template valueAt<T>(left),
+          firstKey.template valueAt<T>(right));
+    });
+    keys_.reserve(rows_.size());
+    for (auto row : rows_) {
+      keys_.push_back(firstKey.template valueAt<T>(row));
+    }
+
+    if (comparisons_.size() == 2) {
+      initializeTree(decodedKeys[1]);
+    }
+  }
+
+  vector_size_t size() const override {
+    return rows_.size();
+  }
+
+  std::unique_ptr<Iterator> makeIterator() const override {
+    return std::make_unique<IteratorImpl>(*this);
+  }
+
+ private:
+  // A node of the segment tree covering sorted rows [begin, end).
+  struct TreeNode {
+    vector_size_t index;
+    vector_size_t begin;
+    vector_size_t end;
+  };
+
+  class IteratorImpl : public Iterator {
+   public:
+    explicit IteratorImpl(const RangeJoinIndexImpl& index) : index_(index) {}
+
+    void startProbe(
+        const std::vector<DecodedVector>& probeKeys,
+        vector_size_t row) override {
+      begin_ = 0;
+      end_ = 0;
+      stack_.clear();
+      for (const auto& key : probeKeys) {
+        if (key.isNullAt(row)) {
+          return;
+        }
+      }
+
+      const auto& keys = index_.keys_;
+      const auto probe = probeKeys[0].valueAt<T>(row);
+      const auto lowerBound = [&]() {
+        return std::lower_bound(keys.begin(), keys.end(), probe, lessThan<T>) -
+            keys.begin();
+      };
+      const auto upperBound = [&]() {
+        return std::upper_bound(keys.begin(), keys.end(), probe, lessThan<T>) -
+            keys.begin();
+      };
+      switch (index_.comparisons_[0]) {
+        case Comparison::kLessThan:
+          begin_ = upperBound();
+          end_ = keys.size();
+          break;
+        case Comparison::kLessThanOrEqual:
+          begin_ = lowerBound();
+          end_ = keys.size();
+          break;
+        case Comparison::kGreaterThan:
+          end_ = lowerBound();
+          break;
+        case Comparison::kGreaterThanOrEqual:
+          end_ = upperBound();
+          break;
+      }
+
+      if (index_.comparisons_.size() == 2 && begin_ < end_) {
+        secondProbe_ = probeKeys[1].valueAt<T>(row);
+        stack_.push_back({1, 0, index_.numLeaves_});
+      }
+    }
+
+    vector_size_t nextMatches(vector_size_t maxRows, vector_size_t* buildRows)
+        override {
+      const auto& rows = index_.rows_;
+      if (index_.comparisons_.size() == 1) {
+        const auto numMatches = std::min(maxRows, end_ - begin_);
+        std::copy(
+            rows.begin() + begin_,
+            rows.begin() + begin_ + numMatches,
+            buildRows);
+        begin_ += numMatches;
+        return numMatches;
+      }
+
+      vector_size_t numMatches = 0;
+      while (numMatches < maxRows && !stack_.empty()) {
+        const auto node = stack_.back();
+        stack_.pop_back();
+        if (node.end <= begin_ || node.begin >= end_ ||
+            !matches(
+                index_.comparisons_[1],
+                secondProbe_,
+                index_.tree_[node.index])) {
+          continue;
+        }
+        if (node.end - node.begin == 1) {
+          buildRows[numMatches++] = rows[node.begin];
+          continue;
+        }
+        // Push the right child first to return rows in order.
+        const auto middle = node.begin + (node.end - node.begin) / 2;
+        stack_.push_back({2 * node.index + 1, middle, node.end});
+        stack_.push_back({2 * node.index, node.begin, middle});
+      }
+      return numMatches;
+    }
+
+   private:
+    const RangeJoinIndexImpl& index_;
+
+    // Range of 'index_.rows_' matching the first condition for the current
+    // probe row.
+    vector_size_t begin_{0};
+    vector_size_t end_{0};
+
+    // Probe key of the second condition for the current probe row.
+    T secondProbe_;
+
+    // Nodes of 'index_.tree_' left to visit for the current probe row.
+    std::vector<TreeNode> stack_;
+  };
+
+  // Builds a segment tree over the keys of the second condition in the order
+  // of 'rows_'. Each node keeps the max of its subrange if the condition is
+  // probe < build or probe <= build and the min otherwise. If the max (min)
+  // does not match the probe key, no row in the subrange matches.
+  void initializeTree(const DecodedVector& secondKey) {
+    numLeaves_ = 1;
+    while (numLeaves_ < rows_.size()) {
+      numLeaves_ *= 2;
+    }
+    tree_.resize(2 * numLeaves_);
+    for (auto i = 0; i < rows_.size(); ++i) {
+      tree_[numLeaves_ + i] = secondKey.valueAt<T>(rows_[i]);
+    }
+    // Leaves past the last row are never returned. Fill them with an existing
+    // key so they don't affect the min/max of the inner nodes.
+    for (auto i = rows_.size(); i < numLeaves_ && !rows_.empty(); ++i) {
+      tree_[numLeaves_ + i] = tree_[numLeaves_];
+    }
+
+    const bool useMax = comparisons_[1] == Comparison::kLessThan ||
+        comparisons_[1] == Comparison::kLessThanOrEqual;
+    for (auto i = numLeaves_ - 1; i > 0; --i) {
+      const T left = tree_[2 * i];
+      const T right = tree_[2 * i + 1];
+      tree_[i] = useMax == lessThan(left, right) ? right : left;
+    }
+  }
+
+  const std::vector<Comparison> comparisons_;
+
+  // Build rows with non-null keys sorted on the key of the first condition.
+  std::vector<vector_size_t> rows_;
+
+  // Keys of the first condition for 'rows_'.
+  std::vector<T> keys_;
+
+  // Segment tree over the keys of the second condition. Node 1 is the root.
+  // The children of node i are 2 * i and 2 * i + 1. Leaves start at
+  // 'numLeaves_'.
+  std::vector<T> tree_;
+  vector_size_t numLeaves_{0};
+};
+
+template <TypeKind Kind>
+std::unique_ptr<RangeJoinIndex> createRangeJoinIndex(
+    const std::vector<Comparison>& comparisons,
+    const std::vector<VectorPtr>& buildKeys) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  return std::make_unique<RangeJoinIndexImpl<T>>(comparisons, buildKeys);
+}
+} // namespace
+
+// static
+std::unique_ptr<RangeJoinIndex> RangeJoinIndex::create(
+    const std::vector<Comparison>& comparisons,
+    const std::vector<VectorPtr>& buildKeys) {
+  VELOX_CHECK(comparisons.size() == 1 || comparisons.size() == 2);
+  VELOX_CHECK_EQ(comparisons.size(), buildKeys.size());
+  return VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+      createRangeJoinIndex,
+      buildKeys[0]->typeKind(),
+      comparisons,
+      buildKeys);
+}
+
+} // namespace facebook::velox::exec
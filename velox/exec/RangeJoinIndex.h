@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/core/PlanNode.h"
+#include "velox/vector/DecodedVector.h"
+
+namespace facebook::velox::exec {
+
+/// Index over the build side of a range join. Finds the build rows that match
+/// one or two range conditions for a probe row without comparing the probe row
+/// with every build row.
+///
+/// Build rows with non-null keys are sorted on the key of the first condition.
+/// The build rows matching the first condition form a contiguous range of the
+/// sorted rows, which is found with a binary search. If there is a second
+/// condition, the rows in this range that match it are found by descending a
+/// segment tree that keeps the min (or max) of the second key for each
+/// subrange of the sorted rows and skipping the subranges where the min (or
+/// max) does not match.
+class RangeJoinIndex {
+ public:
+  using Comparison = core::RangeJoinNode::Comparison;
+
+  /// Looks up the build rows matching one probe row at a time. Keeps the state
+  /// of the current lookup, so each probe operator uses its own iterator while
+  /// the index itself is shared.
+  class Iterator {
+   public:
+    virtual ~Iterator() = default;
+
+    /// Starts looking up the matches for 'row' of 'probeKeys', which has one
+    /// decoded vector per range condition. A probe row with a null key has no
+    /// matches.
+    virtual void startProbe(
+        const std::vector<DecodedVector>& probeKeys,
+        vector_size_t row) = 0;
+
+    /// Writes up to 'maxRows' build rows matching the current probe row to
+    /// 'buildRows'. Returns the number of rows written. Returns 0 if all
+    /// matches have been returned. The rows are returned in the order of the
+    /// key of the first condition.
+    virtual vector_size_t nextMatches(
+        vector_size_t maxRows,
+        vector_size_t* buildRows) = 0;
+  };
+
+  virtual ~RangeJoinIndex() = default;
+
+  /// Creates an index over 'buildKeys', which has one vector per range
+  /// condition. 'comparisons' are the comparisons of the conditions where the
+  /// probe key is the left operand, e.g. probe.ts >= build.start. The values of
+  /// 'buildKeys' must stay alive while the index is used.
+  static std::unique_ptr<RangeJoinIndex> create(
+      const std::vector<Comparison>& comparisons,
+      const std::vector<VectorPtr>& buildKeys);
+
+  /// Returns the number of build rows with non-null keys.
+  virtual vector_size_t size() const = 0;
+
+  /// Returns a new iterator over this index. The index must outlive the
+  /// iterator. An index may be used by multiple iterators concurrently.
+  virtual std::unique_ptr<Iterator> makeIterator() const = 0;
+};
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/RangeJoinProbe.h"
+#include "velox/exec/OperatorUtils.h"
+#include "velox/exec/Task.h"
+#include "velox/expression/FieldReference.h"
+
+namespace facebook::velox::exec {
+
+namespace {
+std::vector<IdentityProjection> extractProjections(
+    const RowTypePtr& srcType,
+    const RowTypePtr& destType) {
+  std::vector<IdentityProjection> projections;
+  for (auto i = 0; i < srcType->size(); ++i) {
+    auto name = srcType->nameOf(i);
+    auto outIndex = destType->getChildIdxIfExists(name);
+    if (outIndex.has_value()) {
+      projections.emplace_back(i, outIndex.value());
+    }
+  }
+  return projections;
+}
+} // namespace
+
+RangeJoinProbe::RangeJoinProbe(
+    int32_t operatorId,
+    DriverCtx* driverCtx,
+    const std::shared_ptr<const core::RangeJoinNode>& joinNode)
+    : Operator(
+          driverCtx,
+          joinNode->outputType(),
+          operatorId,
+          joinNode->id(),
+          "RangeJoinProbe"),
+      outputBatchSize_{outputBatchRows()},
+      joinNode_(joinNode),
+      joinType_(joinNode_->joinType()) {
+  const auto& probeType = joinNode_->sources()[0]->outputType();
+  identityProjections_ = extractProjections(probeType, outputType_);
+  buildProjections_ =
+      extractProjections(joinNode_->sources()[1]->outputType(), outputType_);
+
+  for (const auto& condition : joinNode_->conditions()) {
+    probeKeyChannels_.push_back(probeType->getChildIdx(condition.left->name()));
+  }
+  decodedProbeKeys_.resize(probeKeyChannels_.size());
+}
+
+void RangeJoinProbe::initialize() {
+  Operator::initialize();
+
+  VELOX_CHECK(joinNode_ != nullptr);
+  if (joinNode_->filter() != nullptr) {
+    initializeFilter(
+        joinNode_->filter(),
+        joinNode_->sources()[0]->outputType(),
+        joinNode_->sources()[1]->outputType());
+  }
+
+  joinNode_.reset();
+}
+
+void RangeJoinProbe::initializeFilter(
+    const core::TypedExprPtr& filter,
+    const RowTypePtr& probeType,
+    const RowTypePtr& buildType) {
+  VELOX_CHECK_NULL(joinCondition_);
+
+  std::vector<core::TypedExprPtr> filters = {filter};
+  joinCondition_ =
+      std::make_unique<ExprSet>(std::move(filters), operatorCtx_->execCtx());
+
+  column_index_t filterChannel = 0;
+  std::vector<std::string> names;
+  std::vector<TypePtr> types;
+  auto numFields = joinCondition_->expr(0)->distinctFields().size();
+  names.reserve(numFields);
+  types.reserve(numFields);
+  for (auto& field : joinCondition_->expr(0)->distinctFields()) {
+    const auto& name = field->field();
+    auto channel = probeType->getChildIdxIfExists(name);
+    if (channel.has_value()) {
+      auto channelValue = channel.value();
+      filterProbeProjections_.emplace_back(channelValue, filterChannel++);
+      names.emplace_back(probeType->nameOf(channelValue));
+      types.emplace_back(probeType->childAt(channelValue));
+      continue;
+    }
+    channel = buildType->getChildIdxIfExists(name);
+    if (channel.has_value()) {
+      auto channelValue = channel.value();
+      filterBuildProjections_.emplace_back(channelValue, filterChannel++);
+      names.emplace_back(buildType->nameOf(channelValue));
+      types.emplace_back(buildType->childAt(channelValue));
+      continue;
+    }
+    VELOX_FAIL(
+        "Join filter field {} not in probe or build input, filter: {}",
+        field->toString(),
+        filter->toString());
+  }
+
+  filterInputType_ = ROW(std::move(names), std::move(types));
+}
+
+BlockingReason RangeJoinProbe::isBlocked(ContinueFuture* future) {
+  switch (state_) {
+    case ProbeOperatorState::kRunning:
+      [[fallthrough]];
+    case ProbeOperatorState::kFinish:
+      return BlockingReason::kNotBlocked;
+    case ProbeOperatorState::kWaitForBuild:
+      if (!getBuildData(future)) {
+        return BlockingReason::kWaitForJoinBuild;
+      }
+      setState(ProbeOperatorState::kRunning);
+      return BlockingReason::kNotBlocked;
+    default:
+      VELOX_UNREACHABLE(probeOperatorStateName(state_));
+  }
+}
+
+bool RangeJoinProbe::getBuildData(ContinueFuture* future) {
+  VELOX_CHECK_NULL(index_);
+
+  auto buildSide =
+      operatorCtx_->task()
+          ->getRangeJoinBridge(
+              operatorCtx_->driverCtx()->splitGroupId, planNodeId())
+          ->buildSideOrFuture(future);
+  if (!buildSide.has_value()) {
+    return false;
+  }
+
+  buildData_ = std::move(buildSide->data);
+  index_ = std::move(buildSide->index);
+  indexIterator_ = index_->makeIterator();
+  return true;
+}
+
+void RangeJoinProbe::addInput(RowVectorPtr input) {
+  // In getOutput(), we are going to wrap input in dictionaries a few rows at a
+  // time. Since lazy vectors cannot be wrapped in different dictionaries, we
+  // are going to load them here.
+  for (auto& child : input->children()) {
+    child->loadedVector();
+  }
+  input_ = std::move(input);
+  for (auto i = 0; i < probeKeyChannels_.size(); ++i) {
+    decodedProbeKeys_[i].decode(*input_->childAt(probeKeyChannels_[i]));
+  }
+  VELOX_CHECK_EQ(probeRow_, 0);
+  if (isLeftJoin(joinType_)) {
+    probeMatched_.resizeFill(input_->size(), false);
+  }
+}
+
+RowVectorPtr RangeJoinProbe::getOutput() {
+  if (state_ != ProbeOperatorState::kRunning) {
+    return nullptr;
+  }
+  if (input_ == nullptr) {
+    if (noMoreInput_) {
+      setState(ProbeOperatorState::kFinish);
+    }
+    return nullptr;
+  }
+
+  while (input_ != nullptr) {
+    const auto numRows = nextMatches();
+    if (numRows == 0) {
+      auto output = isLeftJoin(joinType_) ? getMismatchedOutput() : nullptr;
+      finishProbeInput();
+      return output;
+    }
+
+    if (joinCondition_ != nullptr) {
+      if (auto output = applyFilter(numRows)) {
+        return output;
+      }
+      continue;
+    }
+
+    if (isLeftJoin(joinType_)) {
+      const auto* probeIndices = probeIndices_->as<vector_size_t>();
+      for (auto i = 0; i < numRows; ++i) {
+        probeMatched_.setValid(probeIndices[i], true);
+      }
+      probeMatched_.updateBounds();
+    }
+    return makeOutput(
+        numRows,
+        outputType_,
+        probeIndices_,
+        buildIndices_,
+        identityProjections_,
+        buildProjections_);
+  }
+  return nullptr;
+}
+
+vector_size_t RangeJoinProbe::nextMatches() {
+  VELOX_CHECK_NOT_NULL(input_);
+  VELOX_CHECK_NOT_NULL(indexIterator_);
+
+  auto rawProbeIndices =
+      initializeRowNumberMapping(probeIndices_, outputBatchSize_, pool());
+  auto rawBuildIndices =
+      initializeRowNumberMapping(buildIndices_, outputBatchSize_, pool());
+
+  vector_size_t numMatches = 0;
+  while (numMatches < outputBatchSize_ && probeRow_ < input_->size()) {
+    if (!probeRowStarted_) {
+      indexIterator_->startProbe(decodedProbeKeys_, probeRow_);
+      probeRowStarted_ = true;
+    }
+    const auto numRowMatches = indexIterator_->nextMatches(
+        outputBatchSize_ - numMatches, rawBuildIndices.data() + numMatches);
+    if (numRowMatches == 0) {
+      ++probeRow_;
+      probeRowStarted_ = false;
+      continue;
+    }
+    std::fill(
+        rawProbeIndices.begin() + numMatches,
+        rawProbeIndices.begin() + numMatches + numRowMatches,
+        probeRow_);
+    numMatches += numRowMatches;
+  }
+  return numMatches;
+}
+
+RowVectorPtr RangeJoinProbe::makeOutput(
+    vector_size_t numRows,
+    const RowTypePtr& outputType,
+    const BufferPtr& probeIndices,
+    const BufferPtr& buildIndices,
+    const std::vector<IdentityProjection>& probeProjections,
+    const std::vector<IdentityProjection>& buildProjections) {
+  std::vector<VectorPtr> projectedChildren(outputType->size());
+  projectChildren(
+      projectedChildren, input_, probeProjections, numRows, probeIndices);
+  projectChildren(
+      projectedChildren, buildData_, buildProjections, numRows, buildIndices);
+  return std::make_shared<RowVector>(
+      pool(), outputType, nullptr, numRows, std::move(projectedChildren));
+}
+
+RowVectorPtr RangeJoinProbe::applyFilter(vector_size_t numRows) {
+  auto filterInput = makeOutput(
+      numRows,
+      filterInputType_,
+      probeIndices_,
+      buildIndices_,
+      filterProbeProjections_,
+      filterBuildProjections_);
+
+  filterInputRows_.resizeFill(numRows, true);
+  std::vector<VectorPtr> filterResult;
+  EvalCtx evalCtx(
+      operatorCtx_->execCtx(), joinCondition_.get(), filterInput.get());
+  joinCondition_->eval(0, 1, true, filterInputRows_, evalCtx, filterResult);
+  DecodedVector decodedFilterResult;
+  decodedFilterResult.decode(*filterResult[0], filterInputRows_);
+
+  auto rawProbeOutMapping =
+      initializeRowNumberMapping(probeOutMapping_, numRows, pool());
+  auto rawBuildOutMapping =
+      initializeRowNumberMapping(buildOutMapping_, numRows, pool());
+  const auto* probeIndices = probeIndices_->as<vector_size_t>();
+  const auto* buildIndices = buildIndices_->as<vector_size_t>();
+  vector_size_t numOutputRows{0};
+  for (auto i = 0; i < numRows; ++i) {
+    if (!decodedFilterResult.isNullAt(i) &&
+        decodedFilterResult.valueAt<bool>(i)) {
+      rawProbeOutMapping[numOutputRows] = probeIndices[i];
+      rawBuildOutMapping[numOutputRows] = buildIndices[i];
+      ++numOutputRows;
+    }
+  }
+  if (isLeftJoin(joinType_)) {
+    for (auto i = 0; i < numOutputRows; ++i) {
+      probeMatched_.setValid(rawProbeOutMapping[i], true);
+    }
+    probeMatched_.updateBounds();
+  }
+
+  if (numOutputRows == 0) {
+    return nullptr;
+  }
+  return makeOutput(
+      numOutputRows,
+      outputType_,
+      probeOutMapping_,
+      buildOutMapping_,
+      identityProjections_,
+      buildProjections_);
+}
+
+RowVectorPtr RangeJoinProbe::getMismatchedOutput() {
+  if (probeMatched_.isAllSelected()) {
+    return nullptr;
+  }
+
+  auto rawMapping =
+      initializeRowNumberMapping(probeOutMapping_, input_->size(), pool());
+  vector_size_t numUnmatched{0};
+  for (auto i = 0; i < input_->size(); ++i) {
+    if (!probeMatched_.isValid(i)) {
+      rawMapping[numUnmatched++] = i;
+    }
+  }
+  if (numUnmatched == 0) {
+    return nullptr;
+  }
+
+  std::vector<VectorPtr> projectedChildren(outputType_->size());
+  projectChildren(
+      projectedChildren,
+      input_,
+      identityProjections_,
+      numUnmatched,
+      probeOutMapping_);
+  for (auto [_, outputChannel] : buildProjections_) {
+    projectedChildren[outputChannel] = BaseVector::createNullConstant(
+        outputType_->childAt(outputChannel), numUnmatched, pool());
+  }
+  return std::make_shared<RowVector>(
+      pool(), outputType_, nullptr, numUnmatched, std::move(projectedChildren));
+}
+
+void RangeJoinProbe::finishProbeInput() {
+  VELOX_CHECK_NOT_NULL(input_);
+  input_.reset();
+  probeRow_ = 0;
+  probeRowStarted_ = false;
+  if (noMoreInput_) {
+    setState(ProbeOperatorState::kFinish);
+  }
+}
+
+void RangeJoinProbe::noMoreInput() {
+  Operator::noMoreInput();
+  if (state_ == ProbeOperatorState::kRunning && input_ == nullptr) {
+    setState(ProbeOperatorState::kFinish);
+  }
+}
+
+void RangeJoinProbe::close() {
+  if (joinCondition_ != nullptr) {
+    joinCondition_->clear();
+  }
+  indexIterator_.reset();
+  index_.reset();
+  buildData_.reset();
+  Operator::close();
+}
+
+} // namespace facebook::velox::exec
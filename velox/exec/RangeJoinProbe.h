@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/exec/Operator.h"
+#include "velox/exec/ProbeOperatorState.h"
+#include "velox/exec/RangeJoinBuild.h"
+
+namespace facebook::velox::exec {
+
+/// Probe side of a range join. Waits for the build side from the
+/// RangeJoinBridge and looks up the matching build rows for each probe row in
+/// the RangeJoinIndex shared by all probe operators.
+class RangeJoinProbe : public Operator {
+ public:
+  RangeJoinProbe(
+      int32_t operatorId,
+      DriverCtx* driverCtx,
+      const std::shared_ptr<const core::RangeJoinNode>& joinNode);
+
+  void initialize() override;
+
+  void addInput(RowVectorPtr input) override;
+
+  RowVectorPtr getOutput() override;
+
+  bool needsInput() const override {
+    return state_ == ProbeOperatorState::kRunning && input_ == nullptr &&
+        !noMoreInput_;
+  }
+
+  void noMoreInput() override;
+
+  BlockingReason isBlocked(ContinueFuture* future) override;
+
+  bool isFinished() override {
+    return state_ == ProbeOperatorState::kFinish;
+  }
+
+  void close() override;
+
+ private:
+  void initializeFilter(
+      const core::TypedExprPtr& filter,
+      const RowTypePtr& probeType,
+      const RowTypePtr& buildType);
+
+  // Returns false and sets 'future' if the build side is not ready yet.
+  // Otherwise, sets 'buildData_', 'index_' and 'indexIterator_'.
+  bool getBuildData(ContinueFuture* future);
+
+  // Fills 'probeIndices_' and 'buildIndices_' with up to 'outputBatchSize_'
+  // matching pairs of rows starting from 'probeRow_'. Returns the number of
+  // pairs. Returns 0 if all rows of 'input_' have been probed.
+  vector_size_t nextMatches();
+
+  // Projects 'numRows' pairs of rows of 'input_' and 'buildData_' specified by
+  // 'probeIndices' and 'buildIndices' to a vector of 'outputType'.
+  RowVectorPtr makeOutput(
+      vector_size_t numRows,
+      const RowTypePtr& outputType,
+      const BufferPtr& probeIndices,
+      const BufferPtr& buildIndices,
+      const std::vector<IdentityProjection>& probeProjections,
+      const std::vector<IdentityProjection>& buildProjections);
+
+  // Evaluates the filter on 'numRows' pairs returned by nextMatches() and
+  // returns the pairs that passed. Returns nullptr if none passed.
+  RowVectorPtr applyFilter(vector_size_t numRows);
+
+  // Returns the rows of 'input_' without a match with nulls for the build side
+  // columns. Returns nullptr if all rows matched.
+  RowVectorPtr getMismatchedOutput();
+
+  void finishProbeInput();
+
+  void setState(ProbeOperatorState state) {
+    state_ = state;
+  }
+
+  // Maximum number of rows in the output batch.
+  const uint32_t outputBatchSize_;
+  std::shared_ptr<const core::RangeJoinNode> joinNode_;
+  const core::JoinType joinType_;
+
+  ProbeOperatorState state_{ProbeOperatorState::kWaitForBuild};
+
+  // Channels of the keys of the range conditions in the probe input.
+  std::vector<column_index_t> probeKeyChannels_;
+
+  // Join filter-related state.
+  std::unique_ptr<ExprSet> joinCondition_;
+  RowTypePtr filterInputType_;
+  SelectivityVector filterInputRows_;
+  std::vector<IdentityProjection> filterProbeProjections_;
+  std::vector<IdentityProjection> filterBuildProjections_;
+
+  // Probe side state.
+  std::vector<DecodedVector> decodedProbeKeys_;
+  // Row of 'input_' to look up next.
+  vector_size_t probeRow_{0};
+  // True if 'indexIterator_' has started returning the matches of
+  // 'probeRow_'.
+  bool probeRowStarted_{false};
+  // Rows of 'input_' with at least one match. Used for left joins only.
+  SelectivityVector probeMatched_;
+  BufferPtr probeIndices_;
+  BufferPtr probeOutMapping_;
+
+  // Build side state.
+  RowVectorPtr buildData_;
+  std::shared_ptr<const RangeJoinIndex> index_;
+  std::unique_ptr<RangeJoinIndex::Iterator> indexIterator_;
+  std::vector<IdentityProjection> buildProjections_;
+  BufferPtr buildIndices_;
+  BufferPtr buildOutMapping_;
+};
+
+} // namespace facebook::velox::exec
@@ -55,6 +55,12 @@ class SortWindowBuild : public WindowBuild {
 
   std::unique_ptr<WindowPartition> nextPartition() override;
 
+  // Partitions read back from spilled data reuse 'data_' and 'sortedRows_',
+  // so only the partitions of a build that did not spill are independent.
+  bool supportsParallelPartitions() const override {
+    return merge_ == nullptr;
+  }
+
  private:
   void ensureInputFits(const RowVectorPtr& input);
 
@@ -26,6 +26,67 @@ namespace {
 // nanosecond precision, we use this serde option to ensure the serializer
 // preserves precision.
 static const bool kDefaultUseLosslessTimestamp = true;
+
+serializer::presto::PrestoVectorSerde::PrestoOptions makeSpillSerdeOptions(
+    common::CompressionKind compressionKind,
+    const std::shared_ptr<const common::ZstdDictionary>&
+        compressionDictionary) {
+  serializer::presto::PrestoVectorSerde::PrestoOptions options = {
+      kDefaultUseLosslessTimestamp, compressionKind, true /*nullsFirst*/};
+  options.compressionDictionary = compressionDictionary;
+  return options;
+}
+
+// Spill files written in pages of at most this many bytes are compressed with
+// a zstd dictionary if compressed with zstd. Larger pages compress about as
+// well without one.
+constexpr uint64_t kMaxDictionaryCompressionPageSize = 64 << 10;
+// Max size of a trained dictionary.
+constexpr size_t kMaxCompressionDictionarySize = 8 << 10;
+// Bytes of uncompressed sample pages to train a dictionary on.
+constexpr size_t kCompressionDictionaryTrainingBytes = 256 << 10;
+// Number of rows per sample page.
+constexpr vector_size_t kDictionarySamplePageRows = 64;
+
+// Serializes the rows of 'rows' in 'indices' uncompressed into pages of up to
+// 'kDictionarySamplePageRows' rows and appends them to 'samples'.
+void appendDictionarySamples(
+    const RowVectorPtr& rows,
+    const folly::Range<IndexRange*>& indices,
+    memory::MemoryPool* pool,
+    std::vector<std::string>& samples) {
+  const auto options =
+      makeSpillSerdeOptions(common::CompressionKind_NONE, nullptr);
+  const auto rowType = asRowType(rows->type());
+  std::vector<IndexRange> pageRanges;
+  vector_size_t numPageRows{0};
+  const auto addPage = [&]() {
+    VectorStreamGroup group(pool);
+    group.createStreamTree(rowType, numPageRows, &options);
+    group.append(rows, folly::Range(pageRanges.data(), pageRanges.size()));
+    IOBufOutputStream out(*pool, nullptr, group.size());
+    group.flush(&out);
+    samples.push_back(out.getIOBuf()->moveToFbString().toStdString());
+    pageRanges.clear();
+    numPageRows = 0;
+  };
+  for (auto range : indices) {
+    while (range.size > 0) {
+      const auto size =
+          std::min(range.size, kDictionarySamplePageRows - numPageRows);
+      pageRanges.push_back(IndexRange{range.begin, size});
+      range.begin += size;
+      range.size -= size;
+      numPageRows += size;
+      if (numPageRows == kDictionarySamplePageRows) {
+        addPage();
+      }
+    }
+  }
+  if (numPageRows > 0) {
+    addPage();
+  }
+}
 } // namespace
 
 SpillInputStream::SpillInputStream(
@@ -216,7 +277,8 @@ void SpillWriter::closeFile() {
       .size = currentFile_->size(),
       .numSortKeys = numSortKeys_,
       .sortFlags = sortCompareFlags_,
-      .compressionKind = compressionKind_});
+      .compressionKind = compressionKind_,
+      .compressionDictionary = compressionDictionary_});
   currentFile_.reset();
 }
 
@@ -262,8 +324,8 @@ uint64_t SpillWriter::write(
   {
     MicrosecondTimer timer(&timeUs);
     if (batch_ == nullptr) {
-      serializer::presto::PrestoVectorSerde::PrestoOptions options = {
-          kDefaultUseLosslessTimestamp, compressionKind_, true /*nullsFirst*/};
+      const auto options =
+          makeSpillSerdeOptions(compressionKind_, compressionDictionary_);
       batch_ = std::make_unique<VectorStreamGroup>(pool_);
       batch_->createStreamTree(
           std::static_pointer_cast<const RowType>(rows->type()),
@@ -273,12 +335,45 @@ uint64_t SpillWriter::write(
     batch_->append(rows, indices);
   }
   updateAppendStats(rows->size(), timeUs);
+  if (maybeTrainCompressionDictionary(rows, indices)) {
+    // Starts a new file so that the following pages are compressed with the
+    // dictionary.
+    const auto writtenBytes = flush();
+    closeFile();
+    return writtenBytes;
+  }
   if (batch_->size() < writeBufferSize_) {
     return 0;
   }
   return flush();
 }
 
+bool SpillWriter::maybeTrainCompressionDictionary(
+    const RowVectorPtr& rows,
+    const folly::Range<IndexRange*>& indices) {
+  if (compressionDictionaryTrained_ ||
+      compressionKind_ != common::CompressionKind_ZSTD ||
+      writeBufferSize_ > kMaxDictionaryCompressionPageSize) {
+    return false;
+  }
+  appendDictionarySamples(rows, indices, pool_, dictionarySamples_);
+  size_t sampleBytes{0};
+  for (const auto& sample : dictionarySamples_) {
+    sampleBytes += sample.size();
+  }
+  if (sampleBytes < kCompressionDictionaryTrainingBytes) {
+    return false;
+  }
+  compressionDictionaryTrained_ = true;
+  compressionDictionary_ = common::ZstdDictionary::train(
+      std::vector<std::string_view>(
+          dictionarySamples_.begin(), dictionarySamples_.end()),
+      kMaxCompressionDictionarySize);
+  dictionarySamples_.clear();
+  dictionarySamples_.shrink_to_fit();
+  return compressionDictionary_ != nullptr;
+}
+
 void SpillWriter::updateAppendStats(
     uint64_t numRows,
     uint64_t serializationTimeUs) {
@@ -363,6 +458,7 @@ std::unique_ptr<SpillReadFile> SpillReadFile::create(
       fileInfo.numSortKeys,
       fileInfo.sortFlags,
       fileInfo.compressionKind,
+      fileInfo.compressionDictionary,
       pool,
       stats));
 }
@@ -376,6 +472,7 @@ SpillReadFile::SpillReadFile(
     uint32_t numSortKeys,
     const std::vector<CompareFlags>& sortCompareFlags,
     common::CompressionKind compressionKind,
+    const std::shared_ptr<const common::ZstdDictionary>& compressionDictionary,
     memory::MemoryPool* pool,
     folly::Synchronized<common::SpillStats>* stats)
     : id_(id),
@@ -386,9 +483,7 @@ SpillReadFile::SpillReadFile(
       sortCompareFlags_(sortCompareFlags),
       compressionKind_(compressionKind),
       readOptions_{
-          kDefaultUseLosslessTimestamp,
-          compressionKind_,
-          /*nullsFirst=*/true},
+          makeSpillSerdeOptions(compressionKind, compressionDictionary)},
       pool_(pool),
       stats_(stats) {
   auto fs = filesystems::getFileSystem(path_, nullptr);
@@ -89,6 +89,8 @@ struct SpillFileInfo {
   uint32_t numSortKeys;
   std::vector<CompareFlags> sortFlags;
   common::CompressionKind compressionKind;
+  /// Set if the file is compressed with a zstd dictionary.
+  std::shared_ptr<const common::ZstdDictionary> compressionDictionary;
 };
 
 using SpillFiles = std::vector<SpillFileInfo>;
@@ -165,6 +167,13 @@ class SpillWriter {
   // written size.
   uint64_t flush();
 
+  // Collects samples of the first rows written and trains
+  // 'compressionDictionary_' on them if the files are compressed with zstd in
+  // small pages. Returns true if a dictionary has been trained by this call.
+  bool maybeTrainCompressionDictionary(
+      const RowVectorPtr& rows,
+      const folly::Range<IndexRange*>& indices);
+
   // Invoked to increment the number of spilled files and the file size.
   void updateSpilledFileStats(uint64_t fileSize);
 
@@ -193,6 +202,12 @@ class SpillWriter {
   folly::Synchronized<common::SpillStats>* const stats_;
 
   bool finished_{false};
+  bool compressionDictionaryTrained_{false};
+  // Uncompressed sample pages to train 'compressionDictionary_' on.
+  std::vector<std::string> dictionarySamples_;
+  // Used by the files started after training. Null if not trained or if
+  // training failed.
+  std::shared_ptr<const common::ZstdDictionary> compressionDictionary_;
   uint32_t nextFileId_{0};
   std::unique_ptr<VectorStreamGroup> batch_;
   std::unique_ptr<SpillWriteFile> currentFile_;
@@ -319,6 +334,8 @@ class SpillReadFile {
       uint32_t numSortKeys,
       const std::vector<CompareFlags>& sortCompareFlags,
       common::CompressionKind compressionKind,
+      const std::shared_ptr<const common::ZstdDictionary>&
+          compressionDictionary,
       memory::MemoryPool* pool,
       folly::Synchronized<common::SpillStats>* stats);
 
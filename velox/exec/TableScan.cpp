@@ -26,7 +26,8 @@ namespace facebook::velox::exec {
 TableScan::TableScan(
     int32_t operatorId,
     DriverCtx* driverCtx,
-    const std::shared_ptr<const core::TableScanNode>& tableScanNode)
+    const std::shared_ptr<const core::TableScanNode>& tableScanNode,
+    std::optional<int64_t> limit)
     : SourceOperator(
           driverCtx,
           tableScanNode->outputType(),
@@ -36,6 +37,7 @@ TableScan::TableScan(
       tableHandle_(tableScanNode->tableHandle()),
       columnHandles_(tableScanNode->assignments()),
       driverCtx_(driverCtx),
+      limit_(limit),
       connectorPool_(driverCtx_->task->addConnectorPoolLocked(
           planNodeId(),
           driverCtx_->pipelineId,
@@ -72,6 +74,35 @@ bool TableScan::shouldStop(StopReason taskStopReason) const {
       taskStopReason != StopReason::kYield;
 }
 
+bool TableScan::limitReached() {
+  if (!limit_.has_value()) {
+    return false;
+  }
+  if (scanOutputRows_ == nullptr) {
+    scanOutputRows_ = driverCtx_->task->getScanOutputRows(
+        driverCtx_->splitGroupId, planNodeId());
+  }
+  return *scanOutputRows_ >= limit_.value();
+}
+
+void TableScan::finishScan() {
+  noMoreSplits_ = true;
+  dynamicFilters_.clear();
+  if (dataSource_) {
+    curStatus_ = "getOutput: noMoreSplits_=1, updating stats_";
+    const auto connectorStats = dataSource_->runtimeStats();
+    auto lockedStats = stats_.wlock();
+    for (const auto& [name, counter] : connectorStats) {
+      if (FOLLY_UNLIKELY(lockedStats->runtimeStats.count(name) == 0)) {
+        lockedStats->runtimeStats.emplace(name, RuntimeMetric(counter.unit));
+      } else {
+        VELOX_CHECK_EQ(lockedStats->runtimeStats.at(name).unit, counter.unit);
+      }
+      lockedStats->runtimeStats.at(name).addValue(counter.value);
+    }
+  }
+}
+
 RowVectorPtr TableScan::getOutput() {
   auto exitCurStatusGuard = folly::makeGuard([this]() { curStatus_ = ""; });
 
@@ -82,6 +113,21 @@ RowVectorPtr TableScan::getOutput() {
   curStatus_ = "getOutput: enter";
   const auto startTimeMs = getCurrentTimeMs();
   for (;;) {
+    if (limitReached()) {
+      // Enough rows were produced for the downstream Limit. Abandon the
+      // current split and do not take any more splits. Destroying the data
+      // source cancels its outstanding prefetches.
+      curStatus_ = "getOutput: limit reached";
+      if (!needNewSplit_) {
+        driverCtx_->task->splitFinished(true, currentSplitWeight_);
+        needNewSplit_ = true;
+      }
+      finishScan();
+      dataSource_.reset();
+      stats_.wlock()->addRuntimeStat("limitReached", RuntimeCounter(1));
+      return nullptr;
+    }
+
     if (needNewSplit_) {
       // Check if our Task needs us to yield or we've been running for too long
       // w/o producing a result. In this case we return with the Yield blocking
@@ -115,23 +161,7 @@ RowVectorPtr TableScan::getOutput() {
       }
 
       if (!split.hasConnectorSplit()) {
-        noMoreSplits_ = true;
-        dynamicFilters_.clear();
-        if (dataSource_) {
-          curStatus_ = "getOutput: noMoreSplits_=1, updating stats_";
-          const auto connectorStats = dataSource_->runtimeStats();
-          auto lockedStats = stats_.wlock();
-          for (const auto& [name, counter] : connectorStats) {
-            if (FOLLY_UNLIKELY(lockedStats->runtimeStats.count(name) == 0)) {
-              lockedStats->runtimeStats.emplace(
-                  name, RuntimeMetric(counter.unit));
-            } else {
-              VELOX_CHECK_EQ(
-                  lockedStats->runtimeStats.at(name).unit, counter.unit);
-            }
-            lockedStats->runtimeStats.at(name).addValue(counter.value);
-          }
-        }
+        finishScan();
         return nullptr;
       }
 
@@ -225,6 +255,14 @@ RowVectorPtr TableScan::getOutput() {
          &debugString_});
 
     int32_t readBatchSize = readBatchSize_;
+    if (limit_.has_value()) {
+      // Do not read more rows than the downstream Limit needs unless the
+      // filters are selective.
+      readBatchSize = std::max<int64_t>(
+          1,
+          std::min<int64_t>(
+              readBatchSize, limit_.value() - scanOutputRows_->load()));
+    }
     if (maxFilteringRatio_ > 0) {
       readBatchSize = std::min(
           maxReadBatchSize_,
@@ -259,6 +297,10 @@ RowVectorPtr TableScan::getOutput() {
       if (data != nullptr) {
         if (data->size() > 0) {
           lockedStats->addInputVector(data->estimateFlatSize(), data->size());
+          if (scanOutputRows_ != nullptr) {
+            *scanOutputRows_ += data->size();
+            splitOutputRows_ += data->size();
+          }
           constexpr int kMaxSelectiveBatchSizeMultiplier = 4;
           maxFilteringRatio_ = std::max(
               {maxFilteringRatio_,
@@ -288,6 +330,9 @@ RowVectorPtr TableScan::getOutput() {
     curStatus_ = "getOutput: task->splitFinished";
     driverCtx_->task->splitFinished(true, currentSplitWeight_);
     needNewSplit_ = true;
+    completedSplitOutputRows_ += splitOutputRows_;
+    splitOutputRows_ = 0;
+    ++numCompletedSplits_;
   }
 }
 
@@ -332,12 +377,36 @@ void TableScan::preload(
       });
 }
 
+bool TableScan::limitNeedsMoreSplits() const {
+  if (!limit_.has_value()) {
+    return true;
+  }
+  int64_t expectedSplitRows = splitOutputRows_;
+  if (numCompletedSplits_ > 0) {
+    expectedSplitRows = std::max(
+        expectedSplitRows, completedSplitOutputRows_ / numCompletedSplits_);
+  }
+  if (expectedSplitRows == 0) {
+    // No estimate of the rows per split yet.
+    return false;
+  }
+  const auto remainingRows = limit_.value() - scanOutputRows_->load();
+  return remainingRows >
+      expectedSplitRows * driverCtx_->task->numDrivers(driverCtx_->driver);
+}
+
 void TableScan::checkPreload() {
   auto* executor = connector_->executor();
   if (maxSplitPreloadPerDriver_ == 0 || !executor ||
       !connector_->supportsSplitPreload()) {
     return;
   }
+  // Splits past the limit are never read, so do not preload them once the
+  // splits being read are expected to produce the rows the limit needs.
+  if (!limitNeedsMoreSplits()) {
+    maxPreloadedSplits_ = 0;
+    return;
+  }
   if (dataSource_->allPrefetchIssued()) {
     maxPreloadedSplits_ = driverCtx_->task->numDrivers(driverCtx_->driver) *
         maxSplitPreloadPerDriver_;
@@ -25,7 +25,8 @@ class TableScan : public SourceOperator {
   TableScan(
       int32_t operatorId,
       DriverCtx* driverCtx,
-      const std::shared_ptr<const core::TableScanNode>& tableScanNode);
+      const std::shared_ptr<const core::TableScanNode>& tableScanNode,
+      std::optional<int64_t> limit = std::nullopt);
 
   folly::dynamic toJson() const override;
 
@@ -59,6 +60,18 @@ class TableScan : public SourceOperator {
   // terminated.
   bool shouldStop(StopReason taskStopReason) const;
 
+  // Returns true if the table scans of this plan node in the split group have
+  // produced all the rows 'limit_' allows.
+  bool limitReached();
+
+  // Returns true if no limit is set or if the limit likely needs rows from
+  // splits after the ones the drivers are reading. Estimates the rows per
+  // split from the splits this driver has read.
+  bool limitNeedsMoreSplits() const;
+
+  // Sets 'noMoreSplits_' and adds the runtime stats of 'dataSource_'.
+  void finishScan();
+
   // Sets 'maxPreloadSplits' and 'splitPreloader' if prefetching splits is
   // appropriate. The preloader will be applied to the 'first 'maxPreloadSplits'
   // of the Task's split queue for 'this' when getting splits.
@@ -75,6 +88,18 @@ class TableScan : public SourceOperator {
       unordered_map<std::string, std::shared_ptr<connector::ColumnHandle>>
           columnHandles_;
   DriverCtx* const driverCtx_;
+  // Number of rows needed by a Limit that directly consumes the output of
+  // this plan node. The table scans of the plan node stop reading once they
+  // have produced this many rows across all drivers of the split group.
+  const std::optional<int64_t> limit_;
+  // Rows produced by the table scans of this plan node across all drivers of
+  // the split group. Set on first use if 'limit_' is set.
+  std::shared_ptr<std::atomic<int64_t>> scanOutputRows_;
+  // Rows produced by this driver from the current split and from the
+  // completed splits if 'limit_' is set. Used to estimate the rows per split.
+  int64_t splitOutputRows_{0};
+  int64_t completedSplitOutputRows_{0};
+  int64_t numCompletedSplits_{0};
   memory::MemoryPool* const connectorPool_;
   ContinueFuture blockingFuture_{ContinueFuture::makeEmpty()};
   BlockingReason blockingReason_{BlockingReason::kNotBlocked};
@@ -31,6 +31,7 @@
 #include "velox/exec/NestedLoopJoinBuild.h"
 #include "velox/exec/OperatorUtils.h"
 #include "velox/exec/OutputBufferManager.h"
+#include "velox/exec/RangeJoinBuild.h"
 #include "velox/exec/Task.h"
 
 using facebook::velox::common::testutil::TestValue;
@@ -1018,6 +1019,7 @@ void Task::createSplitGroupStateLocked(uint32_t splitGroupId) {
     addHashJoinBridgesLocked(splitGroupId, factory->needsHashJoinBridges());
     addNestedLoopJoinBridgesLocked(
         splitGroupId, factory->needsNestedLoopJoinBridges());
+    addRangeJoinBridgesLocked(splitGroupId, factory->needsRangeJoinBridges());
     addCustomJoinBridgesLocked(splitGroupId, factory->planNodes);
   }
 }
@@ -1775,6 +1777,16 @@ void Task::addNestedLoopJoinBridgesLocked(
   }
 }
 
+void Task::addRangeJoinBridgesLocked(
+    uint32_t splitGroupId,
+    const std::vector<core::PlanNodeId>& planNodeIds) {
+  auto& splitGroupState = splitGroupStates_[splitGroupId];
+  for (const auto& planNodeId : planNodeIds) {
+    splitGroupState.bridges.emplace(
+        planNodeId, std::make_shared<RangeJoinBridge>());
+  }
+}
+
 std::shared_ptr<HashJoinBridge> Task::getHashJoinBridge(
     uint32_t splitGroupId,
     const core::PlanNodeId& planNodeId) {
@@ -1793,6 +1805,12 @@ std::shared_ptr<NestedLoopJoinBridge> Task::getNestedLoopJoinBridge(
   return getJoinBridgeInternal<NestedLoopJoinBridge>(splitGroupId, planNodeId);
 }
 
+std::shared_ptr<RangeJoinBridge> Task::getRangeJoinBridge(
+    uint32_t splitGroupId,
+    const core::PlanNodeId& planNodeId) {
+  return getJoinBridgeInternal<RangeJoinBridge>(splitGroupId, planNodeId);
+}
+
 template <class TBridgeType>
 std::shared_ptr<TBridgeType> Task::getJoinBridgeInternal(
     uint32_t splitGroupId,
@@ -2418,6 +2436,18 @@ std::shared_ptr<MergeJoinSource> Task::getMergeJoinSource(
   return it->second;
 }
 
+std::shared_ptr<std::atomic<int64_t>> Task::getScanOutputRows(
+    uint32_t splitGroupId,
+    const core::PlanNodeId& planNodeId) {
+  std::lock_guard<std::timed_mutex> l(mutex_);
+  auto& scanOutputRows =
+      splitGroupStates_[splitGroupId].scanOutputRows[planNodeId];
+  if (scanOutputRows == nullptr) {
+    scanOutputRows = std::make_shared<std::atomic<int64_t>>(0);
+  }
+  return scanOutputRows;
+}
+
 void Task::createLocalExchangeQueuesLocked(
     uint32_t splitGroupId,
     const core::PlanNodeId& planNodeId,
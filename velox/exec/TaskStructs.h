@@ -105,6 +105,11 @@ struct SplitGroupState {
   /// Map of local exchanges keyed on LocalPartition plan node ID.
   std::unordered_map<core::PlanNodeId, LocalExchangeState> localExchanges;
 
+  /// Number of rows produced by all the drivers of a table scan that feeds a
+  /// Limit, keyed on TableScanNode plan node ID.
+  std::unordered_map<core::PlanNodeId, std::shared_ptr<std::atomic<int64_t>>>
+      scanOutputRows;
+
   /// Drivers created and still running for this split group.
   /// The split group is finished when this numbers reaches zero.
   uint32_t numRunningDrivers{0};
@@ -130,6 +135,7 @@ struct SplitGroupState {
     localMergeSources.clear();
     mergeJoinSources.clear();
     localExchanges.clear();
+    scanOutputRows.clear();
   }
 };
 
@@ -16,10 +16,138 @@
 #include <folly/container/F14Map.h>
 
 #include "velox/exec/ContainerRowSerde.h"
+#include "velox/exec/Task.h"
 #include "velox/exec/TopN.h"
+#include "velox/type/Filter.h"
 #include "velox/vector/FlatVector.h"
 
 namespace facebook::velox::exec {
+namespace {
+CompareFlags fromSortOrderToCompareFlags(const core::SortOrder& sortOrder) {
+  return {
+      sortOrder.isNullsFirst(),
+      sortOrder.isAscending(),
+      false,
+      CompareFlags::NullHandlingMode::kNullAsValue};
+}
+
+template <typename T>
+void encodeColumn(
+    const DecodedVector& decoded,
+    const prefixsort::PrefixSortEncoder& encoder,
+    vector_size_t numRows,
+    uint32_t prefixSize,
+    char* prefixes) {
+  for (auto row = 0; row < numRows; ++row) {
+    std::optional<T> value;
+    if (!decoded.isNullAt(row)) {
+      value = decoded.valueAt<T>(row);
+    }
+    encoder.encode(value, prefixes + row * prefixSize);
+  }
+}
+
+void encodeColumn(
+    TypeKind typeKind,
+    const DecodedVector& decoded,
+    const prefixsort::PrefixSortEncoder& encoder,
+    vector_size_t numRows,
+    uint32_t prefixSize,
+    char* prefixes) {
+  switch (typeKind) {
+    case TypeKind::INTEGER:
+      return encodeColumn<int32_t>(
+          decoded, encoder, numRows, prefixSize, prefixes);
+    case TypeKind::BIGINT:
+      return encodeColumn<int64_t>(
+          decoded, encoder, numRows, prefixSize, prefixes);
+    case TypeKind::REAL:
+      return encodeColumn<float>(
+          decoded, encoder, numRows, prefixSize, prefixes);
+    case TypeKind::DOUBLE:
+      return encodeColumn<double>(
+          decoded, encoder, numRows, prefixSize, prefixes);
+    case TypeKind::TIMESTAMP:
+      return encodeColumn<Timestamp>(
+          decoded, encoder, numRows, prefixSize, prefixes);
+    default:
+      VELOX_UNREACHABLE(
+          "Unexpected normalized key type: {}", mapTypeKindToName(typeKind));
+  }
+}
+
+template <typename T>
+void encodeRowColumn(
+    const RowColumn& column,
+    const char* row,
+    const prefixsort::PrefixSortEncoder& encoder,
+    char* prefix) {
+  std::optional<T> value;
+  if (!RowContainer::isNullAt(row, column.nullByte(), column.nullMask())) {
+    value = *reinterpret_cast<const T*>(row + column.offset());
+  }
+  encoder.encode(value, prefix);
+}
+
+void encodeRowColumn(
+    TypeKind typeKind,
+    const RowColumn& column,
+    const char* row,
+    const prefixsort::PrefixSortEncoder& encoder,
+    char* prefix) {
+  switch (typeKind) {
+    case TypeKind::INTEGER:
+      return encodeRowColumn<int32_t>(column, row, encoder, prefix);
+    case TypeKind::BIGINT:
+      return encodeRowColumn<int64_t>(column, row, encoder, prefix);
+    case TypeKind::REAL:
+      return encodeRowColumn<float>(column, row, encoder, prefix);
+    case TypeKind::DOUBLE:
+      return encodeRowColumn<double>(column, row, encoder, prefix);
+    case TypeKind::TIMESTAMP:
+      return encodeRowColumn<Timestamp>(column, row, encoder, prefix);
+    default:
+      VELOX_UNREACHABLE(
+          "Unexpected normalized key type: {}", mapTypeKindToName(typeKind));
+  }
+}
+
+// Returns the value of an integer 'column' of 'row' widened to int64_t.
+std::optional<int64_t>
+readIntegerColumn(TypeKind typeKind, const RowColumn& column, const char* row) {
+  if (RowContainer::isNullAt(row, column.nullByte(), column.nullMask())) {
+    return std::nullopt;
+  }
+  const char* value = row + column.offset();
+  switch (typeKind) {
+    case TypeKind::TINYINT:
+      return *reinterpret_cast<const int8_t*>(value);
+    case TypeKind::SMALLINT:
+      return *reinterpret_cast<const int16_t*>(value);
+    case TypeKind::INTEGER:
+      return *reinterpret_cast<const int32_t*>(value);
+    case TypeKind::BIGINT:
+      return *reinterpret_cast<const int64_t*>(value);
+    default:
+      VELOX_UNREACHABLE(
+          "Unexpected dynamic filter key type: {}",
+          mapTypeKindToName(typeKind));
+  }
+}
+
+bool isIntegerKind(TypeKind typeKind) {
+  switch (typeKind) {
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+      return true;
+    default:
+      return false;
+  }
+}
+} // namespace
+
 TopN::TopN(
     int32_t operatorId,
     DriverCtx* driverCtx,
@@ -31,6 +159,7 @@ TopN::TopN(
           topNNode->id(),
           "TopN"),
       count_(topNNode->count()),
+      sortingOrders_(topNNode->sortingOrders()),
       data_(std::make_unique<RowContainer>(outputType_->children(), pool())),
       comparator_(
           outputType_,
@@ -55,6 +184,108 @@ TopN::TopN(
       }
     }
   }
+
+  std::vector<TypePtr> keyTypes;
+  std::vector<CompareFlags> compareFlags;
+  keyTypes.reserve(numSortingKeys);
+  compareFlags.reserve(numSortingKeys);
+  for (auto i = 0; i < numSortingKeys; ++i) {
+    keyTypes.push_back(outputType_->childAt(sortingKeyColumns_[i]));
+    compareFlags.push_back(fromSortOrderToCompareFlags(sortingOrders_[i]));
+  }
+  auto prefixLayout = PrefixSortLayout::makeSortLayout(
+      keyTypes,
+      compareFlags,
+      driverCtx->prefixSortConfig().maxNormalizedKeySize);
+  if (!prefixLayout.noNormalizedKeys) {
+    prefixSize_ = prefixLayout.normalizedBufferSize - prefixLayout.padding;
+    boundaryPrefix_.resize(prefixSize_);
+    prefixLayout_.emplace(std::move(prefixLayout));
+  }
+}
+
+void TopN::initialize() {
+  Operator::initialize();
+  if (count_ == 0) {
+    return;
+  }
+
+  // The boundary of the top rows is pushed down as a range filter on the
+  // first sorting key. Rows outside of the range sort after the current top
+  // rows and can be skipped by the upstream operators.
+  const auto channel = sortingKeyColumns_[0];
+  if (!isIntegerKind(outputType_->childAt(channel)->kind())) {
+    return;
+  }
+  const auto channels =
+      operatorCtx_->driverCtx()->driver->canPushdownFilters(this, {channel});
+  if (channels.count(channel) != 0) {
+    dynamicFilterChannel_ = channel;
+  }
+}
+
+void TopN::encodeInputPrefixes(vector_size_t numRows) {
+  inputPrefixes_.resize(numRows * prefixSize_);
+  for (auto i = 0; i < prefixLayout_->numNormalizedKeys; ++i) {
+    const auto col = sortingKeyColumns_[i];
+    encodeColumn(
+        outputType_->childAt(col)->kind(),
+        decodedVectors_[col],
+        prefixLayout_->encoders[i],
+        numRows,
+        prefixSize_,
+        inputPrefixes_.data() + prefixLayout_->prefixOffsets[i]);
+  }
+}
+
+void TopN::updateBoundaryPrefix() {
+  const char* topRow = topRows_.top();
+  for (auto i = 0; i < prefixLayout_->numNormalizedKeys; ++i) {
+    const auto col = sortingKeyColumns_[i];
+    encodeRowColumn(
+        outputType_->childAt(col)->kind(),
+        data_->columnAt(col),
+        topRow,
+        prefixLayout_->encoders[i],
+        boundaryPrefix_.data() + prefixLayout_->prefixOffsets[i]);
+  }
+}
+
+bool TopN::isBetterThanBoundary(vector_size_t row) {
+  if (prefixLayout_.has_value()) {
+    const auto result = std::memcmp(
+        inputPrefixes_.data() + row * prefixSize_,
+        boundaryPrefix_.data(),
+        prefixSize_);
+    if (result != 0 || !prefixLayout_->hasNonNormalizedKey) {
+      return result < 0;
+    }
+  }
+  return comparator_(decodedVectors_, row, topRows_.top());
+}
+
+void TopN::updateDynamicFilter() {
+  const auto channel = dynamicFilterChannel_.value();
+  const auto boundary = readIntegerColumn(
+      outputType_->childAt(channel)->kind(),
+      data_->columnAt(channel),
+      topRows_.top());
+  if (!boundary.has_value() || boundary == dynamicFilterBoundary_) {
+    return;
+  }
+  dynamicFilterBoundary_ = boundary;
+
+  // Rows with a key equal to the boundary are kept since the following
+  // sorting keys may still place them before the top row.
+  const auto& sortOrder = sortingOrders_[0];
+  const bool nullAllowed = sortOrder.isNullsFirst();
+  if (sortOrder.isAscending()) {
+    dynamicFilters_[channel] = std::make_shared<common::BigintRange>(
+        std::numeric_limits<int64_t>::min(), boundary.value(), nullAllowed);
+  } else {
+    dynamicFilters_[channel] = std::make_shared<common::BigintRange>(
+        boundary.value(), std::numeric_limits<int64_t>::max(), nullAllowed);
+  }
 }
 
 void TopN::addInput(RowVectorPtr input) {
@@ -62,6 +293,10 @@ void TopN::addInput(RowVectorPtr input) {
     decodedVectors_[col].decode(*input->childAt(col));
   }
 
+  if (prefixLayout_.has_value()) {
+    encodeInputPrefixes(input->size());
+  }
+
   const bool hasNonKeyColumn{!nonKeyColumns_.empty()};
   // Maps passed rows of 'data_' to the corresponding input row number. These
   // input rows of non-key columns are later stored into data_.
@@ -71,11 +306,10 @@ void TopN::addInput(RowVectorPtr input) {
     if (topRows_.size() < count_) {
       newRow = data_->newRow();
     } else {
-      char* topRow = topRows_.top();
-
-      if (!comparator_(decodedVectors_, row, topRow)) {
+      if (!isBetterThanBoundary(row)) {
         continue;
       }
+      char* topRow = topRows_.top();
       topRows_.pop();
       // Reuse the topRow's memory.
       newRow = data_->initializeRow(topRow, true /* reuse */);
@@ -87,11 +321,18 @@ void TopN::addInput(RowVectorPtr input) {
     }
 
     topRows_.push(newRow);
+    if (prefixLayout_.has_value() && topRows_.size() == count_) {
+      updateBoundaryPrefix();
+    }
     if (hasNonKeyColumn) {
       passedRows[newRow] = row;
     }
   }
 
+  if (dynamicFilterChannel_.has_value() && topRows_.size() == count_) {
+    updateDynamicFilter();
+  }
+
   if (hasNonKeyColumn && !passedRows.empty()) {
     for (const auto col : nonKeyColumns_) {
       decodedVectors_[col].decode(*input->childAt(col));
@@ -16,6 +16,7 @@
 #pragma once
 
 #include "velox/exec/Operator.h"
+#include "velox/exec/PrefixSort.h"
 #include "velox/exec/RowContainer.h"
 
 namespace facebook::velox::exec {
@@ -27,6 +28,8 @@ class TopN : public Operator {
       DriverCtx* driverCtx,
       const std::shared_ptr<const core::TopNNode>& topNNode);
 
+  void initialize() override;
+
   bool needsInput() const override {
     return !noMoreInput_;
   }
@@ -44,8 +47,27 @@ class TopN : public Operator {
   bool isFinished() override;
 
  private:
+  // Encodes the normalized sorting keys of the first 'numRows' rows of the
+  // decoded input into 'inputPrefixes_'.
+  void encodeInputPrefixes(vector_size_t numRows);
+
+  // Encodes the normalized sorting keys of topRows_.top() into
+  // 'boundaryPrefix_'. Called whenever the top of a full 'topRows_' changes.
+  void updateBoundaryPrefix();
+
+  // Returns true if input 'row' sorts before topRows_.top() and must replace
+  // it.
+  bool isBetterThanBoundary(vector_size_t row);
+
+  // Sets a dynamic filter on the first sorting key that accepts only the
+  // values that can still enter the top rows. Called once per input batch
+  // while 'topRows_' is full.
+  void updateDynamicFilter();
+
   const int32_t count_;
 
+  const std::vector<core::SortOrder> sortingOrders_;
+
   bool finished_ = false;
   uint32_t numRowsReturned_ = 0;
 
@@ -68,5 +90,28 @@ class TopN : public Operator {
 
   std::vector<DecodedVector> decodedVectors_;
   vector_size_t outputBatchSize_;
+
+  // Layout of the normalized sorting keys. Set if at least the first sorting
+  // key can be normalized. Input rows are then compared with the top row by
+  // comparing their normalized keys and 'comparator_' is only used to break
+  // ties when some sorting keys are not normalized.
+  std::optional<PrefixSortLayout> prefixLayout_;
+
+  // Number of bytes of the normalized keys, excluding the alignment padding.
+  uint32_t prefixSize_{0};
+
+  // Normalized keys of the current input rows, 'prefixSize_' bytes per row.
+  std::vector<char> inputPrefixes_;
+
+  // Normalized keys of topRows_.top() while 'topRows_' is full.
+  std::vector<char> boundaryPrefix_;
+
+  // Channel of the first sorting key if a dynamic filter on it can be pushed
+  // down to an upstream operator.
+  std::optional<column_index_t> dynamicFilterChannel_;
+
+  // Value of the first sorting key of topRows_.top() the last dynamic filter
+  // was created for.
+  std::optional<int64_t> dynamicFilterBoundary_;
 };
 } // namespace facebook::velox::exec
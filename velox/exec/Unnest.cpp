@@ -111,56 +111,102 @@ RowVectorPtr Unnest::getOutput() {
   }
 
   const auto size = input_->size();
-  const auto maxOutputSize = outputBatchRows();
-
-  // Limit the number of input rows to keep output batch size within
-  // 'maxOutputSize' if possible. Process each input row fully. Do not break
-  // single row's output into multiple batches.
-  vector_size_t numInput = 0;
-  vector_size_t numElements = 0;
-  for (auto row = nextInputRow_; row < size; ++row) {
-    numElements += rawMaxSizes_[row];
-    ++numInput;
+  const auto range = extractRowRange(size);
 
-    if (numElements >= maxOutputSize) {
-      break;
-    }
-  }
-
-  if (numElements == 0) {
+  if (range.numElements == 0) {
     // All arrays/maps are null or empty.
     input_ = nullptr;
     nextInputRow_ = 0;
+    nextElement_ = 0;
     return nullptr;
   }
 
-  auto output = generateOutput(nextInputRow_, numInput, numElements);
+  auto output = generateOutput(range);
 
-  nextInputRow_ += numInput;
+  if (range.lastRowEnd.has_value()) {
+    // The last row is only partially unnested. Continue from where we stopped.
+    nextInputRow_ = range.start + range.size - 1;
+    nextElement_ = range.lastRowEnd.value();
+  } else {
+    nextInputRow_ = range.start + range.size;
+    nextElement_ = 0;
+  }
 
   if (nextInputRow_ >= size) {
     input_ = nullptr;
     nextInputRow_ = 0;
+    nextElement_ = 0;
   }
 
   return output;
 }
 
+Unnest::RowRange Unnest::extractRowRange(vector_size_t inputSize) const {
+  const auto maxOutputSize = outputBatchRows();
+
+  // Limit the number of output rows to 'maxOutputSize'. Split the elements of
+  // the last row across multiple batches if needed, so that very large arrays
+  // (or maps) do not produce very large batches.
+  vector_size_t numInput = 0;
+  vector_size_t numElements = 0;
+  std::optional<vector_size_t> lastRowEnd;
+  for (auto row = nextInputRow_; row < inputSize; ++row) {
+    const auto rowStart = row == nextInputRow_ ? nextElement_ : 0;
+    const auto rowSize = rawMaxSizes_[row] - rowStart;
+    ++numInput;
+
+    if (numElements + rowSize > maxOutputSize) {
+      lastRowEnd = rowStart + (maxOutputSize - numElements);
+      numElements = maxOutputSize;
+      break;
+    }
+
+    numElements += rowSize;
+    if (numElements >= maxOutputSize) {
+      break;
+    }
+  }
+
+  return {nextInputRow_, numInput, nextElement_, lastRowEnd, numElements};
+}
+
+template <typename F>
+void Unnest::forEachRow(const RowRange& range, F func) const {
+  const auto end = range.start + range.size;
+  for (auto row = range.start; row < end; ++row) {
+    const auto rowStart = row == range.start ? range.firstRowStart : 0;
+    const auto rowEnd = (row == end - 1 && range.lastRowEnd.has_value())
+        ? range.lastRowEnd.value()
+        : rawMaxSizes_[row];
+    func(row, rowStart, rowEnd - rowStart);
+  }
+}
+
 void Unnest::generateRepeatedColumns(
-    vector_size_t start,
-    vector_size_t size,
-    vector_size_t numElements,
+    const RowRange& range,
     std::vector<VectorPtr>& outputs) {
+  const auto numElements = range.numElements;
+
+  if (range.size == 1) {
+    // All output rows come from a single input row. Repeat it using constant
+    // encoding.
+    for (const auto& projection : identityProjections_) {
+      outputs.at(projection.outputChannel) = BaseVector::wrapInConstant(
+          numElements, range.start, input_->childAt(projection.inputChannel));
+    }
+    return;
+  }
+
   // Create "indices" buffer to repeat rows as many times as there are elements
   // in the array (or map) in unnestDecoded.
   auto repeatedIndices = allocateIndices(numElements, pool());
   auto* rawRepeatedIndices = repeatedIndices->asMutable<vector_size_t>();
   vector_size_t index = 0;
-  for (auto row = start; row < start + size; ++row) {
-    for (auto i = 0; i < rawMaxSizes_[row]; i++) {
-      rawRepeatedIndices[index++] = row;
-    }
-  }
+  forEachRow(range, [&](auto row, auto /*start*/, auto size) {
+    std::fill(
+        rawRepeatedIndices + index, rawRepeatedIndices + index + size, row);
+    index += size;
+  });
 
   // Wrap "replicated" columns in a dictionary using 'repeatedIndices'.
   for (const auto& projection : identityProjections_) {
@@ -174,83 +220,96 @@ void Unnest::generateRepeatedColumns(
 
 const Unnest::UnnestChannelEncoding Unnest::generateEncodingForChannel(
     column_index_t channel,
-    vector_size_t start,
-    vector_size_t size,
-    vector_size_t numElements) {
-  BufferPtr elementIndices = allocateIndices(numElements, pool());
-  auto* rawElementIndices = elementIndices->asMutable<vector_size_t>();
-
-  auto nulls = allocateNulls(numElements, pool());
-  auto rawNulls = nulls->asMutable<uint64_t>();
+    const RowRange& range) {
+  const auto numElements = range.numElements;
 
   auto& currentDecoded = unnestDecoded_[channel];
   auto* currentSizes = rawSizes_[channel];
   auto* currentOffsets = rawOffsets_[channel];
   auto* currentIndices = rawIndices_[channel];
 
-  // Make dictionary index for elements column since they may be out of order.
+  // Check whether the output is a contiguous range of the elements: rows are
+  // not null, do not need to be padded with nulls and the elements of
+  // consecutive rows follow each other. In this case, the output is a
+  // zero-copy slice of the elements.
+  std::optional<vector_size_t> firstOffset;
+  bool contiguous = true;
   vector_size_t index = 0;
-  bool identityMapping = true;
-  for (auto row = start; row < start + size; ++row) {
-    const auto maxSize = rawMaxSizes_[row];
-
-    if (!currentDecoded.isNullAt(row)) {
-      const auto offset = currentOffsets[currentIndices[row]];
-      const auto unnestSize = currentSizes[currentIndices[row]];
+  forEachRow(range, [&](auto row, auto start, auto size) {
+    if (!contiguous || size == 0) {
+      return;
+    }
+    if (currentDecoded.isNullAt(row) ||
+        currentSizes[currentIndices[row]] < start + size) {
+      contiguous = false;
+      return;
+    }
+    const auto offset = currentOffsets[currentIndices[row]] + start;
+    if (!firstOffset.has_value()) {
+      firstOffset = offset;
+    } else if (offset != firstOffset.value() + index) {
+      contiguous = false;
+      return;
+    }
+    index += size;
+  });
 
-      if (index != offset || unnestSize < maxSize) {
-        identityMapping = false;
-      }
+  if (contiguous) {
+    VELOX_CHECK(firstOffset.has_value());
+    return {nullptr, nullptr, firstOffset};
+  }
 
-      for (auto i = 0; i < unnestSize; i++) {
-        rawElementIndices[index++] = offset + i;
-      }
+  BufferPtr elementIndices = allocateIndices(numElements, pool());
+  auto* rawElementIndices = elementIndices->asMutable<vector_size_t>();
 
-      for (auto i = unnestSize; i < maxSize; ++i) {
-        bits::setNull(rawNulls, index++, true);
-      }
-    } else if (maxSize > 0) {
-      identityMapping = false;
+  auto nulls = allocateNulls(numElements, pool());
+  auto rawNulls = nulls->asMutable<uint64_t>();
 
-      for (auto i = 0; i < maxSize; ++i) {
-        bits::setNull(rawNulls, index++, true);
-      }
+  // Make dictionary index for elements column since they may be out of order.
+  index = 0;
+  forEachRow(range, [&](auto row, auto start, auto size) {
+    vector_size_t numValues = 0;
+    if (!currentDecoded.isNullAt(row)) {
+      const auto offset = currentOffsets[currentIndices[row]] + start;
+      const auto unnestSize = currentSizes[currentIndices[row]];
+      numValues = std::max(0, std::min(size, unnestSize - start));
+      std::iota(
+          rawElementIndices + index,
+          rawElementIndices + index + numValues,
+          offset);
     }
-  }
-  return {elementIndices, nulls, identityMapping};
+    bits::fillBits(rawNulls, index + numValues, index + size, bits::kNull);
+    index += size;
+  });
+  return {elementIndices, nulls, std::nullopt};
 }
 
-VectorPtr Unnest::generateOrdinalityVector(
-    vector_size_t start,
-    vector_size_t size,
-    vector_size_t numElements) {
-  auto ordinalityVector =
-      BaseVector::create<FlatVector<int64_t>>(BIGINT(), numElements, pool());
+VectorPtr Unnest::generateOrdinalityVector(const RowRange& range) {
+  auto ordinalityVector = BaseVector::create<FlatVector<int64_t>>(
+      BIGINT(), range.numElements, pool());
 
   // Set the ordinality at each result row to be the index of the element in
   // the original array (or map) plus one.
   auto* rawOrdinality = ordinalityVector->mutableRawValues();
-  for (auto row = start; row < start + size; ++row) {
-    const auto maxSize = rawMaxSizes_[row];
-    std::iota(rawOrdinality, rawOrdinality + maxSize, 1);
-    rawOrdinality += maxSize;
-  }
+  forEachRow(range, [&](auto /*row*/, auto start, auto size) {
+    std::iota(rawOrdinality, rawOrdinality + size, start + 1);
+    rawOrdinality += size;
+  });
 
   return ordinalityVector;
 }
 
-RowVectorPtr Unnest::generateOutput(
-    vector_size_t start,
-    vector_size_t size,
-    vector_size_t numElements) {
+RowVectorPtr Unnest::generateOutput(const RowRange& range) {
+  const auto numElements = range.numElements;
+
   std::vector<VectorPtr> outputs(outputType_->size());
-  generateRepeatedColumns(start, size, numElements, outputs);
+  generateRepeatedColumns(range, outputs);
 
   // Create unnest columns.
   vector_size_t outputsIndex = identityProjections_.size();
   for (auto channel = 0; channel < unnestChannels_.size(); ++channel) {
     const auto unnestChannelEncoding =
-        generateEncodingForChannel(channel, start, size, numElements);
+        generateEncodingForChannel(channel, range);
 
     auto& currentDecoded = unnestDecoded_[channel];
     if (currentDecoded.base()->typeKind() == TypeKind::ARRAY) {
@@ -272,18 +331,45 @@ RowVectorPtr Unnest::generateOutput(
 
   if (withOrdinality_) {
     // Ordinality column is always at the end.
-    outputs.back() = generateOrdinalityVector(start, size, numElements);
+    outputs.back() = generateOrdinalityVector(range);
   }
 
   return std::make_shared<RowVector>(
       pool(), outputType_, BufferPtr(nullptr), numElements, std::move(outputs));
 }
 
+namespace {
+// Returns true if 'vector' supports zero-copy slicing.
+bool canSlice(const BaseVector& vector) {
+  switch (vector.encoding()) {
+    case VectorEncoding::Simple::BIASED:
+    case VectorEncoding::Simple::SEQUENCE:
+    case VectorEncoding::Simple::FUNCTION:
+      return false;
+    default:
+      return true;
+  }
+}
+} // namespace
+
 VectorPtr Unnest::UnnestChannelEncoding::wrap(
     const VectorPtr& base,
     vector_size_t wrapSize) const {
-  if (identityMapping) {
-    return base;
+  if (contiguousOffset.has_value()) {
+    const auto offset = contiguousOffset.value();
+    if (offset == 0 && wrapSize == base->size()) {
+      return base;
+    }
+    if (canSlice(*base)) {
+      // Zero-copy slice of the elements. Unlike a dictionary over 'base', the
+      // slice is only as large as the output.
+      return base->slice(offset, wrapSize);
+    }
+    auto indices = allocateIndices(wrapSize, base->pool());
+    auto* rawIndices = indices->asMutable<vector_size_t>();
+    std::iota(rawIndices, rawIndices + wrapSize, offset);
+    return BaseVector::copy(
+        *BaseVector::wrapInDictionary(nullptr, indices, wrapSize, base));
   }
 
   const auto result =
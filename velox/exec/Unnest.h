@@ -39,28 +39,54 @@ class Unnest : public Operator {
   bool isFinished() override;
 
  private:
-  // Generate output for 'size' input rows starting from 'start' input row.
-  //
-  // @param start First input row to include in the output.
-  // @param size Number of input rows to include in the output.
-  // @param outputSize Pre-computed number of output rows.
-  RowVectorPtr generateOutput(
-      vector_size_t start,
-      vector_size_t size,
-      vector_size_t outputSize);
+  // Range of input rows and of their elements to include in one output
+  // batch. The first and the last row of the range may be partially unnested
+  // so that arrays (or maps) much larger than the output batch size are split
+  // across several batches.
+  struct RowRange {
+    // First input row to include in the output.
+    vector_size_t start;
+
+    // Number of input rows to include in the output.
+    vector_size_t size;
+
+    // First element of the first input row to include in the output.
+    vector_size_t firstRowStart;
+
+    // Exclusive end of the elements of the last input row to include in the
+    // output. Unset if the last row is included up to its end.
+    std::optional<vector_size_t> lastRowEnd;
+
+    // Number of output rows.
+    vector_size_t numElements;
+  };
+
+  // Returns the range of rows starting at 'nextInputRow_' and
+  // 'nextElement_' whose elements fit into one output batch.
+  RowRange extractRowRange(vector_size_t inputSize) const;
+
+  // Invokes 'func(row, start, size)' for each input row in 'range', where
+  // 'start' is the first element of 'row' to output and 'size' is the number
+  // of output rows generated for 'row'.
+  template <typename F>
+  void forEachRow(const RowRange& range, F func) const;
+
+  // Generate output for the input rows and elements in 'range'.
+  RowVectorPtr generateOutput(const RowRange& range);
 
   // Invoked by generateOutput function above to generate the repeated output
   // columns.
   void generateRepeatedColumns(
-      vector_size_t start,
-      vector_size_t size,
-      vector_size_t numElements,
+      const RowRange& range,
       std::vector<VectorPtr>& outputs);
 
   struct UnnestChannelEncoding {
     BufferPtr indices;
     BufferPtr nulls;
-    bool identityMapping;
+
+    // Set if the output is a contiguous range of the elements starting at
+    // this offset. 'indices' and 'nulls' are not set in this case.
+    std::optional<vector_size_t> contiguousOffset;
 
     VectorPtr wrap(const VectorPtr& base, vector_size_t wrapSize) const;
   };
@@ -69,15 +95,10 @@ class Unnest : public Operator {
   // Array or Map.
   const UnnestChannelEncoding generateEncodingForChannel(
       column_index_t channel,
-      vector_size_t start,
-      vector_size_t size,
-      vector_size_t numElements);
+      const RowRange& range);
 
   // Invoked by generateOutput for the ordinality column.
-  VectorPtr generateOrdinalityVector(
-      vector_size_t start,
-      vector_size_t size,
-      vector_size_t numElements);
+  VectorPtr generateOrdinalityVector(const RowRange& range);
 
   const bool withOrdinality_;
   std::vector<column_index_t> unnestChannels_;
@@ -93,5 +114,9 @@ class Unnest : public Operator {
 
   // Next 'input_' row to process in getOutput().
   vector_size_t nextInputRow_{0};
+
+  // First element of 'nextInputRow_' to process in getOutput(). Non-zero if
+  // the row was partially unnested into the previous output batch.
+  vector_size_t nextElement_{0};
 };
 } // namespace facebook::velox::exec
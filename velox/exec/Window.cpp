@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "velox/exec/Window.h"
+#include "velox/common/base/AsyncSource.h"
 #include "velox/exec/OperatorUtils.h"
 #include "velox/exec/SortWindowBuild.h"
 #include "velox/exec/StreamingWindowBuild.h"
@@ -35,9 +36,7 @@ Window::Window(
               ? driverCtx->makeSpillConfig(operatorId)
               : std::nullopt),
       numInputColumns_(windowNode->inputType()->size()),
-      windowNode_(windowNode),
-      currentPartition_(nullptr),
-      stringAllocator_(pool()) {
+      windowNode_(windowNode) {
   auto* spillConfig =
       spillConfig_.has_value() ? &spillConfig_.value() : nullptr;
   if (windowNode->inputsSorted()) {
@@ -52,11 +51,46 @@ Window::Window(
 void Window::initialize() {
   Operator::initialize();
   VELOX_CHECK_NOT_NULL(windowNode_);
-  createWindowFunctions();
-  createPeerAndFrameBuffers();
+  VELOX_CHECK(evaluators_.empty());
+
+  // Partitions are evaluated in parallel only with a sort based WindowBuild,
+  // which has all the partitions in memory once the input is complete.
+  uint32_t numEvaluators = 1;
+  if (!windowNode_->inputsSorted() &&
+      operatorCtx_->task()->queryCtx()->executor() != nullptr) {
+    const auto& queryConfig = operatorCtx_->driverCtx()->queryConfig();
+    numEvaluators =
+        std::max<uint32_t>(1, queryConfig.windowPartitionParallelism());
+  }
+
+  // TODO: This computation needs to be revised. It only takes into account
+  // the input columns size. We need to also account for the output columns.
+  numRowsPerOutput_ = outputBatchRows(windowBuild_->estimateRowSize());
+
+  evaluators_.reserve(numEvaluators);
+  for (uint32_t i = 0; i < numEvaluators; ++i) {
+    evaluators_.push_back(
+        std::make_unique<PartitionEvaluator>(numInputColumns_, pool()));
+    createWindowFunctions(*evaluators_.back());
+    evaluators_.back()->createPeerAndFrameBuffers(numRowsPerOutput_);
+  }
   windowNode_.reset();
 }
 
+Window::PartitionEvaluator::PartitionEvaluator(
+    vector_size_t numInputColumns,
+    velox::memory::MemoryPool* pool)
+    : numInputColumns_(numInputColumns),
+      pool_(pool),
+      stringAllocator_(pool) {}
+
+void Window::PartitionEvaluator::addFunction(
+    std::unique_ptr<exec::WindowFunction> function,
+    WindowFrame frame) {
+  windowFunctions_.push_back(std::move(function));
+  windowFrames_.push_back(std::move(frame));
+}
+
 namespace {
 void checkRowFrameBounds(const core::WindowNode::Frame& frame) {
   auto frameBoundCheck = [&](const core::TypedExprPtr& frameValue) -> void {
@@ -153,10 +187,8 @@ Window::WindowFrame Window::createWindowFrame(
        createFrameChannelArg(frame.endValue)});
 }
 
-void Window::createWindowFunctions() {
+void Window::createWindowFunctions(PartitionEvaluator& evaluator) {
   VELOX_CHECK_NOT_NULL(windowNode_);
-  VELOX_CHECK(windowFunctions_.empty());
-  VELOX_CHECK(windowFrames_.empty());
 
   const auto& inputType = windowNode_->sources()[0]->outputType();
   for (const auto& windowNodeFunction : windowNode_->windowFunctions()) {
@@ -173,16 +205,15 @@ void Window::createWindowFunctions() {
       }
     }
 
-    windowFunctions_.push_back(WindowFunction::create(
-        windowNodeFunction.functionCall->name(),
-        functionArgs,
-        windowNodeFunction.functionCall->type(),
-        windowNodeFunction.ignoreNulls,
-        operatorCtx_->pool(),
-        &stringAllocator_,
-        operatorCtx_->driverCtx()->queryConfig()));
-
-    windowFrames_.push_back(
+    evaluator.addFunction(
+        WindowFunction::create(
+            windowNodeFunction.functionCall->name(),
+            functionArgs,
+            windowNodeFunction.functionCall->type(),
+            windowNodeFunction.ignoreNulls,
+            operatorCtx_->pool(),
+            evaluator.stringAllocator(),
+            operatorCtx_->driverCtx()->queryConfig()),
         createWindowFrame(windowNode_, windowNodeFunction.frame, inputType));
   }
 }
@@ -211,15 +242,12 @@ void Window::reclaim(
   windowBuild_->spill();
 }
 
-void Window::createPeerAndFrameBuffers() {
-  // TODO: This computation needs to be revised. It only takes into account
-  // the input columns size. We need to also account for the output columns.
-  numRowsPerOutput_ = outputBatchRows(windowBuild_->estimateRowSize());
-
-  peerStartBuffer_ = AlignedBuffer::allocate<vector_size_t>(
-      numRowsPerOutput_, operatorCtx_->pool());
-  peerEndBuffer_ = AlignedBuffer::allocate<vector_size_t>(
-      numRowsPerOutput_, operatorCtx_->pool());
+void Window::PartitionEvaluator::createPeerAndFrameBuffers(
+    vector_size_t numRowsPerOutput) {
+  peerStartBuffer_ =
+      AlignedBuffer::allocate<vector_size_t>(numRowsPerOutput, pool_);
+  peerEndBuffer_ =
+      AlignedBuffer::allocate<vector_size_t>(numRowsPerOutput, pool_);
 
   auto numFuncs = windowFunctions_.size();
   frameStartBuffers_.reserve(numFuncs);
@@ -227,13 +255,13 @@ void Window::createPeerAndFrameBuffers() {
   validFrames_.reserve(numFuncs);
 
   for (auto i = 0; i < numFuncs; i++) {
-    BufferPtr frameStartBuffer = AlignedBuffer::allocate<vector_size_t>(
-        numRowsPerOutput_, operatorCtx_->pool());
-    BufferPtr frameEndBuffer = AlignedBuffer::allocate<vector_size_t>(
-        numRowsPerOutput_, operatorCtx_->pool());
+    BufferPtr frameStartBuffer =
+        AlignedBuffer::allocate<vector_size_t>(numRowsPerOutput, pool_);
+    BufferPtr frameEndBuffer =
+        AlignedBuffer::allocate<vector_size_t>(numRowsPerOutput, pool_);
     frameStartBuffers_.push_back(frameStartBuffer);
     frameEndBuffers_.push_back(frameEndBuffer);
-    validFrames_.push_back(SelectivityVector(numRowsPerOutput_));
+    validFrames_.push_back(SelectivityVector(numRowsPerOutput));
   }
 }
 
@@ -242,19 +270,26 @@ void Window::noMoreInput() {
   windowBuild_->noMoreInput();
 }
 
-void Window::callResetPartition() {
+void Window::PartitionEvaluator::resetPartition(
+    std::unique_ptr<WindowPartition> partition) {
   partitionOffset_ = 0;
   peerStartRow_ = 0;
   peerEndRow_ = 0;
-  currentPartition_ = nullptr;
-  if (windowBuild_->hasNextPartition()) {
-    currentPartition_ = windowBuild_->nextPartition();
+  partition_ = std::move(partition);
+  if (partition_ != nullptr) {
     for (int i = 0; i < windowFunctions_.size(); i++) {
-      windowFunctions_[i]->resetPartition(currentPartition_.get());
+      windowFunctions_[i]->resetPartition(partition_.get());
     }
   }
 }
 
+std::unique_ptr<WindowPartition> Window::nextBuildPartition() {
+  if (!windowBuild_->hasNextPartition()) {
+    return nullptr;
+  }
+  return windowBuild_->nextPartition();
+}
+
 namespace {
 
 template <typename T>
@@ -296,7 +331,7 @@ void updateKRowsOffsetsColumn(
 
 } // namespace
 
-void Window::updateKRowsFrameBounds(
+void Window::PartitionEvaluator::updateKRowsFrameBounds(
     bool isKPreceding,
     const FrameChannelArg& frameArg,
     vector_size_t startRow,
@@ -342,7 +377,7 @@ void Window::updateKRowsFrameBounds(
     }
     std::iota(rawFrameBounds, rawFrameBounds + numRows, startValue);
   } else {
-    currentPartition_->extractColumn(
+    partition_->extractColumn(
         frameArg.index, partitionOffset_, numRows, 0, frameArg.value);
     if (frameArg.value->typeKind() == TypeKind::INTEGER) {
       updateKRowsOffsetsColumn<int32_t>(
@@ -354,7 +389,7 @@ void Window::updateKRowsFrameBounds(
   }
 }
 
-void Window::updateFrameBounds(
+void Window::PartitionEvaluator::updateFrameBounds(
     const WindowFrame& windowFrame,
     const bool isStartBound,
     const vector_size_t startRow,
@@ -373,7 +408,7 @@ void Window::updateFrameBounds(
       std::fill_n(rawFrameBounds, numRows, 0);
       break;
     case core::WindowNode::BoundType::kUnboundedFollowing:
-      std::fill_n(rawFrameBounds, numRows, currentPartition_->numRows() - 1);
+      std::fill_n(rawFrameBounds, numRows, partition_->numRows() - 1);
       break;
     case core::WindowNode::BoundType::kCurrentRow: {
       if (windowType == core::WindowNode::WindowType::kRange) {
@@ -391,7 +426,7 @@ void Window::updateFrameBounds(
         updateKRowsFrameBounds(
             true, frameArg.value(), startRow, numRows, rawFrameBounds);
       } else {
-        currentPartition_->computeKRangeFrameBounds(
+        partition_->computeKRangeFrameBounds(
             isStartBound,
             true,
             frameArg.value().index,
@@ -407,7 +442,7 @@ void Window::updateFrameBounds(
         updateKRowsFrameBounds(
             false, frameArg.value(), startRow, numRows, rawFrameBounds);
       } else {
-        currentPartition_->computeKRangeFrameBounds(
+        partition_->computeKRangeFrameBounds(
             isStartBound,
             false,
             frameArg.value().index,
@@ -458,7 +493,7 @@ void computeValidFrames(
 
 } // namespace
 
-void Window::computePeerAndFrameBuffers(
+void Window::PartitionEvaluator::computePeerAndFrameBuffers(
     vector_size_t startRow,
     vector_size_t endRow) {
   vector_size_t numRows = endRow - startRow;
@@ -485,7 +520,7 @@ void Window::computePeerAndFrameBuffers(
     rawFrameEnds.push_back(rawFrameEnd);
   }
 
-  std::tie(peerStartRow_, peerEndRow_) = currentPartition_->computePeerBuffers(
+  std::tie(peerStartRow_, peerEndRow_) = partition_->computePeerBuffers(
       startRow, endRow, peerStartRow_, peerEndRow_, rawPeerStarts, rawPeerEnds);
 
   for (auto i = 0; i < numFuncs; i++) {
@@ -517,7 +552,7 @@ void Window::computePeerAndFrameBuffers(
       // Ranking functions do not care about frames. So the function decides
       // further what to do with empty frames.
       computeValidFrames(
-          currentPartition_->numRows() - 1,
+          partition_->numRows() - 1,
           numRows,
           rawFrameStarts[i],
           rawFrameEnds[i],
@@ -526,23 +561,24 @@ void Window::computePeerAndFrameBuffers(
   }
 }
 
-void Window::getInputColumns(
+void Window::PartitionEvaluator::getInputColumns(
     vector_size_t startRow,
     vector_size_t endRow,
     vector_size_t resultOffset,
     const RowVectorPtr& result) {
   auto numRows = endRow - startRow;
   for (int i = 0; i < numInputColumns_; ++i) {
-    currentPartition_->extractColumn(
+    partition_->extractColumn(
         i, partitionOffset_, numRows, resultOffset, result->childAt(i));
   }
 }
 
-void Window::callApplyForPartitionRows(
-    vector_size_t startRow,
-    vector_size_t endRow,
+void Window::PartitionEvaluator::apply(
+    vector_size_t numRows,
     vector_size_t resultOffset,
     const RowVectorPtr& result) {
+  const auto startRow = partitionOffset_;
+  const auto endRow = partitionOffset_ + numRows;
   getInputColumns(startRow, endRow, resultOffset, result);
 
   computePeerAndFrameBuffers(startRow, endRow);
@@ -558,12 +594,12 @@ void Window::callApplyForPartitionRows(
         result->childAt(numInputColumns_ + w));
   }
 
-  vector_size_t numRows = endRow - startRow;
-  numProcessedRows_ += numRows;
   partitionOffset_ += numRows;
 }
 
 vector_size_t Window::callApplyLoop(
+    PartitionEvaluator& evaluator,
+    const PartitionSource& nextPartition,
     vector_size_t numOutputRows,
     const RowVectorPtr& result) {
   // Compute outputs by traversing as many partitions as possible. This
@@ -571,36 +607,27 @@ vector_size_t Window::callApplyLoop(
   vector_size_t resultIndex = 0;
   vector_size_t numOutputRowsLeft = numOutputRows;
 
-  // This function requires that the currentPartition_ is available for output.
-  VELOX_DCHECK_NOT_NULL(currentPartition_);
+  // This function requires that the evaluator has a partition for output.
+  VELOX_DCHECK(evaluator.hasPartition());
   while (numOutputRowsLeft > 0) {
-    auto rowsForCurrentPartition =
-        currentPartition_->numRows() - partitionOffset_;
+    auto rowsForCurrentPartition = evaluator.numRemainingRows();
     if (rowsForCurrentPartition <= numOutputRowsLeft) {
       // Current partition can fit completely in the output buffer.
       // So output all its rows.
-      callApplyForPartitionRows(
-          partitionOffset_,
-          partitionOffset_ + rowsForCurrentPartition,
-          resultIndex,
-          result);
+      evaluator.apply(rowsForCurrentPartition, resultIndex, result);
       resultIndex += rowsForCurrentPartition;
       numOutputRowsLeft -= rowsForCurrentPartition;
-      callResetPartition();
-      if (!currentPartition_) {
-        // The WindowBuild doesn't have any more partitions to process right
-        // now. So break until the next getOutput call.
+      evaluator.resetPartition(nextPartition());
+      if (!evaluator.hasPartition()) {
+        // There are no more partitions to process right now. So break until
+        // the next getOutput call.
         break;
       }
     } else {
       // Current partition can fit only partially in the output buffer.
       // Call apply for the rows that can fit in the buffer and break from
       // outputting.
-      callApplyForPartitionRows(
-          partitionOffset_,
-          partitionOffset_ + numOutputRowsLeft,
-          resultIndex,
-          result);
+      evaluator.apply(numOutputRowsLeft, resultIndex, result);
       numOutputRowsLeft = 0;
       break;
     }
@@ -610,6 +637,96 @@ vector_size_t Window::callApplyLoop(
   return numOutputRows - numOutputRowsLeft;
 }
 
+bool Window::canEvaluatePartitionsInParallel() const {
+  return evaluators_.size() > 1 && noMoreInput_ &&
+      !evaluators_[0]->hasPartition() &&
+      windowBuild_->supportsParallelPartitions();
+}
+
+std::vector<RowVectorPtr> Window::evaluatePartitions(
+    PartitionEvaluator& evaluator,
+    std::vector<std::unique_ptr<WindowPartition>>& partitions) {
+  vector_size_t numRows = 0;
+  for (const auto& partition : partitions) {
+    numRows += partition->numRows();
+  }
+
+  size_t nextIndex = 0;
+  const PartitionSource nextPartition =
+      [&]() -> std::unique_ptr<WindowPartition> {
+    if (nextIndex == partitions.size()) {
+      return nullptr;
+    }
+    return std::move(partitions[nextIndex++]);
+  };
+
+  std::vector<RowVectorPtr> output;
+  evaluator.resetPartition(nextPartition());
+  while (numRows > 0) {
+    const auto numOutputRows = std::min(numRowsPerOutput_, numRows);
+    auto result =
+        BaseVector::create<RowVector>(outputType_, numOutputRows, pool());
+    const auto numResultRows =
+        callApplyLoop(evaluator, nextPartition, numOutputRows, result);
+    VELOX_CHECK_EQ(numResultRows, numOutputRows);
+    output.push_back(std::move(result));
+    numRows -= numOutputRows;
+  }
+  VELOX_CHECK(!evaluator.hasPartition());
+  return output;
+}
+
+void Window::evaluatePartitionsInParallel() {
+  // Each group gets at least one output block worth of rows, so that small
+  // partitions are not output in small blocks.
+  std::vector<std::vector<std::unique_ptr<WindowPartition>>> groups;
+  while (groups.size() < evaluators_.size() &&
+         windowBuild_->hasNextPartition()) {
+    auto& group = groups.emplace_back();
+    vector_size_t numGroupRows = 0;
+    while (numGroupRows < numRowsPerOutput_ &&
+           windowBuild_->hasNextPartition()) {
+      group.push_back(windowBuild_->nextPartition());
+      numGroupRows += group.back()->numRows();
+    }
+  }
+
+  auto* executor = operatorCtx_->task()->queryCtx()->executor();
+  std::vector<std::shared_ptr<AsyncSource<std::vector<RowVectorPtr>>>> items;
+  items.reserve(groups.size());
+  std::exception_ptr error;
+  {
+    // Off-driver thread memory allocations might trigger memory arbitration,
+    // so suspend the driver while the partitions are evaluated.
+    SuspendedSection suspendedSection(driverThreadContext()->driverCtx.driver);
+    for (auto i = 0; i < groups.size(); ++i) {
+      items.push_back(std::make_shared<AsyncSource<std::vector<RowVectorPtr>>>(
+          [this, evaluator = evaluators_[i].get(), group = &groups[i]]() {
+            return std::make_unique<std::vector<RowVectorPtr>>(
+                evaluatePartitions(*evaluator, *group));
+          }));
+      executor->add([item = items.back()]() { item->prepare(); });
+    }
+
+    // All items must be consumed also in case of error because they reference
+    // 'groups' and the evaluators. The items not started on the executor yet
+    // are evaluated on this thread.
+    for (auto& item : items) {
+      try {
+        auto output = item->move();
+        for (auto& vector : *output) {
+          parallelOutput_.push_back(std::move(vector));
+        }
+      } catch (const std::exception&) {
+        error = std::current_exception();
+      }
+    }
+  }
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+
 RowVectorPtr Window::getOutput() {
   if (numRows_ == 0) {
     return nullptr;
@@ -620,9 +737,23 @@ RowVectorPtr Window::getOutput() {
     return nullptr;
   }
 
-  if (!currentPartition_) {
-    callResetPartition();
-    if (!currentPartition_) {
+  if (parallelOutput_.empty() && canEvaluatePartitionsInParallel()) {
+    evaluatePartitionsInParallel();
+  }
+  if (!parallelOutput_.empty()) {
+    auto result = std::move(parallelOutput_.front());
+    parallelOutput_.pop_front();
+    numProcessedRows_ += result->size();
+    return result;
+  }
+
+  auto& evaluator = *evaluators_[0];
+  const PartitionSource nextPartition = [this]() {
+    return nextBuildPartition();
+  };
+  if (!evaluator.hasPartition()) {
+    evaluator.resetPartition(nextPartition());
+    if (!evaluator.hasPartition()) {
       // WindowBuild doesn't have a partition to output.
       return nullptr;
     }
@@ -633,7 +764,9 @@ RowVectorPtr Window::getOutput() {
       outputType_, numOutputRows, operatorCtx_->pool());
 
   // Compute the output values of window functions.
-  auto numResultRows = callApplyLoop(numOutputRows, result);
+  auto numResultRows =
+      callApplyLoop(evaluator, nextPartition, numOutputRows, result);
+  numProcessedRows_ += numResultRows;
   return numResultRows < numOutputRows
       ? std::dynamic_pointer_cast<RowVector>(result->slice(0, numResultRows))
       : result;
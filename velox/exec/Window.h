@@ -88,8 +88,148 @@ class Window : public Operator {
     const std::optional<FrameChannelArg> end;
   };
 
-  // Creates WindowFunction and frame objects for this operator.
-  void createWindowFunctions();
+  // Holds the window functions of the operator together with the state
+  // needed to evaluate them over one partition at a time. The operator uses a
+  // single evaluator unless partitions are evaluated in parallel, in which
+  // case each concurrently processed group of partitions gets its own
+  // evaluator since neither the functions nor their buffers are thread-safe.
+  class PartitionEvaluator {
+   public:
+    PartitionEvaluator(
+        vector_size_t numInputColumns,
+        velox::memory::MemoryPool* pool);
+
+    HashStringAllocator* stringAllocator() {
+      return &stringAllocator_;
+    }
+
+    void addFunction(
+        std::unique_ptr<exec::WindowFunction> function,
+        WindowFrame frame);
+
+    // Creates the buffers for peer and frame row indices to send in window
+    // function apply invocations.
+    void createPeerAndFrameBuffers(vector_size_t numRowsPerOutput);
+
+    // Updates all the state for 'partition'. 'partition' is nullptr if there
+    // is no partition to process.
+    void resetPartition(std::unique_ptr<WindowPartition> partition);
+
+    bool hasPartition() const {
+      return partition_ != nullptr;
+    }
+
+    // Returns the number of rows of the current partition not output yet.
+    vector_size_t numRemainingRows() const {
+      return partition_->numRows() - partitionOffset_;
+    }
+
+    // Computes the result vector for the next 'numRows' rows of the current
+    // partition. A single partition could span multiple output blocks and a
+    // single output block could also have multiple partitions in it. So
+    // resultOffset is the offset in the result vector corresponding to the
+    // current range of partition rows.
+    void apply(
+        vector_size_t numRows,
+        vector_size_t resultOffset,
+        const RowVectorPtr& result);
+
+   private:
+    // Compute the peer and frame buffers for rows between
+    // startRow and endRow in the current partition.
+    void computePeerAndFrameBuffers(
+        vector_size_t startRow,
+        vector_size_t endRow);
+
+    // Gets the input columns of the current window partition
+    // between startRow and endRow in result at resultOffset.
+    void getInputColumns(
+        vector_size_t startRow,
+        vector_size_t endRow,
+        vector_size_t resultOffset,
+        const RowVectorPtr& result);
+
+    // Update frame bounds for kPreceding, kFollowing row frames.
+    void updateKRowsFrameBounds(
+        bool isKPreceding,
+        const FrameChannelArg& frameArg,
+        vector_size_t startRow,
+        vector_size_t numRows,
+        vector_size_t* rawFrameBounds);
+
+    void updateFrameBounds(
+        const WindowFrame& windowFrame,
+        const bool isStartBound,
+        const vector_size_t startRow,
+        const vector_size_t numRows,
+        const vector_size_t* rawPeerStarts,
+        const vector_size_t* rawPeerEnds,
+        vector_size_t* rawFrameBounds);
+
+    const vector_size_t numInputColumns_;
+
+    velox::memory::MemoryPool* const pool_;
+
+    // HashStringAllocator required by functions that allocate out of line
+    // buffers.
+    HashStringAllocator stringAllocator_;
+
+    // Vector of WindowFunction objects required by this operator.
+    // WindowFunction is the base API implemented by all the window functions.
+    // The functions are ordered by their positions in the output columns.
+    std::vector<std::unique_ptr<exec::WindowFunction>> windowFunctions_;
+
+    // Vector of WindowFrames corresponding to each windowFunction above.
+    // It represents the frame spec for the function computation.
+    std::vector<WindowFrame> windowFrames_;
+
+    // Used to access window partition rows and columns by the window
+    // operator and functions. This structure is owned by the WindowBuild.
+    std::unique_ptr<WindowPartition> partition_;
+
+    // The following 4 Buffers are used to pass peer and frame start and
+    // end values to the WindowFunction::apply method. These
+    // buffers can be allocated once and reused across all the getOutput
+    // calls.
+    // Only a single peer start and peer end buffer is needed across all
+    // functions (as the peer values are based on the ORDER BY clause).
+    BufferPtr peerStartBuffer_;
+    BufferPtr peerEndBuffer_;
+    // A separate BufferPtr is required for the frame indexes of each
+    // function. Each function has its own frame clause and style. So we
+    // have as many buffers as the number of functions.
+    std::vector<BufferPtr> frameStartBuffers_;
+    std::vector<BufferPtr> frameEndBuffers_;
+
+    // Frame types for kPreceding or kFollowing could result in empty
+    // frames if the frameStart > frameEnds, or frameEnds < firstPartitionRow
+    // or frameStarts > lastPartitionRow. Such frames usually evaluate to NULL
+    // in the window function.
+    // This SelectivityVector captures the valid (non-empty) frames in the
+    // buffer being worked on. The window function can use this to compute
+    // output values.
+    // There is one SelectivityVector per window function.
+    std::vector<SelectivityVector> validFrames_;
+
+    // Tracks how far along the partition rows have been output.
+    vector_size_t partitionOffset_ = 0;
+
+    // When traversing input partition rows, the peers are the rows
+    // with the same values for the ORDER BY clause. These rows
+    // are equal in some ways and affect the results of ranking functions.
+    // Since all rows between the peerStartRow_ and peerEndRow_ have the same
+    // values for peerStartRow_ and peerEndRow_, we needn't compute
+    // them for each row independently. Since these rows might
+    // cross getOutput boundaries and be called in subsequent calls to
+    // computePeerBuffers they are saved here.
+    vector_size_t peerStartRow_ = 0;
+    vector_size_t peerEndRow_ = 0;
+  };
+
+  using PartitionSource = std::function<std::unique_ptr<WindowPartition>()>;
+
+  // Creates WindowFunction and frame objects for 'evaluator'.
+  void createWindowFunctions(PartitionEvaluator& evaluator);
 
   // Converts WindowNode::Frame to Window::WindowFrame.
   WindowFrame createWindowFrame(
@@ -97,61 +237,37 @@ class Window : public Operator {
       const core::WindowNode::Frame& frame,
       const RowTypePtr& inputType);
 
-  // Creates the buffers for peer and frame row
-  // indices to send in window function apply invocations.
-  void createPeerAndFrameBuffers();
-
-  // Compute the peer and frame buffers for rows between
-  // startRow and endRow in the current partition.
-  void computePeerAndFrameBuffers(vector_size_t startRow, vector_size_t endRow);
-
-  // Updates all the state for the next partition.
-  void callResetPartition();
-
-  // Computes the result vector for a subset of the current
-  // partition rows starting from startRow to endRow. A single partition
-  // could span multiple output blocks and a single output block could
-  // also have multiple partitions in it. So resultOffset is the
-  // offset in the result vector corresponding to the current range of
-  // partition rows.
-  void callApplyForPartitionRows(
-      vector_size_t startRow,
-      vector_size_t endRow,
-      vector_size_t resultOffset,
-      const RowVectorPtr& result);
-
-  // Gets the input columns of the current window partition
-  // between startRow and endRow in result at resultOffset.
-  void getInputColumns(
-      vector_size_t startRow,
-      vector_size_t endRow,
-      vector_size_t resultOffset,
-      const RowVectorPtr& result);
+  // Returns the next partition of 'windowBuild_' or nullptr if none is
+  // available.
+  std::unique_ptr<WindowPartition> nextBuildPartition();
 
   // Computes the result vector for a single output block. The result
   // consists of all the input columns followed by the results of the
-  // window function.
+  // window function. Partitions following the current one of 'evaluator'
+  // are taken from 'nextPartition'.
   // @return The number of rows processed in the loop.
   vector_size_t callApplyLoop(
+      PartitionEvaluator& evaluator,
+      const PartitionSource& nextPartition,
       vector_size_t numOutputRows,
       const RowVectorPtr& result);
 
-  // Update frame bounds for kPreceding, kFollowing row frames.
-  void updateKRowsFrameBounds(
-      bool isKPreceding,
-      const FrameChannelArg& frameArg,
-      vector_size_t startRow,
-      vector_size_t numRows,
-      vector_size_t* rawFrameBounds);
-
-  void updateFrameBounds(
-      const WindowFrame& windowFrame,
-      const bool isStartBound,
-      const vector_size_t startRow,
-      const vector_size_t numRows,
-      const vector_size_t* rawPeerStarts,
-      const vector_size_t* rawPeerEnds,
-      vector_size_t* rawFrameBounds);
+  // Returns true if the remaining partitions can be evaluated in parallel.
+  // This requires more than one evaluator and a WindowBuild that has all its
+  // partitions in memory.
+  bool canEvaluatePartitionsInParallel() const;
+
+  // Takes the next partitions from 'windowBuild_', splits them into up to one
+  // group of consecutive partitions per evaluator and evaluates the groups
+  // concurrently on the query executor. The output of the groups is appended
+  // to 'parallelOutput_' in partition order.
+  void evaluatePartitionsInParallel();
+
+  // Evaluates 'partitions' with 'evaluator' into output blocks of at most
+  // 'numRowsPerOutput_' rows.
+  std::vector<RowVectorPtr> evaluatePartitions(
+      PartitionEvaluator& evaluator,
+      std::vector<std::unique_ptr<WindowPartition>>& partitions);
 
   const vector_size_t numInputColumns_;
 
@@ -163,46 +279,14 @@ class Window : public Operator {
   // reset after the initialization.
   std::shared_ptr<const core::WindowNode> windowNode_;
 
-  // Used to access window partition rows and columns by the window
-  // operator and functions. This structure is owned by the WindowBuild.
-  std::unique_ptr<WindowPartition> currentPartition_;
-
-  // HashStringAllocator required by functions that allocate out of line
-  // buffers.
-  HashStringAllocator stringAllocator_;
-
-  // Vector of WindowFunction objects required by this operator.
-  // WindowFunction is the base API implemented by all the window functions.
-  // The functions are ordered by their positions in the output columns.
-  std::vector<std::unique_ptr<exec::WindowFunction>> windowFunctions_;
-
-  // Vector of WindowFrames corresponding to each windowFunction above.
-  // It represents the frame spec for the function computation.
-  std::vector<WindowFrame> windowFrames_;
-
-  // The following 4 Buffers are used to pass peer and frame start and
-  // end values to the WindowFunction::apply method. These
-  // buffers can be allocated once and reused across all the getOutput
-  // calls.
-  // Only a single peer start and peer end buffer is needed across all
-  // functions (as the peer values are based on the ORDER BY clause).
-  BufferPtr peerStartBuffer_;
-  BufferPtr peerEndBuffer_;
-  // A separate BufferPtr is required for the frame indexes of each
-  // function. Each function has its own frame clause and style. So we
-  // have as many buffers as the number of functions.
-  std::vector<BufferPtr> frameStartBuffers_;
-  std::vector<BufferPtr> frameEndBuffers_;
-
-  // Frame types for kPreceding or kFollowing could result in empty
-  // frames if the frameStart > frameEnds, or frameEnds < firstPartitionRow
-  // or frameStarts > lastPartitionRow. Such frames usually evaluate to NULL
-  // in the window function.
-  // This SelectivityVector captures the valid (non-empty) frames in the
-  // buffer being worked on. The window function can use this to compute
-  // output values.
-  // There is one SelectivityVector per window function.
-  std::vector<SelectivityVector> validFrames_;
+  // Evaluators of the window functions. The first one is used for serial
+  // output. There is more than one only if 'window_partition_parallelism' is
+  // set for a sort based WindowBuild.
+  std::vector<std::unique_ptr<PartitionEvaluator>> evaluators_;
+
+  // Output blocks produced by evaluatePartitionsInParallel() and not returned
+  // yet.
+  std::deque<RowVectorPtr> parallelOutput_;
 
   // Number of input rows.
   vector_size_t numRows_ = 0;
@@ -212,23 +296,8 @@ class Window : public Operator {
 
   // Number of rows output from the WindowOperator so far. The rows
   // are output in the same order of the pointers in sortedRows. This
-  // value is updated as the WindowFunction::apply() function is
-  // called on the partition blocks.
+  // value is updated as output blocks are returned from getOutput().
   vector_size_t numProcessedRows_ = 0;
-
-  // Tracks how far along the partition rows have been output.
-  vector_size_t partitionOffset_ = 0;
-
-  // When traversing input partition rows, the peers are the rows
-  // with the same values for the ORDER BY clause. These rows
-  // are equal in some ways and affect the results of ranking functions.
-  // Since all rows between the peerStartRow_ and peerEndRow_ have the same
-  // values for peerStartRow_ and peerEndRow_, we needn't compute
-  // them for each row independently. Since these rows might
-  // cross getOutput boundaries and be called in subsequent calls to
-  // computePeerBuffers they are saved here.
-  vector_size_t peerStartRow_ = 0;
-  vector_size_t peerEndRow_ = 0;
 };
 
 } // namespace facebook::velox::exec
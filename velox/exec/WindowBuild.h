@@ -70,6 +70,14 @@ class WindowBuild {
   // if called when no partition is available.
   virtual std::unique_ptr<WindowPartition> nextPartition() = 0;
 
+  // Returns true if all the remaining partitions are in memory and the
+  // partitions returned by nextPartition() stay valid while the following
+  // ones are taken. The Window operator can then process several partitions
+  // concurrently. Only called after noMoreInput().
+  virtual bool supportsParallelPartitions() const {
+    return false;
+  }
+
   // Returns the average size of input rows in bytes stored in the
   // data container of the WindowBuild.
   std::optional<int64_t> estimateRowSize() {
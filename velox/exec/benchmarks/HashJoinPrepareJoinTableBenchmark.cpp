@@ -36,18 +36,24 @@ struct HashTableBenchmarkParams {
   //  -the build row schema,
   //  -the expected hash table size,
   //  -number of building rows,
-  //  -number of build RowContainers.
+  //  -number of build RowContainers,
+  //  -number of dependent (non-key) columns,
+  //  -whether the table keeps rows with duplicate keys.
   HashTableBenchmarkParams(
       BaseHashTable::HashMode mode,
       const TypePtr& buildType,
       int64_t hashTableSize,
       int64_t buildSize,
-      int32_t numWays)
+      int32_t numWays,
+      int32_t numDependents = 0,
+      bool allowDuplicates = true)
       : mode{mode},
         buildType{buildType},
         hashTableSize{hashTableSize},
         buildSize{buildSize},
-        numWays{numWays} {
+        numWays{numWays},
+        numDependents{numDependents},
+        allowDuplicates{allowDuplicates} {
     VELOX_CHECK_LE(hashTableSize, buildSize);
     VELOX_CHECK_GE(numWays, 1);
 
@@ -71,6 +77,10 @@ struct HashTableBenchmarkParams {
         numWays > 1,
         buildSize > hashTableSize,
         BaseHashTable::modeString(mode));
+    if (numDependents > 0 || !allowDuplicates) {
+      title += fmt::format(
+          ",dependents:{},keepDup:{}", numDependents, allowDuplicates);
+    }
   }
 
   // Expected mode.
@@ -88,6 +98,13 @@ struct HashTableBenchmarkParams {
   // Number of build RowContainers.
   int32_t numWays;
 
+  // Number of BIGINT dependent columns stored after the keys.
+  int32_t numDependents{0};
+
+  // False for the key only tables of semi and anti joins without a filter,
+  // which drop rows with duplicate keys.
+  bool allowDuplicates{true};
+
   // Title for reporting
   std::string title;
 
@@ -163,6 +180,10 @@ class HashJoinPrepareJoinTableBenchmark : public VectorTestBase {
       makeData();
       children.push_back(makeFlatVector<int64_t>(data));
     }
+    for (int32_t i = 0; i < params_.numDependents; ++i) {
+      children.push_back(
+          makeFlatVector<int64_t>(numKeys, [](auto row) { return row; }));
+    }
     return makeRowVector(children);
   }
 
@@ -186,7 +207,7 @@ class HashJoinPrepareJoinTableBenchmark : public VectorTestBase {
     auto numKeys = hashers.size();
     SelectivityVector rows(batchSize);
 
-    for (auto i = 0; i < batch->childrenSize(); ++i) {
+    for (auto i = 0; i < numKeys; ++i) {
       auto hasher = table->hashers()[i].get();
       hasher->decode(*batch->childAt(i), rows);
       if (table->hashMode() != BaseHashTable::HashMode::kHash &&
@@ -194,18 +215,28 @@ class HashJoinPrepareJoinTableBenchmark : public VectorTestBase {
         hasher->computeValueIds(rows, dummy);
       }
     }
+    std::vector<DecodedVector> dependents(params_.numDependents);
+    for (auto i = 0; i < params_.numDependents; ++i) {
+      dependents[i].decode(*batch->childAt(numKeys + i), rows);
+    }
     rows.applyToSelected([&](auto rowIndex) {
       char* newRow = rowContainer->newRow();
-      *reinterpret_cast<char**>(newRow + rowContainer->nextOffset()) = nullptr;
+      if (rowContainer->nextOffset() != 0) {
+        *reinterpret_cast<char**>(newRow + rowContainer->nextOffset()) =
+            nullptr;
+      }
       for (auto i = 0; i < numKeys; ++i) {
         rowContainer->store(hashers[i]->decodedVector(), rowIndex, newRow, i);
       }
+      for (auto i = 0; i < params_.numDependents; ++i) {
+        rowContainer->store(dependents[i], rowIndex, newRow, numKeys + i);
+      }
     });
   }
 
   // Create join table.
   void createTable() {
-    std::vector<TypePtr> dependentTypes;
+    std::vector<TypePtr> dependentTypes(params_.numDependents, BIGINT());
     std::vector<RowVectorPtr> batches;
     makeBuildBatches(batches);
     for (auto i = 0; i < params_.numWays; ++i) {
@@ -217,7 +248,7 @@ class HashJoinPrepareJoinTableBenchmark : public VectorTestBase {
       auto table = HashTable<true>::createForJoin(
           std::move(keyHashers),
           dependentTypes,
-          true,
+          params_.allowDuplicates,
           false,
           1'000,
           pool_.get());
@@ -296,6 +327,28 @@ void initHashModeBenchmarkParams(
     }
   }
 }
+// Semi and anti joins without a filter only store the join keys and drop
+// duplicate keys. Compare with a table that stores full rows.
+void initSemiJoinBenchmarkParams(
+    std::vector<HashTableBenchmarkParams>& params) {
+  TypePtr twoKeyType{ROW({"k1", "k2"}, {BIGINT(), BIGINT()})};
+  std::vector<int64_t> buildSizeVector = {100000, (2L << 20) - 3};
+  std::vector<int64_t> dupFactorVector = {1, 8};
+  for (auto buildSize : buildSizeVector) {
+    for (auto dupFactor : dupFactorVector) {
+      for (auto keyOnly : {false, true}) {
+        params.push_back(HashTableBenchmarkParams(
+            BaseHashTable::HashMode::kNormalizedKey,
+            twoKeyType,
+            buildSize / dupFactor,
+            buildSize,
+            1,
+            keyOnly ? 0 : 4,
+            !keyOnly));
+      }
+    }
+  }
+}
 } // namespace
 
 int main(int argc, char** argv) {
@@ -312,6 +365,7 @@ int main(int argc, char** argv) {
   // initArrayModeBenchmarkParams(params);
   initNormalizedKeyModeBenchmarkParams(params);
   initHashModeBenchmarkParams(params);
+  initSemiJoinBenchmarkParams(params);
 
   for (auto& param : params) {
     folly::addBenchmark(__FILE__, param.title, [param, &bm]() {
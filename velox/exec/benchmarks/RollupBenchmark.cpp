@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+
+#include "velox/exec/tests/utils/AssertQueryBuilder.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+#include "velox/functions/prestosql/aggregates/RegisterAggregateFunctions.h"
+#include "velox/functions/prestosql/registration/RegistrationFunctions.h"
+#include "velox/parse/TypeResolver.h"
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+/// Benchmark for ROLLUP aggregations modeled after TPC-DS queries like Q18,
+/// Q22, Q27, Q36 and Q67. Compares the GroupId + HashAggregation plan which
+/// replicates every input row once per grouping set with the aggregation over
+/// incremental grouping sets which aggregates the finest grouping set once and
+/// re-aggregates its intermediate results into the coarser grouping sets.
+///
+/// Each case rolls up 'numKeys' keys, producing 'numKeys' + 1 grouping sets,
+/// over 1M rows. The number of distinct values of the finest grouping set is
+/// controlled by the cardinality of the keys.
+
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+using namespace facebook::velox::test;
+
+namespace {
+
+class RollupBenchmark : public VectorTestBase {
+ public:
+  void makeBenchmark(
+      const std::string& name,
+      int32_t numKeys,
+      int32_t keyCardinality,
+      int32_t numVectors = 100,
+      int32_t rowsPerVector = 10'000) {
+    std::vector<RowVectorPtr> rows;
+    for (auto i = 0; i < numVectors; ++i) {
+      std::vector<VectorPtr> children;
+      for (auto key = 0; key < numKeys; ++key) {
+        children.push_back(
+            makeFlatVector<int64_t>(rowsPerVector, [&](auto /*row*/) {
+              return folly::Random::rand32(rng_) % keyCardinality;
+            }));
+      }
+      children.push_back(
+          makeFlatVector<int64_t>(rowsPerVector, [&](auto /*row*/) {
+            return folly::Random::rand32(rng_) % 1'000;
+          }));
+      children.push_back(
+          makeFlatVector<double>(rowsPerVector, [&](auto /*row*/) {
+            return folly::Random::randDouble01(rng_) * 100;
+          }));
+      rows.push_back(makeRowVector(std::move(children)));
+    }
+
+    std::vector<std::string> keys;
+    for (auto key = 0; key < numKeys; ++key) {
+      keys.push_back(fmt::format("c{}", key));
+    }
+    const auto quantity = fmt::format("c{}", numKeys);
+    const auto price = fmt::format("c{}", numKeys + 1);
+
+    // ROLLUP (c0, c1, ..., cN-1).
+    std::vector<std::vector<std::string>> groupingSets;
+    for (auto size = numKeys; size >= 0; --size) {
+      groupingSets.emplace_back(keys.begin(), keys.begin() + size);
+    }
+
+    auto groupingKeys = keys;
+    groupingKeys.push_back("group_id");
+    const std::vector<std::string> aggregates = {
+        fmt::format("sum({})", quantity),
+        fmt::format("avg({})", price),
+        fmt::format("max({})", price),
+        "count(1)"};
+
+    auto groupIdPlan = PlanBuilder()
+                           .values(rows)
+                           .groupId(keys, groupingSets, {quantity, price})
+                           .singleAggregation(groupingKeys, aggregates)
+                           .planNode();
+    auto incrementalPlan =
+        PlanBuilder()
+            .values(rows)
+            .groupId(keys, groupingSets, {quantity, price})
+            .incrementalGroupingSetsAggregation(groupingKeys, aggregates)
+            .planNode();
+
+    folly::addBenchmark(__FILE__, name + "_groupId", [groupIdPlan, this]() {
+      run(groupIdPlan);
+      return 1;
+    });
+    folly::addBenchmark(
+        __FILE__, "%" + name + "_incremental", [incrementalPlan, this]() {
+          run(incrementalPlan);
+          return 1;
+        });
+  }
+
+ private:
+  void run(const core::PlanNodePtr& plan) {
+    AssertQueryBuilder(plan).copyResults(pool_.get());
+  }
+
+  folly::Random::DefaultGenerator rng_;
+};
+} // namespace
+
+int main(int argc, char** argv) {
+  folly::Init init{&argc, &argv};
+  functions::prestosql::registerAllScalarFunctions();
+  aggregate::prestosql::registerAllAggregateFunctions();
+  parse::registerTypeResolver();
+
+  RollupBenchmark bm;
+
+  // Few groups: the finest grouping set is tiny compared to the input.
+  bm.makeBenchmark("rollup3_card10", 3, 10);
+  bm.makeBenchmark("rollup5_card5", 5, 5);
+
+  // Many groups: the finest grouping set is a large fraction of the input.
+  bm.makeBenchmark("rollup3_card100", 3, 100);
+  bm.makeBenchmark("rollup5_card20", 5, 20);
+
+  folly::runBenchmarks();
+  return 0;
+}
@@ -1325,6 +1325,165 @@ TEST_F(AggregationTest, groupingSets) {
       "SELECT k1, k2, count(1), sum(a), max(b) FROM tmp GROUP BY ROLLUP (k1, k2)");
 }
 
+TEST_F(AggregationTest, incrementalGroupingSets) {
+  vector_size_t size = 1'000;
+  auto data = makeRowVector(
+      {"k1", "k2", "k3", "a", "b"},
+      {
+          makeFlatVector<int64_t>(size, [](auto row) { return row % 3; }),
+          makeFlatVector<int64_t>(size, [](auto row) { return row % 7; }),
+          makeFlatVector<int64_t>(
+              size, [](auto row) { return row % 11; }, nullEvery(13)),
+          makeFlatVector<int64_t>(size, [](auto row) { return row; }),
+          makeFlatVector<std::string>(
+              size, [](auto row) { return std::string(row % 12, 'x'); }),
+      });
+
+  createDuckDbTable({data, data});
+
+  // Rollup.
+  auto plan =
+      PlanBuilder()
+          .values({data, data})
+          .groupId(
+              {"k1", "k2", "k3"},
+              {{"k1", "k2", "k3"}, {"k1", "k2"}, {"k1"}, {}},
+              {"a", "b"})
+          .incrementalGroupingSetsAggregation(
+              {"k1", "k2", "k3", "group_id"},
+              {"count(1) as count_1",
+               "sum(a) as sum_a",
+               "avg(a) as avg_a",
+               "max(b) as max_b"})
+          .project({"k1", "k2", "k3", "count_1", "sum_a", "avg_a", "max_b"})
+          .planNode();
+
+  assertQuery(
+      plan,
+      "SELECT k1, k2, k3, count(1), sum(a), avg(a), max(b) FROM tmp GROUP BY ROLLUP (k1, k2, k3)");
+
+  // Cube with a grouping key aliased to the same input column.
+  plan = PlanBuilder()
+             .values({data, data})
+             .groupId(
+                 {"k1", "k2", "k1 as k4"},
+                 {{"k1", "k2"}, {"k4"}, {"k2"}, {}},
+                 {"a"})
+             .incrementalGroupingSetsAggregation(
+                 {"k1", "k2", "k4", "group_id"}, {"sum(a) as sum_a"})
+             .project({"k1", "k2", "k4", "sum_a"})
+             .planNode();
+
+  assertQuery(
+      plan,
+      "SELECT k1, k2, null, sum(a) FROM tmp GROUP BY k1, k2 "
+      "UNION ALL "
+      "SELECT null, null, k1, sum(a) FROM tmp GROUP BY k1 "
+      "UNION ALL "
+      "SELECT null, k2, null, sum(a) FROM tmp GROUP BY k2 "
+      "UNION ALL "
+      "SELECT null, null, null, sum(a) FROM tmp");
+
+  // Masks are applied when aggregating the finest grouping set.
+  plan = PlanBuilder()
+             .values({data, data})
+             .project({"k1", "k2", "a", "a % 2 = 0 as mask_a"})
+             .groupId({"k1", "k2"}, {{"k1", "k2"}, {"k1"}}, {"a", "mask_a"})
+             .incrementalGroupingSetsAggregation(
+                 {"k1", "k2", "group_id"}, {"sum(a) as sum_a"}, {"mask_a"})
+             .project({"k1", "k2", "sum_a"})
+             .planNode();
+
+  assertQuery(
+      plan,
+      "SELECT k1, k2, sum(a) FILTER (WHERE a % 2 = 0) FROM tmp "
+      "GROUP BY GROUPING SETS ((k1, k2), (k1))");
+
+  // Partial aggregation followed by final aggregation.
+  plan =
+      PlanBuilder()
+          .values({data, data})
+          .groupId({"k1", "k2"}, {{"k1", "k2"}, {"k1"}, {}}, {"a"})
+          .incrementalGroupingSetsAggregation(
+              {"k1", "k2", "group_id"},
+              {"sum(a) as sum_a", "avg(a) as avg_a"},
+              {},
+              core::AggregationNode::Step::kPartial)
+          .finalAggregation()
+          .project({"k1", "k2", "sum_a", "avg_a"})
+          .planNode();
+
+  assertQuery(
+      plan,
+      "SELECT k1, k2, sum(a), avg(a) FROM tmp GROUP BY ROLLUP (k1, k2)");
+
+  // The partial aggregation flushes the grouping sets when the finest grouping
+  // set reaches the memory limit.
+  core::PlanNodeId aggNodeId;
+  plan = PlanBuilder()
+             .values({data, data})
+             .groupId({"k1", "k2"}, {{"k1", "k2"}, {"k1"}, {}}, {"a"})
+             .incrementalGroupingSetsAggregation(
+                 {"k1", "k2", "group_id"},
+                 {"sum(a) as sum_a", "avg(a) as avg_a"},
+                 {},
+                 core::AggregationNode::Step::kPartial)
+             .capturePlanNodeId(aggNodeId)
+             .finalAggregation()
+             .project({"k1", "k2", "sum_a", "avg_a"})
+             .planNode();
+  auto task = AssertQueryBuilder(plan, duckDbQueryRunner_)
+                  .config(QueryConfig::kMaxPartialAggregationMemory, 1)
+                  .assertResults(
+                      "SELECT k1, k2, sum(a), avg(a) FROM tmp "
+                      "GROUP BY ROLLUP (k1, k2)");
+  EXPECT_GT(
+      toPlanStats(task->taskStats())
+          .at(aggNodeId)
+          .customStats.at("flushTimes")
+          .sum,
+      1);
+
+  // A single aggregation that can spill is not fused with the GroupIdNode.
+  plan = PlanBuilder()
+             .values({data, data})
+             .groupId({"k1", "k2"}, {{"k1", "k2"}, {"k1"}, {}}, {"a"})
+             .incrementalGroupingSetsAggregation(
+                 {"k1", "k2", "group_id"}, {"sum(a) as sum_a"})
+             .project({"k1", "k2", "sum_a"})
+             .planNode();
+  auto spillDirectory = exec::test::TempDirectoryPath::create();
+  task = AssertQueryBuilder(plan, duckDbQueryRunner_)
+             .spillDirectory(spillDirectory->getPath())
+             .config(QueryConfig::kSpillEnabled, true)
+             .config(QueryConfig::kAggregationSpillEnabled, true)
+             .assertResults(
+                 "SELECT k1, k2, sum(a) FROM tmp GROUP BY ROLLUP (k1, k2)");
+  const auto& operatorStats = task->taskStats().pipelineStats[0].operatorStats;
+  ASSERT_EQ(operatorStats[1].operatorType, "GroupId");
+
+  // Empty input produces only the global grouping sets.
+  plan = PlanBuilder()
+             .values({data})
+             .filter("a < 0")
+             .groupId({"k1"}, {{"k1"}, {}}, {"a"})
+             .incrementalGroupingSetsAggregation(
+                 {"k1", "group_id"}, {"count(1) as count_1"})
+             .project({"k1", "count_1"})
+             .planNode();
+
+  assertQuery(plan, "SELECT null, 0");
+
+  // Distinct aggregates are not supported.
+  VELOX_ASSERT_THROW(
+      PlanBuilder()
+          .values({data})
+          .groupId({"k1"}, {{"k1"}, {}}, {"a"})
+          .incrementalGroupingSetsAggregation(
+              {"k1", "group_id"}, {"count(distinct a)"}),
+      "Incremental grouping sets do not support distinct or sorted aggregates");
+}
+
 TEST_F(AggregationTest, groupingSetsOutput) {
   vector_size_t size = 1'000;
   auto data = makeRowVector(
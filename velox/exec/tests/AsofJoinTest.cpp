@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/exec/tests/utils/AssertQueryBuilder.h"
+#include "velox/exec/tests/utils/OperatorTestBase.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+using namespace facebook::velox::exec::test;
+
+namespace {
+
+class AsofJoinTest : public OperatorTestBase {
+ protected:
+  // Returns 'numBatches' batches of 'batchSize' rows sorted on (k, ts).
+  // 'keyAt' and 'tsAt' generate the keys for a global row number.
+  std::vector<RowVectorPtr> makeSortedVectors(
+      const std::vector<std::string>& names,
+      int32_t numBatches,
+      vector_size_t batchSize,
+      std::function<int64_t(vector_size_t)> keyAt,
+      std::function<int64_t(vector_size_t)> tsAt,
+      std::function<bool(vector_size_t)> isNullAt) {
+    std::vector<RowVectorPtr> vectors;
+    for (auto i = 0; i < numBatches; ++i) {
+      const auto offset = i * batchSize;
+      vectors.push_back(makeRowVector(
+          names,
+          {
+              makeFlatVector<int64_t>(
+                  batchSize, [&](auto row) { return keyAt(offset + row); }),
+              makeFlatVector<int64_t>(
+                  batchSize,
+                  [&](auto row) { return tsAt(offset + row); },
+                  [&](auto row) { return isNullAt(offset + row); }),
+              makeFlatVector<int64_t>(
+                  batchSize, [&](auto row) { return offset + row; }),
+          }));
+    }
+    return vectors;
+  }
+
+  core::PlanNodePtr makePlan(
+      const std::vector<RowVectorPtr>& left,
+      const std::vector<RowVectorPtr>& right,
+      const std::vector<std::string>& leftKeys,
+      const std::vector<std::string>& rightKeys,
+      const std::string& asofCondition,
+      const std::vector<std::string>& outputLayout,
+      core::JoinType joinType) {
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    return PlanBuilder(planNodeIdGenerator)
+        .values(left)
+        .asofJoin(
+            leftKeys,
+            rightKeys,
+            asofCondition,
+            PlanBuilder(planNodeIdGenerator).values(right).planNode(),
+            outputLayout,
+            joinType)
+        .planNode();
+  }
+};
+
+TEST_F(AsofJoinTest, basic) {
+  auto trades = makeRowVector(
+      {"symbol", "ts", "price"},
+      {
+          makeFlatVector<StringView>({"A", "A", "A", "B", "B", "C"}),
+          makeFlatVector<int64_t>({1, 5, 10, 2, 3, 7}),
+          makeFlatVector<double>({10.0, 10.5, 11.0, 20.0, 20.5, 30.0}),
+      });
+  auto quotes = makeRowVector(
+      {"q_symbol", "q_ts", "bid"},
+      {
+          makeFlatVector<StringView>({"A", "A", "A", "B", "C"}),
+          makeFlatVector<int64_t>({2, 5, 9, 3, 8}),
+          makeFlatVector<double>({9.9, 10.4, 10.9, 20.4, 29.9}),
+      });
+
+  // Most recent quote at or before each trade.
+  auto plan = makePlan(
+      {trades},
+      {quotes},
+      {"symbol"},
+      {"q_symbol"},
+      "ts >= q_ts",
+      {"symbol", "ts", "price", "bid"},
+      core::JoinType::kLeft);
+  auto expected = makeRowVector({
+      makeFlatVector<StringView>({"A", "A", "A", "B", "B", "C"}),
+      makeFlatVector<int64_t>({1, 5, 10, 2, 3, 7}),
+      makeFlatVector<double>({10.0, 10.5, 11.0, 20.0, 20.5, 30.0}),
+      makeNullableFlatVector<double>(
+          {std::nullopt, 10.4, 10.9, std::nullopt, 20.4, std::nullopt}),
+  });
+  AssertQueryBuilder(plan).assertResults(expected);
+
+  plan = makePlan(
+      {trades},
+      {quotes},
+      {"symbol"},
+      {"q_symbol"},
+      "ts >= q_ts",
+      {"symbol", "ts", "price", "bid"},
+      core::JoinType::kInner);
+  expected = makeRowVector({
+      makeFlatVector<StringView>({"A", "A", "B"}),
+      makeFlatVector<int64_t>({5, 10, 3}),
+      makeFlatVector<double>({10.5, 11.0, 20.5}),
+      makeFlatVector<double>({10.4, 10.9, 20.4}),
+  });
+  AssertQueryBuilder(plan).assertResults(expected);
+
+  // First quote strictly after each trade.
+  plan = makePlan(
+      {trades},
+      {quotes},
+      {"symbol"},
+      {"q_symbol"},
+      "ts < q_ts",
+      {"symbol", "ts", "bid"},
+      core::JoinType::kLeft);
+  expected = makeRowVector({
+      makeFlatVector<StringView>({"A", "A", "A", "B", "B", "C"}),
+      makeFlatVector<int64_t>({1, 5, 10, 2, 3, 7}),
+      makeNullableFlatVector<double>(
+          {9.9, 10.9, std::nullopt, 20.4, std::nullopt, 29.9}),
+  });
+  AssertQueryBuilder(plan).assertResults(expected);
+}
+
+TEST_F(AsofJoinTest, multipleBatches) {
+  // Left: 10 rows per key, right: 7 rows per key with different timestamps.
+  // Both sides have null timestamps and span multiple batches.
+  auto left = makeSortedVectors(
+      {"k", "ts", "a"},
+      5,
+      37,
+      [](auto row) { return row / 10; },
+      [](auto row) { return row % 10 * 3; },
+      [](auto row) { return row % 17 == 0; });
+  auto right = makeSortedVectors(
+      {"uk", "uts", "b"},
+      4,
+      23,
+      [](auto row) { return row / 7; },
+      [](auto row) { return row % 7 * 4 + 1; },
+      [](auto row) { return row % 13 == 0; });
+  createDuckDbTable("t", left);
+  createDuckDbTable("u", right);
+
+  for (const auto* comparison : {">=", ">", "<=", "<"}) {
+    for (auto joinType : {core::JoinType::kInner, core::JoinType::kLeft}) {
+      SCOPED_TRACE(fmt::format("{} {}", joinTypeName(joinType), comparison));
+      auto plan = makePlan(
+          left,
+          right,
+          {"k"},
+          {"uk"},
+          fmt::format("ts {} uts", comparison),
+          {"k", "ts", "a", "uts", "b"},
+          joinType);
+      assertQuery(
+          plan,
+          fmt::format(
+              "SELECT k, ts, a, uts, b FROM t ASOF {} JOIN u "
+              "ON k = uk AND ts {} uts",
+              joinType == core::JoinType::kLeft ? "LEFT" : "",
+              comparison));
+    }
+  }
+}
+
+TEST_F(AsofJoinTest, noEqualityKeys) {
+  auto left = makeSortedVectors(
+      {"k", "ts", "a"},
+      3,
+      10,
+      [](auto /*row*/) { return 0; },
+      [](auto row) { return row * 5; },
+      [](auto /*row*/) { return false; });
+  auto right = makeSortedVectors(
+      {"uk", "uts", "b"},
+      2,
+      8,
+      [](auto /*row*/) { return 0; },
+      [](auto row) { return row * 7 + 3; },
+      [](auto /*row*/) { return false; });
+  createDuckDbTable("t", left);
+  createDuckDbTable("u", right);
+
+  auto plan = makePlan(
+      left,
+      right,
+      {},
+      {},
+      "ts >= uts",
+      {"ts", "a", "uts", "b"},
+      core::JoinType::kLeft);
+  assertQuery(
+      plan, "SELECT ts, a, uts, b FROM t ASOF LEFT JOIN u ON ts >= uts");
+}
+
+TEST_F(AsofJoinTest, emptyRightSide) {
+  auto left = makeRowVector(
+      {"k", "ts"},
+      {makeFlatVector<int64_t>({1, 2}), makeFlatVector<int64_t>({3, 4})});
+  auto right = makeRowVector(
+      {"uk", "uts"},
+      {makeFlatVector<int64_t>({}), makeFlatVector<int64_t>({})});
+
+  auto plan = makePlan(
+      {left},
+      {right},
+      {"k"},
+      {"uk"},
+      "ts >= uts",
+      {"k", "ts", "uts"},
+      core::JoinType::kLeft);
+  auto expected = makeRowVector({
+      makeFlatVector<int64_t>({1, 2}),
+      makeFlatVector<int64_t>({3, 4}),
+      makeNullConstant(TypeKind::BIGINT, 2),
+  });
+  AssertQueryBuilder(plan).assertResults(expected);
+
+  plan = makePlan(
+      {left},
+      {right},
+      {"k"},
+      {"uk"},
+      "ts >= uts",
+      {"k", "ts", "uts"},
+      core::JoinType::kInner);
+  AssertQueryBuilder(plan).assertEmptyResults();
+}
+
+TEST_F(AsofJoinTest, invalidPlan) {
+  auto left = makeRowVector(
+      {"k", "ts"},
+      {makeFlatVector<int64_t>({1}), makeFlatVector<int64_t>({1})});
+  auto right = makeRowVector(
+      {"uk", "uts"},
+      {makeFlatVector<int64_t>({1}), makeFlatVector<int32_t>({1})});
+
+  VELOX_ASSERT_THROW(
+      makePlan(
+          {left},
+          {right},
+          {"k"},
+          {"uk"},
+          "ts >= uk",
+          {"k", "ts"},
+          core::JoinType::kRight),
+      "AsofJoin only supports inner and left join");
+  VELOX_ASSERT_THROW(
+      makePlan(
+          {left},
+          {right},
+          {"k"},
+          {"uk"},
+          "ts >= uts",
+          {"k", "ts"},
+          core::JoinType::kInner),
+      "Join key types on the left and right sides must match");
+}
+
+} // namespace
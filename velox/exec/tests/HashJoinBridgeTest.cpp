@@ -18,6 +18,7 @@
 #include "velox/common/file/FileSystems.h"
 #include "velox/exec/HashTable.h"
 #include "velox/exec/Spill.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
 #include "velox/exec/tests/utils/TempDirectoryPath.h"
 
 using namespace facebook::velox;
@@ -614,4 +615,46 @@ TEST(HashJoinBridgeTest, hashJoinTableSpillType) {
     ASSERT_EQ(spillType->names(), testData.expectedTableSpillType->names());
   }
 }
+
+TEST(HashJoinBridgeTest, isKeyOnlyHashJoinTable) {
+  const auto probeType = ROW({"t0", "t1"}, {BIGINT(), BIGINT()});
+  const auto buildType = ROW({"u0", "u1"}, {BIGINT(), BIGINT()});
+  auto makeJoin = [&](core::JoinType joinType,
+                      const std::string& filter,
+                      const std::vector<std::string>& outputLayout) {
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    return std::dynamic_pointer_cast<const core::HashJoinNode>(
+        PlanBuilder(planNodeIdGenerator)
+            .tableScan(probeType)
+            .hashJoin(
+                {"t0"},
+                {"u0"},
+                PlanBuilder(planNodeIdGenerator)
+                    .tableScan(buildType)
+                    .planNode(),
+                filter,
+                outputLayout,
+                joinType)
+            .planNode());
+  };
+
+  ASSERT_TRUE(isKeyOnlyHashJoinTable(
+      makeJoin(core::JoinType::kLeftSemiFilter, "", {"t0", "t1"})));
+  ASSERT_TRUE(isKeyOnlyHashJoinTable(
+      makeJoin(core::JoinType::kLeftSemiProject, "", {"t0", "match"})));
+  ASSERT_TRUE(
+      isKeyOnlyHashJoinTable(makeJoin(core::JoinType::kAnti, "", {"t0"})));
+
+  // Filters may reference build side columns.
+  ASSERT_FALSE(isKeyOnlyHashJoinTable(
+      makeJoin(core::JoinType::kLeftSemiFilter, "u1 > t1", {"t0", "t1"})));
+  ASSERT_FALSE(isKeyOnlyHashJoinTable(
+      makeJoin(core::JoinType::kAnti, "u1 > t1", {"t0"})));
+
+  // Joins which output build side columns or need to track probed rows.
+  ASSERT_FALSE(isKeyOnlyHashJoinTable(
+      makeJoin(core::JoinType::kInner, "", {"t0", "u1"})));
+  ASSERT_FALSE(isKeyOnlyHashJoinTable(
+      makeJoin(core::JoinType::kRightSemiFilter, "", {"u0", "u1"})));
+}
 } // namespace facebook::velox::exec::test
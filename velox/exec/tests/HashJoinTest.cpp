@@ -3375,6 +3375,81 @@ TEST_F(HashJoinTest, duplicateJoinKeys) {
   }
 }
 
+TEST_F(HashJoinTest, dropDuplicatesOnInsert) {
+  const auto abandonedDedup = [](const std::shared_ptr<Task>& task) {
+    for (const auto& pipelineStats : task->taskStats().pipelineStats) {
+      for (const auto& operatorStats : pipelineStats.operatorStats) {
+        if (operatorStats.operatorType == "HashBuild" &&
+            operatorStats.runtimeStats.count(HashBuild::kAbandonedBuildDedup)) {
+          return true;
+        }
+      }
+    }
+    return false;
+  };
+
+  auto probeVectors = makeBatches(5, [&](int32_t batch) {
+    return makeRowVector(
+        {"t0"}, {makeFlatVector<int32_t>(1'000, [&](auto row) {
+          return batch * 1'000 + row;
+        })});
+  });
+  // All build batches have the same keys.
+  auto buildVectors = makeBatches(20, [&](int32_t /*unused*/) {
+    return makeRowVector(
+        {"u0"},
+        {makeFlatVector<int32_t>(1'000, [](auto row) { return row * 3; })});
+  });
+
+  const std::vector<std::pair<core::JoinType, std::string>> joins = {
+      {core::JoinType::kLeftSemiFilter,
+       "SELECT t.* FROM t WHERE t0 IN (SELECT u0 FROM u)"},
+      {core::JoinType::kAnti,
+       "SELECT t.* FROM t "
+       "WHERE NOT EXISTS (SELECT * FROM u WHERE u.u0 = t.t0)"},
+  };
+  for (const auto& [joinType, query] : joins) {
+    SCOPED_TRACE(core::joinTypeName(joinType));
+    HashJoinBuilder(*pool_, duckDbQueryRunner_, driverExecutor_.get())
+        .numDrivers(2)
+        .probeKeys({"t0"})
+        .probeVectors(std::vector<RowVectorPtr>(probeVectors))
+        .buildKeys({"u0"})
+        .buildVectors(std::vector<RowVectorPtr>(buildVectors))
+        .joinType(joinType)
+        .joinOutputLayout({"t0"})
+        .referenceQuery(query)
+        .verifier([&](const std::shared_ptr<Task>& task, bool /*hasSpill*/) {
+          ASSERT_FALSE(abandonedDedup(task));
+        })
+        .run();
+  }
+
+  // All build side keys are distinct. Dropping the duplicates on insert is
+  // abandoned and the result stays the same.
+  buildVectors = makeBatches(200, [&](int32_t batch) {
+    return makeRowVector(
+        {"u0"}, {makeFlatVector<int32_t>(1'000, [&](auto row) {
+          return (batch * 1'000 + row) * 3;
+        })});
+  });
+  HashJoinBuilder(*pool_, duckDbQueryRunner_, driverExecutor_.get())
+      .numDrivers(1)
+      .probeKeys({"t0"})
+      .probeVectors(std::vector<RowVectorPtr>(probeVectors))
+      .buildKeys({"u0"})
+      .buildVectors(std::vector<RowVectorPtr>(buildVectors))
+      .joinType(core::JoinType::kLeftSemiFilter)
+      .joinOutputLayout({"t0"})
+      .referenceQuery("SELECT t.* FROM t WHERE t0 IN (SELECT u0 FROM u)")
+      .verifier([&](const std::shared_ptr<Task>& task, bool hasSpill) {
+        if (!hasSpill) {
+          ASSERT_TRUE(abandonedDedup(task));
+        }
+      })
+      .run();
+}
+
 TEST_F(HashJoinTest, semiProject) {
   // Some keys have multiple rows: 2, 3, 5.
   auto probeVectors = makeBatches(3, [&](int32_t /*unused*/) {
@@ -7891,4 +7966,225 @@ TEST_F(HashJoinTest, nanKeys) {
        makeFlatVector<int64_t>({1, 2})});
   facebook::velox::test::assertEqualVectors(expected, result);
 }
+
+TEST_F(HashJoinTest, multiHashJoin) {
+  auto probeVectors = makeBatches(5, [&](int32_t batch) {
+    return makeRowVector(
+        {"t0", "t1", "t2", "t3"},
+        {
+            makeFlatVector<int64_t>(
+                1'000, [&](auto row) { return (batch + row) % 10; }),
+            makeFlatVector<int32_t>(
+                1'000, [](auto row) { return row % 7; }, nullEvery(11)),
+            makeFlatVector<int64_t>(1'000, [](auto row) { return row % 5; }),
+            makeFlatVector<int64_t>(
+                1'000, [&](auto row) { return batch * 1'000 + row; }),
+        });
+  });
+
+  // Unique keys.
+  std::vector<RowVectorPtr> uVectors = {makeRowVector(
+      {"u0", "u1"},
+      {
+          makeFlatVector<int64_t>({0, 1, 2, 3, 4, 5, 6, 7}),
+          makeFlatVector<int64_t>({0, 10, 20, 30, 40, 50, 60, 70}),
+      })};
+  // Duplicate keys.
+  std::vector<RowVectorPtr> vVectors = {makeRowVector(
+      {"v0", "v1"},
+      {
+          makeFlatVector<int32_t>({0, 0, 1, 2, 3, 3, 3, 5}),
+          makeFlatVector<int64_t>({0, 1, 10, 20, 30, 31, 32, 50}),
+      })};
+  std::vector<RowVectorPtr> wVectors = {makeRowVector(
+      {"w0", "w1"},
+      {
+          makeFlatVector<int64_t>({0, 1, 2, 3, 4}),
+          makeFlatVector<StringView>({"a", "b", "c", "d", "e"}),
+      })};
+
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", uVectors);
+  createDuckDbTable("v", vVectors);
+  createDuckDbTable("w", wVectors);
+
+  core::PlanNodeId firstJoinId;
+  core::PlanNodeId secondJoinId;
+  auto makePlan = [&](const std::string& wKey, core::PlanNodeId& lastJoinId) {
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    return PlanBuilder(planNodeIdGenerator)
+        .values(probeVectors, true)
+        .hashJoin(
+            {"t0"},
+            {"u0"},
+            PlanBuilder(planNodeIdGenerator).values(uVectors).planNode(),
+            "",
+            {"t0", "t1", "t2", "t3", "u1"})
+        .capturePlanNodeId(firstJoinId)
+        .hashJoin(
+            {"t1"},
+            {"v0"},
+            PlanBuilder(planNodeIdGenerator).values(vVectors).planNode(),
+            "",
+            {"t0", "t2", "t3", "u1", "v1"})
+        .capturePlanNodeId(secondJoinId)
+        .hashJoin(
+            {wKey},
+            {"w0"},
+            PlanBuilder(planNodeIdGenerator).values(wVectors).planNode(),
+            "",
+            {"t3", "u1", "v1", "w1"})
+        .capturePlanNodeId(lastJoinId)
+        .planNode();
+  };
+
+  // All joins probe with columns of 't' and are fused into one operator.
+  {
+    core::PlanNodeId lastJoinId;
+    auto task =
+        AssertQueryBuilder(makePlan("t2", lastJoinId), duckDbQueryRunner_)
+            .config(core::QueryConfig::kMultiHashJoinEnabled, "true")
+            .maxDrivers(4)
+            .assertResults(
+                "SELECT t3, u1, v1, w1 FROM t, u, v, w "
+                "WHERE t0 = u0 AND t1 = v0 AND t2 = w0");
+    auto planStats = toPlanStats(task->taskStats());
+    const auto& operatorStats = planStats.at(lastJoinId).operatorStats;
+    ASSERT_EQ(1, operatorStats.count("MultiHashProbe"));
+    ASSERT_EQ(0, operatorStats.count("HashProbe"));
+
+    // The first two joins report their stats under their own ids.
+    const auto& lastJoinStats = *operatorStats.at("MultiHashProbe");
+    const auto& firstJoinStats =
+        *planStats.at(firstJoinId).operatorStats.at("MultiHashProbe");
+    const auto& secondJoinStats =
+        *planStats.at(secondJoinId).operatorStats.at("MultiHashProbe");
+    ASSERT_EQ(0, planStats.at(firstJoinId).operatorStats.count("HashProbe"));
+    ASSERT_EQ(lastJoinStats.inputRows, firstJoinStats.inputRows);
+    ASSERT_GT(firstJoinStats.inputRows, firstJoinStats.outputRows);
+    ASSERT_EQ(firstJoinStats.outputRows, secondJoinStats.inputRows);
+    ASSERT_GT(secondJoinStats.outputRows, 0);
+    ASSERT_EQ(lastJoinStats.numDrivers, firstJoinStats.numDrivers);
+  }
+
+  // Small output batches. The matches of one input row span several batches.
+  {
+    core::PlanNodeId lastJoinId;
+    AssertQueryBuilder(makePlan("t2", lastJoinId), duckDbQueryRunner_)
+        .config(core::QueryConfig::kMultiHashJoinEnabled, "true")
+        .config(core::QueryConfig::kPreferredOutputBatchRows, "2")
+        .maxDrivers(2)
+        .assertResults(
+            "SELECT t3, u1, v1, w1 FROM t, u, v, w "
+            "WHERE t0 = u0 AND t1 = v0 AND t2 = w0");
+  }
+
+  // The last join probes with a build side column of the first join. Only the
+  // first two joins are fused.
+  {
+    core::PlanNodeId lastJoinId;
+    auto task =
+        AssertQueryBuilder(makePlan("u1", lastJoinId), duckDbQueryRunner_)
+            .config(core::QueryConfig::kMultiHashJoinEnabled, "true")
+            .maxDrivers(4)
+            .assertResults(
+                "SELECT t3, u1, v1, w1 FROM t, u, v, w "
+                "WHERE t0 = u0 AND t1 = v0 AND u1 = w0");
+    auto planStats = toPlanStats(task->taskStats());
+    const auto& operatorStats = planStats.at(lastJoinId).operatorStats;
+    ASSERT_EQ(0, operatorStats.count("MultiHashProbe"));
+    ASSERT_EQ(1, operatorStats.count("HashProbe"));
+  }
+
+  // Empty build side.
+  {
+    core::PlanNodeId lastJoinId;
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    auto plan =
+        PlanBuilder(planNodeIdGenerator)
+            .values(probeVectors)
+            .hashJoin(
+                {"t0"},
+                {"u0"},
+                PlanBuilder(planNodeIdGenerator).values(uVectors).planNode(),
+                "",
+                {"t0", "t2", "u1"})
+            .hashJoin(
+                {"t2"},
+                {"w0"},
+                PlanBuilder(planNodeIdGenerator)
+                    .values(wVectors)
+                    .filter("w0 > 10")
+                    .planNode(),
+                "",
+                {"u1", "w1"})
+            .planNode();
+    AssertQueryBuilder(plan, duckDbQueryRunner_)
+        .config(core::QueryConfig::kMultiHashJoinEnabled, "true")
+        .assertEmptyResults();
+  }
+}
+
+TEST_F(HashJoinTest, bloomFilterProbe) {
+  // Distinct keys over a large range. More of these than
+  // VectorHasher::kMaxDistinct make the table use kHash mode.
+  const vector_size_t numBuildRows = 120'000;
+  auto makeKey = [](vector_size_t row) {
+    return static_cast<int64_t>(row * 0x9E3779B97F4A7C15ULL);
+  };
+  std::vector<RowVectorPtr> buildVectors = {makeRowVector(
+      {"u0", "u1"},
+      {
+          makeFlatVector<int64_t>(numBuildRows, makeKey),
+          makeFlatVector<int64_t>(numBuildRows, [](auto row) { return row; }),
+      })};
+  // One in 50 probe rows has a match.
+  auto probeVectors = makeBatches(5, [&](int32_t batch) {
+    return makeRowVector(
+        {"t0", "t1"},
+        {
+            makeFlatVector<int64_t>(
+                10'000,
+                [&](auto row) {
+                  const auto key = batch * 10'000 + row;
+                  return makeKey(row % 50 == 0 ? key : numBuildRows + key);
+                }),
+            makeFlatVector<int32_t>(10'000, [](auto row) { return row; }),
+        });
+  });
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", buildVectors);
+
+  for (const auto joinType : {core::JoinType::kInner, core::JoinType::kLeft}) {
+    SCOPED_TRACE(core::joinTypeName(joinType));
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    auto plan = PlanBuilder(planNodeIdGenerator)
+                    .values(probeVectors)
+                    .hashJoin(
+                        {"t0"},
+                        {"u0"},
+                        PlanBuilder(planNodeIdGenerator)
+                            .values(buildVectors)
+                            .planNode(),
+                        "",
+                        {"t1", "u1"},
+                        joinType)
+                    .planNode();
+    const auto sql = fmt::format(
+        "SELECT t1, u1 FROM t {} JOIN u ON t0 = u0",
+        joinType == core::JoinType::kInner ? "INNER" : "LEFT");
+
+    // The hit rate of the first batch enables the bloom filter for the rest.
+    auto task = AssertQueryBuilder(plan, duckDbQueryRunner_).assertResults(sql);
+    ASSERT_GT(
+        getOperatorRuntimeStats(task, 1, "bloomFilterSkippedRows").sum,
+        3 * 9'800);
+
+    task = AssertQueryBuilder(plan, duckDbQueryRunner_)
+               .config(core::QueryConfig::kHashProbeBloomFilterMaxHitRate, "0")
+               .assertResults(sql);
+    ASSERT_EQ(
+        0, getOperatorRuntimeStats(task, 1, "bloomFilterSkippedRows").sum);
+  }
+}
 } // namespace
@@ -111,6 +111,17 @@ TEST_F(PlanNodeSerdeTest, aggregation) {
              .planNode();
 
   testSerde(plan);
+
+  // Aggregation over GroupId with incremental grouping sets.
+  plan = PlanBuilder()
+             .values({data_})
+             .groupId({"c0"}, {{"c0"}, {}}, {"c1"})
+             .incrementalGroupingSetsAggregation(
+                 {"c0", "group_id"}, {"sum(c1) as sum_c1"})
+             .project({"sum_c1"})
+             .planNode();
+
+  testSerde(plan);
 }
 
 TEST_F(PlanNodeSerdeTest, assignUniqueId) {
@@ -167,6 +178,68 @@ TEST_F(PlanNodeSerdeTest, nestedLoopJoin) {
   }
 }
 
+TEST_F(PlanNodeSerdeTest, asofJoin) {
+  auto left = makeRowVector(
+      {"t0", "t1", "t2"},
+      {
+          makeFlatVector<int32_t>({1, 2, 3}),
+          makeFlatVector<int64_t>({10, 20, 30}),
+          makeFlatVector<bool>({true, true, false}),
+      });
+
+  auto right = makeRowVector(
+      {"u0", "u1", "u2"},
+      {
+          makeFlatVector<int32_t>({1, 2, 3}),
+          makeFlatVector<int64_t>({10, 20, 30}),
+          makeFlatVector<bool>({true, true, false}),
+      });
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto plan =
+      PlanBuilder(planNodeIdGenerator)
+          .values({left})
+          .asofJoin(
+              {"t0"},
+              {"u0"},
+              "t1 >= u1",
+              PlanBuilder(planNodeIdGenerator).values({right}).planNode(),
+              {"t0", "t1", "u2"},
+              core::JoinType::kLeft)
+          .planNode();
+  testSerde(plan);
+}
+
+TEST_F(PlanNodeSerdeTest, rangeJoin) {
+  auto left = makeRowVector(
+      {"t0", "t1", "t2"},
+      {
+          makeFlatVector<int64_t>({1, 2, 3}),
+          makeFlatVector<int64_t>({10, 20, 30}),
+          makeFlatVector<bool>({true, true, false}),
+      });
+
+  auto right = makeRowVector(
+      {"u0", "u1"},
+      {
+          makeFlatVector<int64_t>({1, 2, 3}),
+          makeFlatVector<bool>({true, true, false}),
+      });
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto plan =
+      PlanBuilder(planNodeIdGenerator)
+          .values({left})
+          .rangeJoin(
+              PlanBuilder(planNodeIdGenerator).values({right}).planNode(),
+              {"t0 <= u0", "t1 > u0"},
+              "t2 = u1",
+              {"t0", "u1", "t2"},
+              core::JoinType::kLeft)
+          .planNode();
+  testSerde(plan);
+}
+
 TEST_F(PlanNodeSerdeTest, enforceSingleRow) {
   auto plan = PlanBuilder().values({data_}).enforceSingleRow().planNode();
   testSerde(plan);
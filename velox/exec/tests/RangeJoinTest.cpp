@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/exec/tests/utils/AssertQueryBuilder.h"
+#include "velox/exec/tests/utils/OperatorTestBase.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+using namespace facebook::velox::exec::test;
+
+namespace {
+
+class RangeJoinTest : public OperatorTestBase {
+ protected:
+  void SetUp() override {
+    OperatorTestBase::SetUp();
+
+    // Probe rows with start/end intervals and build rows with points. Keys
+    // have nulls and duplicates. The build side is split into multiple vectors.
+    probeVectors_ = {
+        makeRowVector(
+            {"t0", "t1", "t2"},
+            {
+                makeFlatVector<int64_t>(
+                    100, [](auto row) { return row % 37; }, nullEvery(11)),
+                makeFlatVector<int64_t>(
+                    100, [](auto row) { return row % 37 + row % 5; }),
+                makeFlatVector<int64_t>(100, [](auto row) { return row; }),
+            }),
+        makeRowVector(
+            {"t0", "t1", "t2"},
+            {
+                makeFlatVector<int64_t>(
+                    50, [](auto row) { return row % 13 * 3; }),
+                makeFlatVector<int64_t>(
+                    50,
+                    [](auto row) { return row % 13 * 3 + 2; },
+                    nullEvery(7)),
+                makeFlatVector<int64_t>(50, [](auto row) { return -row; }),
+            }),
+    };
+    buildVectors_ = {
+        makeRowVector(
+            {"u0", "u1"},
+            {
+                makeFlatVector<int64_t>(
+                    30, [](auto row) { return row * 7 % 41; }, nullEvery(9)),
+                makeFlatVector<int64_t>(30, [](auto row) { return row; }),
+            }),
+        makeRowVector(
+            {"u0", "u1"},
+            {
+                makeFlatVector<int64_t>(20, [](auto row) { return row % 4; }),
+                makeFlatVector<int64_t>(20, [](auto row) { return -row; }),
+            }),
+    };
+    createDuckDbTable("t", probeVectors_);
+    createDuckDbTable("u", buildVectors_);
+  }
+
+  void testJoin(
+      const std::vector<std::string>& conditions,
+      const std::string& filter = "") {
+    auto sqlConditions = conditions;
+    if (!filter.empty()) {
+      sqlConditions.push_back(filter);
+    }
+    const auto sqlCondition = folly::join(" AND ", sqlConditions);
+
+    for (auto joinType : {core::JoinType::kInner, core::JoinType::kLeft}) {
+      for (auto numDrivers : {1, 4}) {
+        SCOPED_TRACE(fmt::format(
+            "{} {} drivers: {}",
+            joinTypeName(joinType),
+            sqlCondition,
+            numDrivers));
+
+        auto planNodeIdGenerator =
+            std::make_shared<core::PlanNodeIdGenerator>();
+        auto plan = PlanBuilder(planNodeIdGenerator)
+                        .values(probeVectors_)
+                        .localPartitionRoundRobin()
+                        .rangeJoin(
+                            PlanBuilder(planNodeIdGenerator)
+                                .values(buildVectors_)
+                                .localPartitionRoundRobin()
+                                .planNode(),
+                            conditions,
+                            filter,
+                            {"t0", "t1", "t2", "u0", "u1"},
+                            joinType)
+                        .planNode();
+
+        // Use small batches to produce the matches of a probe row over
+        // multiple batches.
+        AssertQueryBuilder(plan, duckDbQueryRunner_)
+            .maxDrivers(numDrivers)
+            .config(core::QueryConfig::kPreferredOutputBatchRows, "7")
+            .assertResults(fmt::format(
+                "SELECT t0, t1, t2, u0, u1 FROM t {} JOIN u ON {}",
+                joinTypeName(joinType),
+                sqlCondition));
+      }
+    }
+  }
+
+  std::vector<RowVectorPtr> probeVectors_;
+  std::vector<RowVectorPtr> buildVectors_;
+};
+
+TEST_F(RangeJoinTest, singleCondition) {
+  for (const auto* comparison : {"<", "<=", ">", ">="}) {
+    testJoin({fmt::format("t0 {} u0", comparison)});
+  }
+}
+
+TEST_F(RangeJoinTest, twoConditions) {
+  const std::vector<std::string> comparisons = {"<", "<=", ">", ">="};
+  for (const auto& first : comparisons) {
+    for (const auto& second : comparisons) {
+      testJoin(
+          {fmt::format("t0 {} u0", first), fmt::format("t1 {} u0", second)});
+    }
+  }
+
+  // The second condition is on different columns than the first.
+  testJoin({"t0 <= u0", "t2 > u1"});
+}
+
+TEST_F(RangeJoinTest, filter) {
+  testJoin({"t0 <= u0", "t1 >= u0"}, "(t2 + u1) % 3 = 0");
+  testJoin({"t0 < u0"}, "t2 > u1");
+}
+
+TEST_F(RangeJoinTest, emptyBuildOrProbe) {
+  auto empty = makeRowVector(
+      {"u0", "u1"},
+      {makeFlatVector<int64_t>({}), makeFlatVector<int64_t>({})});
+  auto probe = makeRowVector(
+      {"t0", "t1"},
+      {makeFlatVector<int64_t>({1, 2}), makeFlatVector<int64_t>({3, 4})});
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto makePlan = [&](core::JoinType joinType) {
+    return PlanBuilder(planNodeIdGenerator)
+        .values({probe})
+        .rangeJoin(
+            PlanBuilder(planNodeIdGenerator).values({empty}).planNode(),
+            {"t0 <= u0", "t1 >= u0"},
+            "",
+            {"t0", "t1", "u0"},
+            joinType)
+        .planNode();
+  };
+
+  auto expected = makeRowVector({
+      makeFlatVector<int64_t>({1, 2}),
+      makeFlatVector<int64_t>({3, 4}),
+      makeNullableFlatVector<int64_t>({std::nullopt, std::nullopt}),
+  });
+  AssertQueryBuilder(makePlan(core::JoinType::kLeft)).assertResults(expected);
+  AssertQueryBuilder(makePlan(core::JoinType::kInner)).assertEmptyResults();
+
+  // Empty probe side.
+  auto emptyProbe = makeRowVector(
+      {"t0", "t1"},
+      {makeFlatVector<int64_t>({}), makeFlatVector<int64_t>({})});
+  auto build = makeRowVector({"u0"}, {makeFlatVector<int64_t>({1, 2, 3})});
+  auto plan =
+      PlanBuilder(planNodeIdGenerator)
+          .values({emptyProbe})
+          .rangeJoin(
+              PlanBuilder(planNodeIdGenerator).values({build}).planNode(),
+              {"t0 < u0"},
+              "",
+              {"t0", "u0"},
+              core::JoinType::kLeft)
+          .planNode();
+  AssertQueryBuilder(plan).assertEmptyResults();
+}
+
+TEST_F(RangeJoinTest, varcharKeys) {
+  auto probe = makeRowVector(
+      {"t0", "t1"},
+      {
+          makeNullableFlatVector<StringView>(
+              {"apple", "banana", std::nullopt, "cherry", "date"}),
+          makeFlatVector<StringView>({"b", "c", "d", "e", "f"}),
+      });
+  auto build = makeRowVector(
+      {"u0"},
+      {makeNullableFlatVector<StringView>(
+          {"avocado", "blueberry", std::nullopt, "coconut", "apple", "fig"})});
+  createDuckDbTable("t", {probe});
+  createDuckDbTable("u", {build});
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto plan =
+      PlanBuilder(planNodeIdGenerator)
+          .values({probe})
+          .rangeJoin(
+              PlanBuilder(planNodeIdGenerator).values({build}).planNode(),
+              {"t0 <= u0", "t1 > u0"},
+              "",
+              {"t0", "t1", "u0"},
+              core::JoinType::kLeft)
+          .planNode();
+  assertQuery(
+      plan, "SELECT t0, t1, u0 FROM t LEFT JOIN u ON t0 <= u0 AND t1 > u0");
+}
+
+TEST_F(RangeJoinTest, invalidPlan) {
+  auto probe = makeRowVector(
+      {"t0", "t1"},
+      {makeFlatVector<int64_t>({1, 2}), makeFlatVector<int32_t>({3, 4})});
+  auto build = makeRowVector(
+      {"u0", "u1"},
+      {makeFlatVector<int64_t>({1, 2}), makeFlatVector<int32_t>({3, 4})});
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto makePlan = [&](const std::vector<std::string>& conditions,
+                      core::JoinType joinType) {
+    return PlanBuilder(planNodeIdGenerator)
+        .values({probe})
+        .rangeJoin(
+            PlanBuilder(planNodeIdGenerator).values({build}).planNode(),
+            conditions,
+            "",
+            {"t0", "u0"},
+            joinType);
+  };
+
+  VELOX_ASSERT_THROW(
+      makePlan({"t0 < u0"}, core::JoinType::kRight),
+      "RangeJoin only supports inner and left join");
+  VELOX_ASSERT_THROW(
+      makePlan({}, core::JoinType::kInner),
+      "RangeJoin requires one or two range conditions");
+  VELOX_ASSERT_THROW(
+      makePlan({"t0 < u1"}, core::JoinType::kInner),
+      "Range condition keys must have the same type");
+  VELOX_ASSERT_THROW(
+      makePlan({"t0 < u0", "t1 < u1"}, core::JoinType::kInner),
+      "Range conditions must have keys of the same type");
+}
+
+} // namespace
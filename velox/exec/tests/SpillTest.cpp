@@ -519,6 +519,70 @@ TEST_P(SpillTest, spillTimestamp) {
   ASSERT_EQ(nullptr, merge->next());
 }
 
+TEST_P(SpillTest, compressionDictionary) {
+  // Spills similar strings in small pages. With zstd, a dictionary is trained
+  // on the first pages and the file started after training is compressed with
+  // it.
+  std::vector<CompareFlags> emptyCompareFlags;
+  SpillState state(
+      [&]() -> const std::string& { return tempDir_->getPath(); },
+      updateSpilledBytesCb_,
+      "test",
+      1,
+      0,
+      emptyCompareFlags,
+      kGB,
+      4 << 10,
+      compressionKind_,
+      pool(),
+      &spillStats_);
+  state.setPartitionSpilled(0);
+
+  const int numBatches = 200;
+  const int numRowsPerBatch = 100;
+  std::vector<RowVectorPtr> batches;
+  for (int i = 0; i < numBatches; ++i) {
+    batches.push_back(makeRowVector({
+        makeFlatVector<int64_t>(
+            numRowsPerBatch,
+            [&](auto row) { return i * numRowsPerBatch + row; }),
+        makeFlatVector<std::string>(
+            numRowsPerBatch,
+            [&](auto row) {
+              return fmt::format(
+                  "Customer#{:09} of nation {} in segment {}",
+                  i * numRowsPerBatch + row,
+                  row % 25,
+                  row % 5 == 0 ? "AUTOMOBILE" : "BUILDING");
+            }),
+    }));
+    state.appendToPartition(0, batches.back());
+  }
+
+  auto spillFiles = state.finish(0);
+  if (compressionKind_ == common::CompressionKind_ZSTD) {
+    ASSERT_EQ(spillFiles.size(), 2);
+    ASSERT_EQ(spillFiles[0].compressionDictionary, nullptr);
+    ASSERT_NE(spillFiles[1].compressionDictionary, nullptr);
+  } else {
+    ASSERT_EQ(spillFiles.size(), 1);
+    ASSERT_EQ(spillFiles[0].compressionDictionary, nullptr);
+  }
+
+  SpillPartition spillPartition(SpillPartitionId{0, 0}, std::move(spillFiles));
+  auto reader =
+      spillPartition.createUnorderedReader(1 << 20, pool(), &spillStats_);
+  RowVectorPtr output;
+  for (const auto& batch : batches) {
+    ASSERT_TRUE(reader->nextBatch(output));
+    ASSERT_EQ(output->size(), numRowsPerBatch);
+    for (int row = 0; row < numRowsPerBatch; ++row) {
+      ASSERT_EQ(0, output->compare(batch.get(), row, row, CompareFlags{}));
+    }
+  }
+  ASSERT_FALSE(reader->nextBatch(output));
+}
+
 TEST_P(SpillTest, spillStateWithSmallTargetFileSize) {
   // Set the target file size to a small value to open a new file on each batch
   // write.
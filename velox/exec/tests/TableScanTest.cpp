@@ -4457,6 +4457,54 @@ TEST_F(TableScanTest, readFlatMapAsStruct) {
   AssertQueryBuilder(plan).split(split).assertResults(vector);
 }
 
+TEST_F(TableScanTest, preserveFlatMapsInMemory) {
+  constexpr int kSize = 1'000;
+  // Maps with up to 5 of the keys 0 to 9.
+  auto vector = makeRowVector({makeMapVector<int64_t, int64_t>(
+      kSize,
+      [](auto row) { return row % 6; },
+      [](auto i) { return i % 10; },
+      [](auto i) { return i; },
+      nullEvery(7))});
+  auto config = std::make_shared<dwrf::Config>();
+  config->set(dwrf::Config::FLATTEN_MAP, true);
+  config->set<const std::vector<uint32_t>>(dwrf::Config::MAP_FLAT_COLS, {0});
+  auto file = TempFilePath::create();
+  writeToFile(file->getPath(), {vector}, config);
+
+  // The flat map fast paths and the functions that see the materialized maps
+  // return the same results as for the maps read into a MapVector.
+  const std::vector<std::string> projections = {
+      "c0",
+      "element_at(c0, 1)",
+      "element_at(c0, c0[2])",
+      "cardinality(c0)",
+      "map_keys(c0)",
+      "map_values(c0)",
+      "map_entries(c0)",
+      "cast(c0 as map(bigint, double))"};
+  auto expected = AssertQueryBuilder(PlanBuilder()
+                                         .values({vector})
+                                         .filter("cardinality(c0) > 1")
+                                         .project(projections)
+                                         .planNode())
+                      .copyResults(pool());
+
+  auto plan = PlanBuilder()
+                  .tableScan(
+                      asRowType(vector->type()), {}, "cardinality(c0) > 1")
+                  .project(projections)
+                  .planNode();
+  auto split = makeHiveConnectorSplit(file->getPath());
+  AssertQueryBuilder(plan)
+      .connectorSessionProperty(
+          kHiveConnectorId,
+          connector::hive::HiveConfig::kPreserveFlatMapsInMemorySession,
+          "true")
+      .split(split)
+      .assertResults(expected);
+}
+
 TEST_F(TableScanTest, dynamicFilters) {
   // Make sure filters on same column from multiple downstream operators are
   // merged properly without overwriting each other.
@@ -4722,3 +4770,114 @@ DEBUG_ONLY_TEST_F(TableScanTest, cancellationToken) {
   }
   queryThread.join();
 }
+
+TEST_F(TableScanTest, topNDynamicFilter) {
+  auto rowType = ROW({"c0", "c1"}, {BIGINT(), VARCHAR()});
+  auto filePaths = makeFilePaths(10);
+  std::vector<RowVectorPtr> vectors;
+  for (int32_t i = 0; i < filePaths.size(); ++i) {
+    // Later files only have larger keys.
+    vectors.push_back(makeRowVector(
+        {"c0", "c1"},
+        {makeFlatVector<int64_t>(
+             1'000, [&](auto row) { return i * 1'000 + row; }),
+         makeFlatVector<std::string>(
+             1'000, [](auto row) { return std::to_string(row); })}));
+    writeToFile(filePaths[i]->getPath(), vectors.back());
+  }
+  createDuckDbTable(vectors);
+
+  for (const auto& sortOrder : {"NULLS LAST", "NULLS FIRST"}) {
+    SCOPED_TRACE(sortOrder);
+    core::PlanNodeId scanNodeId;
+    core::PlanNodeId topNNodeId;
+    auto plan = PlanBuilder()
+                    .tableScan(rowType)
+                    .capturePlanNodeId(scanNodeId)
+                    .topN({fmt::format("c0 {}", sortOrder)}, 10, false)
+                    .capturePlanNodeId(topNNodeId)
+                    .planNode();
+
+    auto task = assertQuery(
+        plan,
+        filePaths,
+        fmt::format("SELECT * FROM tmp ORDER BY c0 {} LIMIT 10", sortOrder));
+
+    // The boundary of the first file is pushed down and the other files
+    // produce no rows.
+    auto planStats = toPlanStats(task->taskStats());
+    ASSERT_EQ(
+        planStats.at(topNNodeId).customStats.at("dynamicFiltersProduced").sum,
+        1);
+    ASSERT_EQ(
+        planStats.at(scanNodeId).customStats.at("dynamicFiltersAccepted").sum,
+        1);
+    ASSERT_LT(planStats.at(scanNodeId).outputRows, 10'000);
+  }
+}
+
+TEST_F(TableScanTest, limit) {
+  auto rowType = ROW({"c0", "c1"}, {BIGINT(), VARCHAR()});
+  auto filePaths = makeFilePaths(10);
+  for (int32_t i = 0; i < filePaths.size(); ++i) {
+    writeToFile(
+        filePaths[i]->getPath(),
+        makeRowVector(
+            {"c0", "c1"},
+            {makeFlatVector<int64_t>(
+                 1'000, [&](auto row) { return i * 1'000 + row; }),
+             makeFlatVector<std::string>(
+                 1'000, [](auto row) { return std::to_string(row); })}));
+  }
+
+  // The scan reads only as many rows as the limit needs.
+  auto plan = PlanBuilder().tableScan(rowType).limit(0, 10, false).planNode();
+  std::shared_ptr<Task> task;
+  auto result = AssertQueryBuilder(plan)
+                    .splits(makeHiveConnectorSplits(filePaths))
+                    .copyResults(pool(), task);
+  ASSERT_EQ(result->size(), 10);
+  auto scanStats = getTableScanStats(task);
+  ASSERT_EQ(scanStats.rawInputRows, 10);
+  ASSERT_EQ(scanStats.numSplits, 1);
+
+  // With multiple drivers, the scans stop taking splits once the rows produced
+  // by all drivers reach the limit.
+  const int32_t numDrivers = 4;
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  core::PlanNodeId scanNodeId;
+  plan = PlanBuilder(planNodeIdGenerator)
+             .localPartition(
+                 {},
+                 {PlanBuilder(planNodeIdGenerator)
+                      .tableScan(rowType)
+                      .capturePlanNodeId(scanNodeId)
+                      .limit(0, 10, true)
+                      .planNode()})
+             .limit(0, 10, false)
+             .planNode();
+  result = AssertQueryBuilder(plan)
+               .splits(scanNodeId, makeHiveConnectorSplits(filePaths))
+               .maxDrivers(numDrivers)
+               .copyResults(pool(), task);
+  ASSERT_EQ(result->size(), 10);
+  scanStats = toPlanStats(task->taskStats()).at(scanNodeId);
+  ASSERT_LE(scanStats.numSplits, numDrivers);
+  ASSERT_LE(scanStats.rawInputRows, numDrivers * 10);
+
+  // Splits are preloaded only if the limit needs more rows than the splits
+  // being read are expected to produce.
+  for (const auto& [limit, expectPreload] :
+       std::vector<std::pair<int64_t, bool>>{{10, false}, {9'000, true}}) {
+    SCOPED_TRACE(fmt::format("limit {}", limit));
+    plan = PlanBuilder().tableScan(rowType).limit(0, limit, false).planNode();
+    result = AssertQueryBuilder(plan)
+                 .config(core::QueryConfig::kMaxSplitPreloadPerDriver, "2")
+                 .splits(makeHiveConnectorSplits(filePaths))
+                 .copyResults(pool(), task);
+    ASSERT_EQ(result->size(), limit);
+    ASSERT_EQ(
+        getTableScanRuntimeStats(task).count("preloadedSplits") > 0,
+        expectPreload);
+  }
+}
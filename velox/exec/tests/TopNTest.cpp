@@ -166,6 +166,25 @@ TEST_F(TopNTest, multipleKeys) {
   testTwoKeys(vectors, "c0", "c1", 200);
 }
 
+TEST_F(TopNTest, normalizedAndVarcharKeys) {
+  // The first key is compared using normalized keys. The ties are broken by
+  // comparing the varchar key.
+  vector_size_t batchSize = 1000;
+  std::vector<RowVectorPtr> vectors;
+  for (int32_t i = 0; i < 2; ++i) {
+    auto c0 = makeFlatVector<int64_t>(
+        batchSize, [](vector_size_t row) { return row % 4; }, nullEvery(31, 1));
+    auto c1 = makeFlatVector<std::string>(
+        batchSize,
+        [](vector_size_t row) { return std::to_string(row); },
+        nullEvery(17));
+    vectors.push_back(makeRowVector({c0, c1}));
+  }
+  createDuckDbTable(vectors);
+
+  testTwoKeys(vectors, "c0", "c1", 200);
+}
+
 TEST_F(TopNTest, compaction) {
   vector_size_t batchSize = 1000;
   std::vector<RowVectorPtr> vectors;
@@ -424,7 +424,8 @@ TEST_F(UnnestTest, batchSize) {
       makeFlatVector<int64_t>(10'000 * 3, [](auto row) { return 1 + row % 3; }),
   });
 
-  // 17 rows per output allows to unnest 6 input rows at a time.
+  // 17 rows per output splits the elements of some input rows across
+  // batches.
   {
     auto task = AssertQueryBuilder(plan)
                     .config(core::QueryConfig::kPreferredOutputBatchRows, "17")
@@ -432,10 +433,10 @@ TEST_F(UnnestTest, batchSize) {
     auto stats = exec::toPlanStats(task->taskStats());
 
     ASSERT_EQ(30'000, stats.at(unnestId).outputRows);
-    ASSERT_EQ(1 + 10'000 / 6, stats.at(unnestId).outputVectors);
+    ASSERT_EQ(1 + 30'000 / 17, stats.at(unnestId).outputVectors);
   }
 
-  // 2 rows per output allows to unnest 1 input row at a time.
+  // 2 rows per output allows to unnest less than 1 input row at a time.
   {
     auto task = AssertQueryBuilder(plan)
                     .config(core::QueryConfig::kPreferredOutputBatchRows, "2")
@@ -443,7 +444,7 @@ TEST_F(UnnestTest, batchSize) {
     auto stats = exec::toPlanStats(task->taskStats());
 
     ASSERT_EQ(30'000, stats.at(unnestId).outputRows);
-    ASSERT_EQ(10'000, stats.at(unnestId).outputVectors);
+    ASSERT_EQ(15'000, stats.at(unnestId).outputVectors);
   }
 
   // 100K rows per output allows to unnest all at once.
@@ -458,3 +459,71 @@ TEST_F(UnnestTest, batchSize) {
     ASSERT_EQ(1, stats.at(unnestId).outputVectors);
   }
 }
+
+TEST_F(UnnestTest, splitLargeArrays) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>({1, 2, 3}),
+      makeArrayVector<int64_t>(
+          3,
+          [](auto row) { return row == 1 ? 10'000 : 5; },
+          [](auto row, auto index) { return row * 100'000 + index; }),
+  });
+
+  core::PlanNodeId unnestId;
+  auto plan = PlanBuilder()
+                  .values({data})
+                  .unnest({"c0"}, {"c1"}, "ordinal")
+                  .capturePlanNodeId(unnestId)
+                  .planNode();
+
+  const vector_size_t numRows = 10'000 + 2 * 5;
+  auto expected = makeRowVector({
+      makeFlatVector<int64_t>(
+          numRows,
+          [](auto row) { return row < 5 ? 1 : (row < 10'005 ? 2 : 3); }),
+      makeFlatVector<int64_t>(
+          numRows,
+          [](auto row) {
+            if (row < 5) {
+              return row;
+            }
+            return row < 10'005 ? 100'000 + row - 5 : 200'000 + row - 10'005;
+          }),
+      makeFlatVector<int64_t>(
+          numRows,
+          [](auto row) {
+            if (row < 5) {
+              return 1 + row;
+            }
+            return 1 + (row < 10'005 ? row - 5 : row - 10'005);
+          }),
+  });
+
+  // The 10K elements of the second row are split across batches of 1'000
+  // rows.
+  auto task = AssertQueryBuilder(plan)
+                  .config(core::QueryConfig::kPreferredOutputBatchRows, "1000")
+                  .assertResults({expected});
+  auto stats = exec::toPlanStats(task->taskStats());
+  ASSERT_EQ(numRows, stats.at(unnestId).outputRows);
+  ASSERT_EQ(11, stats.at(unnestId).outputVectors);
+
+  // Elements are contiguous, hence, unnested without copying.
+  CursorParameters params;
+  params.planNode =
+      PlanBuilder().values({data}).unnest({"c0"}, {"c1"}).planNode();
+  params.queryConfigs[core::QueryConfig::kPreferredOutputBatchRows] = "1000";
+  auto [cursor, results] = readCursor(params, [](exec::Task*) {});
+  ASSERT_EQ(11, results.size());
+
+  const auto* elements = data->childAt(1)->as<ArrayVector>()->elements().get();
+  const auto* rawElements = elements->asFlatVector<int64_t>()->rawValues();
+  vector_size_t offset = 0;
+  for (const auto& result : results) {
+    auto* unnested = result->childAt(1)->asFlatVector<int64_t>();
+    ASSERT_TRUE(unnested != nullptr);
+    ASSERT_EQ(rawElements + offset, unnested->rawValues());
+    offset += result->size();
+  }
+  ASSERT_EQ(numRows, offset);
+}
@@ -79,6 +79,60 @@ TEST_F(WindowTest, spill) {
   ASSERT_GT(stats.spilledPartitions, 0);
 }
 
+TEST_F(WindowTest, parallelPartitions) {
+  const vector_size_t size = 10'000;
+  auto data = makeRowVector(
+      {"d", "p", "s"},
+      {
+          // Payload.
+          makeFlatVector<int64_t>(size, [](auto row) { return row % 7; }),
+          // Partition key. Partition sizes vary from 1 to 2'000 rows.
+          makeFlatVector<int32_t>(
+              size,
+              [](auto row) { return row < 2'000 ? 0 : row % 501; }),
+          // Sorting key.
+          makeFlatVector<int32_t>(size, [](auto row) { return row / 3; }),
+      });
+
+  createDuckDbTable({data});
+
+  const std::vector<std::string> windowFunctions = {
+      "row_number() over (partition by p order by s)",
+      "rank() over (partition by p order by s)",
+      "sum(d) over (partition by p order by s "
+      "rows between 2 preceding and current row)",
+  };
+  auto plan = PlanBuilder()
+                  .values(split(data, 10))
+                  .window(windowFunctions)
+                  .planNode();
+
+  // The parallel output must match the serial output including the order.
+  auto expected =
+      AssertQueryBuilder(plan)
+          .config(core::QueryConfig::kPreferredOutputBatchBytes, "1024")
+          .copyResults(pool());
+
+  for (const auto& parallelism : {"2", "4", "16"}) {
+    SCOPED_TRACE(fmt::format("parallelism: {}", parallelism));
+    AssertQueryBuilder(plan, duckDbQueryRunner_)
+        .config(core::QueryConfig::kPreferredOutputBatchBytes, "1024")
+        .config(core::QueryConfig::kWindowPartitionParallelism, parallelism)
+        .assertResults(
+            "SELECT *, row_number() over (partition by p order by s), "
+            "rank() over (partition by p order by s), "
+            "sum(d) over (partition by p order by s rows between 2 "
+            "preceding and current row) FROM tmp");
+
+    auto actual =
+        AssertQueryBuilder(plan)
+            .config(core::QueryConfig::kPreferredOutputBatchBytes, "1024")
+            .config(core::QueryConfig::kWindowPartitionParallelism, parallelism)
+            .copyResults(pool());
+    assertEqualVectors(expected, actual);
+  }
+}
+
 TEST_F(WindowTest, missingFunctionSignature) {
   auto input = {makeRowVector({
       makeFlatVector<int64_t>({1, 2, 3}),
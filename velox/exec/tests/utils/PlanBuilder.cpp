@@ -15,6 +15,7 @@
  */
 
 #include "velox/exec/tests/utils/PlanBuilder.h"
+#include <folly/String.h>
 #include "velox/connectors/hive/HiveConnector.h"
 #include "velox/connectors/hive/TableHandle.h"
 #include "velox/connectors/tpch/TpchConnector.h"
@@ -70,6 +71,21 @@ std::shared_ptr<HiveBucketProperty> buildHiveBucketProperty(
       bucketTypes,
       sortBy);
 }
+
+// Splits a range condition of the form 'left <op> right' into the left column
+// name, the comparison and the right column name.
+std::tuple<std::string, core::RangeJoinNode::Comparison, std::string>
+parseRangeCondition(const std::string& condition) {
+  std::vector<std::string> parts;
+  folly::split(' ', condition, parts, true);
+  VELOX_USER_CHECK_EQ(
+      parts.size(),
+      3,
+      "Range condition must be of the form 'left <op> right': {}",
+      condition);
+  return {
+      parts[0], core::RangeJoinNode::comparisonFromName(parts[1]), parts[2]};
+}
 } // namespace
 
 PlanBuilder& PlanBuilder::tableScan(
@@ -805,6 +821,30 @@ PlanBuilder::AggregatesAndNames PlanBuilder::createAggregateExpressionsAndNames(
   return {aggs, names};
 }
 
+namespace {
+// If the aggregationNode is over a GroupId, then global grouping sets
+// need to be populated.
+void findGlobalGroupingSets(
+    const core::PlanNodePtr& source,
+    std::vector<vector_size_t>& globalGroupingSets,
+    std::optional<core::FieldAccessTypedExprPtr>& groupId) {
+  if (auto groupIdNode = dynamic_cast<const core::GroupIdNode*>(source.get())) {
+    for (auto i = 0; i < groupIdNode->groupingSets().size(); i++) {
+      if (groupIdNode->groupingSets().at(i).empty()) {
+        globalGroupingSets.push_back(i);
+      }
+    }
+
+    if (!globalGroupingSets.empty()) {
+      // GroupId is the last column of the GroupIdNode.
+      const auto& outputType = groupIdNode->outputType();
+      groupId = std::make_shared<core::FieldAccessTypedExpr>(
+          outputType->children().back(), outputType->names().back());
+    }
+  }
+}
+} // namespace
+
 PlanBuilder& PlanBuilder::aggregation(
     const std::vector<std::string>& groupingKeys,
     const std::vector<std::string>& preGroupedKeys,
@@ -816,23 +856,9 @@ PlanBuilder& PlanBuilder::aggregation(
   auto aggregatesAndNames = createAggregateExpressionsAndNames(
       aggregates, masks, step, rawInputTypes);
 
-  // If the aggregationNode is over a GroupId, then global grouping sets
-  // need to be populated.
   std::vector<vector_size_t> globalGroupingSets;
   std::optional<core::FieldAccessTypedExprPtr> groupId;
-  if (auto groupIdNode =
-          dynamic_cast<const core::GroupIdNode*>(planNode_.get())) {
-    for (auto i = 0; i < groupIdNode->groupingSets().size(); i++) {
-      if (groupIdNode->groupingSets().at(i).empty()) {
-        globalGroupingSets.push_back(i);
-      }
-    }
-
-    if (!globalGroupingSets.empty()) {
-      // GroupId is the last column of the GroupIdNode.
-      groupId = field(groupIdNode->outputType()->names().back());
-    }
-  }
+  findGlobalGroupingSets(planNode_, globalGroupingSets, groupId);
 
   planNode_ = std::make_shared<core::AggregationNode>(
       nextPlanNodeId(),
@@ -868,6 +894,36 @@ PlanBuilder& PlanBuilder::streamingAggregation(
   return *this;
 }
 
+PlanBuilder& PlanBuilder::incrementalGroupingSetsAggregation(
+    const std::vector<std::string>& groupingKeys,
+    const std::vector<std::string>& aggregates,
+    const std::vector<std::string>& masks,
+    core::AggregationNode::Step step) {
+  VELOX_USER_CHECK_NOT_NULL(
+      dynamic_cast<const core::GroupIdNode*>(planNode_.get()),
+      "Incremental grouping sets aggregation must follow a GroupIdNode");
+  auto aggregatesAndNames =
+      createAggregateExpressionsAndNames(aggregates, masks, step);
+
+  std::vector<vector_size_t> globalGroupingSets;
+  std::optional<core::FieldAccessTypedExprPtr> groupId;
+  findGlobalGroupingSets(planNode_, globalGroupingSets, groupId);
+
+  planNode_ = std::make_shared<core::AggregationNode>(
+      nextPlanNodeId(),
+      step,
+      fields(groupingKeys),
+      std::vector<core::FieldAccessTypedExprPtr>{},
+      aggregatesAndNames.names,
+      aggregatesAndNames.aggregates,
+      globalGroupingSets,
+      groupId,
+      /*incrementalGroupingSets*/ true,
+      /*ignoreNullKeys*/ false,
+      planNode_);
+  return *this;
+}
+
 PlanBuilder& PlanBuilder::groupId(
     const std::vector<std::string>& groupingKeys,
     const std::vector<std::vector<std::string>>& groupingSets,
@@ -1406,6 +1462,40 @@ PlanBuilder& PlanBuilder::mergeJoin(
   return *this;
 }
 
+PlanBuilder& PlanBuilder::asofJoin(
+    const std::vector<std::string>& leftKeys,
+    const std::vector<std::string>& rightKeys,
+    const std::string& asofCondition,
+    const core::PlanNodePtr& build,
+    const std::vector<std::string>& outputLayout,
+    core::JoinType joinType) {
+  VELOX_CHECK_NOT_NULL(planNode_, "AsofJoin cannot be the source node");
+  VELOX_CHECK_EQ(leftKeys.size(), rightKeys.size());
+
+  auto leftType = planNode_->outputType();
+  auto rightType = build->outputType();
+  auto resultType = concat(leftType, rightType);
+  auto outputType = extract(resultType, outputLayout);
+
+  auto [leftAsofKey, comparison, rightAsofKey] =
+      parseRangeCondition(asofCondition);
+  auto leftKeyFields = fields(leftType, leftKeys);
+  leftKeyFields.push_back(field(leftType, leftAsofKey));
+  auto rightKeyFields = fields(rightType, rightKeys);
+  rightKeyFields.push_back(field(rightType, rightAsofKey));
+
+  planNode_ = std::make_shared<core::AsofJoinNode>(
+      nextPlanNodeId(),
+      joinType,
+      leftKeyFields,
+      rightKeyFields,
+      comparison,
+      std::move(planNode_),
+      build,
+      outputType);
+  return *this;
+}
+
 PlanBuilder& PlanBuilder::nestedLoopJoin(
     const core::PlanNodePtr& right,
     const std::vector<std::string>& outputLayout,
@@ -1437,6 +1527,42 @@ PlanBuilder& PlanBuilder::nestedLoopJoin(
   return *this;
 }
 
+PlanBuilder& PlanBuilder::rangeJoin(
+    const core::PlanNodePtr& right,
+    const std::vector<std::string>& conditions,
+    const std::string& filter,
+    const std::vector<std::string>& outputLayout,
+    core::JoinType joinType) {
+  VELOX_CHECK_NOT_NULL(planNode_, "RangeJoin cannot be the source node");
+  auto resultType = concat(planNode_->outputType(), right->outputType());
+  auto outputType = extract(resultType, outputLayout);
+
+  std::vector<core::RangeJoinNode::Condition> rangeConditions;
+  rangeConditions.reserve(conditions.size());
+  for (const auto& condition : conditions) {
+    auto [leftName, comparison, rightName] = parseRangeCondition(condition);
+    rangeConditions.push_back(
+        {field(planNode_->outputType(), leftName),
+         comparison,
+         field(right->outputType(), rightName)});
+  }
+
+  core::TypedExprPtr filterExpr;
+  if (!filter.empty()) {
+    filterExpr = parseExpr(filter, resultType, options_, pool_);
+  }
+
+  planNode_ = std::make_shared<core::RangeJoinNode>(
+      nextPlanNodeId(),
+      joinType,
+      std::move(rangeConditions),
+      std::move(filterExpr),
+      std::move(planNode_),
+      right,
+      outputType);
+  return *this;
+}
+
 PlanBuilder& PlanBuilder::unnest(
     const std::vector<std::string>& replicateColumns,
     const std::vector<std::string>& unnestColumns,
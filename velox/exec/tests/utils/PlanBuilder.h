@@ -649,6 +649,21 @@ class PlanBuilder {
       const std::vector<std::string>& aggregationInputs,
       std::string groupIdName = "group_id");
 
+  /// Add an AggregationNode over the preceding GroupIdNode that computes the
+  /// aggregates once for the finest grouping set and derives the results for
+  /// all grouping sets by re-aggregating the intermediate results of the
+  /// finest grouping set. Must be called directly after groupId(). Grouping
+  /// keys must include all grouping keys of the GroupIdNode and the group id
+  /// column. See 'partialAggregation' method for the supported types of
+  /// aggregate expressions. Distinct and sorted aggregates are not supported.
+  ///
+  /// @param step Aggregation step: partial or single.
+  PlanBuilder& incrementalGroupingSetsAggregation(
+      const std::vector<std::string>& groupingKeys,
+      const std::vector<std::string>& aggregates,
+      const std::vector<std::string>& masks = {},
+      core::AggregationNode::Step step = core::AggregationNode::Step::kSingle);
+
   /// Add an ExpandNode using specified projections. See comments for
   /// ExpandNode class for description of this plan node.
   ///
@@ -857,6 +872,30 @@ class PlanBuilder {
       const std::vector<std::string>& outputLayout,
       core::JoinType joinType = core::JoinType::kInner);
 
+  /// Add an AsofJoinNode to join each row of the left input with the row of
+  /// the right input that has equal 'leftKeys' and 'rightKeys' and the nearest
+  /// ASOF key satisfying 'asofCondition'. The caller is responsible to ensure
+  /// that inputs are sorted in ascending order on the equality keys followed
+  /// by the ASOF key. If that's not the case, the query may produce incorrect
+  /// results.
+  ///
+  /// @param leftKeys Equality keys from the left side. May be empty.
+  /// @param rightKeys Equality keys from the right side.
+  /// @param asofCondition ASOF condition of the form 'left <op> right' where
+  /// 'left' is a column of the left side, 'right' is a column of the right
+  /// side and <op> is one of <, <=, >, >=, e.g. "ts >= quote_ts".
+  /// @param build Right-side input.
+  /// @param outputLayout Output layout consisting of columns from left and
+  /// right sides.
+  /// @param joinType Type of the join: inner or left.
+  PlanBuilder& asofJoin(
+      const std::vector<std::string>& leftKeys,
+      const std::vector<std::string>& rightKeys,
+      const std::string& asofCondition,
+      const core::PlanNodePtr& build,
+      const std::vector<std::string>& outputLayout,
+      core::JoinType joinType = core::JoinType::kInner);
+
   /// Add a NestedLoopJoinNode to join two inputs using filter as join
   /// condition to perform equal/non-equal join. Only supports inner/outer
   /// joins.
@@ -887,6 +926,25 @@ class PlanBuilder {
       const std::vector<std::string>& outputLayout,
       core::JoinType joinType = core::JoinType::kInner);
 
+  /// Add a RangeJoinNode to join two inputs using one or two range conditions
+  /// and an optional filter. Only supports inner and left joins.
+  ///
+  /// @param right Right-side input.
+  /// @param conditions Range conditions of the form 'left <op> right' where
+  /// 'left' is a column of the left side, 'right' is a column of the right
+  /// side and <op> is one of <, <=, >, >=, e.g. {"ts >= start", "ts < end"}.
+  /// @param filter Optional SQL expression evaluated on the pairs of rows
+  /// matching the conditions. Can use columns from both sides of the join.
+  /// @param outputLayout Output layout consisting of columns from left and
+  /// right sides.
+  /// @param joinType Type of the join: inner or left.
+  PlanBuilder& rangeJoin(
+      const core::PlanNodePtr& right,
+      const std::vector<std::string>& conditions,
+      const std::string& filter,
+      const std::vector<std::string>& outputLayout,
+      core::JoinType joinType = core::JoinType::kInner);
+
   /// Add an UnnestNode to unnest one or more columns of type array or map.
   ///
   /// The output will contain 'replicatedColumns' followed by unnested columns,
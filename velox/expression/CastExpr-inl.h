@@ -367,6 +367,22 @@ void CastExpr::applyCastKernel(
       }
     }
 
+    if constexpr (
+        (ToKind == TypeKind::VARCHAR || ToKind == TypeKind::VARBINARY) &&
+        (FromKind == TypeKind::TINYINT || FromKind == TypeKind::SMALLINT ||
+         FromKind == TypeKind::INTEGER || FromKind == TypeKind::BIGINT)) {
+      // Format integers directly into the result buffer instead of making a
+      // std::string first. At most 20 characters for int64_t.
+      auto writer = exec::StringWriter<>(result, row);
+      writer.resize(20);
+      const auto [end, errorCode] = std::to_chars(
+          writer.data(), writer.data() + writer.size(), inputRowValue);
+      VELOX_DCHECK(errorCode == std::errc());
+      writer.resize(end - writer.data());
+      writer.finalize();
+      return;
+    }
+
     const auto castResult =
         util::Converter<ToKind, void, TPolicy>::tryCast(inputRowValue);
     if (castResult.hasError()) {
@@ -28,6 +28,7 @@
 #include "velox/functions/lib/RowsTranslationUtil.h"
 #include "velox/type/Type.h"
 #include "velox/vector/ComplexVector.h"
+#include "velox/vector/FlatMapVector.h"
 #include "velox/vector/FunctionVector.h"
 #include "velox/vector/SelectivityVector.h"
 
@@ -960,6 +961,10 @@ void CastExpr::apply(
         peeledVectors[0] =
             peeledVectors[0]->as<LazyVector>()->loadedVectorShared();
       }
+      if (peeledVectors[0]->encoding() == VectorEncoding::Simple::FLAT_MAP) {
+        peeledVectors[0] =
+            peeledVectors[0]->asUnchecked<FlatMapVector>()->mapVector();
+      }
       auto newRows =
           peeledEncoding->translateToInnerRows(*remainingRows, newRowsHolder);
       // Save context and set the peel.
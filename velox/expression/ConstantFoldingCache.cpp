@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/expression/ConstantFoldingCache.h"
+
+#include "velox/expression/SimpleFunctionRegistry.h"
+#include "velox/expression/SpecialFormRegistry.h"
+#include "velox/expression/VectorFunction.h"
+
+namespace facebook::velox::exec {
+
+ConstantFoldingCache::ConstantFoldingCache(
+    size_t maxEntries,
+    std::shared_ptr<memory::MemoryPool> pool)
+    : pool_(std::move(pool)), cache_(maxEntries) {}
+
+// static
+ConstantFoldingCache& ConstantFoldingCache::instance() {
+  static constexpr size_t kMaxEntries = 10'000;
+  // Leaked on purpose. Cached vectors must not outlive the pool.
+  static auto* cache = new ConstantFoldingCache(
+      kMaxEntries,
+      memory::memoryManager()->addLeafPool("ConstantFoldingCache"));
+  return *cache;
+}
+
+// static
+bool ConstantFoldingCache::isCacheable(const core::TypedExprPtr& expr) {
+  if (auto constant =
+          dynamic_cast<const core::ConstantTypedExpr*>(expr.get())) {
+    return !constant->hasValueVector();
+  }
+  if (dynamic_cast<const core::FieldAccessTypedExpr*>(expr.get()) ||
+      dynamic_cast<const core::InputTypedExpr*>(expr.get()) ||
+      dynamic_cast<const core::LambdaTypedExpr*>(expr.get())) {
+    return false;
+  }
+  for (const auto& input : expr->inputs()) {
+    if (!isCacheable(input)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// static
+bool ConstantFoldingCache::isFoldableAcrossQueries(
+    const core::TypedExprPtr& expr) {
+  // Special forms, e.g. casts, only depend on their inputs and the config.
+  auto* call = dynamic_cast<const core::CallTypedExpr*>(expr.get());
+  if (call && !isFunctionCallToSpecialFormRegistered(call->name())) {
+    std::vector<TypePtr> argTypes;
+    argTypes.reserve(call->inputs().size());
+    for (const auto& input : call->inputs()) {
+      argTypes.push_back(input->type());
+    }
+    // Resolves the function in the same order as the expression compiler.
+    if (auto vectorFunction =
+            resolveVectorFunctionWithMetadata(call->name(), argTypes)) {
+      if (!vectorFunction->second.deterministic ||
+          !vectorFunction->second.foldableAcrossQueries) {
+        return false;
+      }
+    } else if (
+        auto simpleFunction =
+            simpleFunctions().resolveFunction(call->name(), argTypes)) {
+      const auto& metadata = simpleFunction->metadata();
+      if (!metadata.deterministic || !metadata.foldableAcrossQueries) {
+        return false;
+      }
+    } else {
+      return false;
+    }
+  }
+  for (const auto& input : expr->inputs()) {
+    if (!isFoldableAcrossQueries(input)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+VectorPtr ConstantFoldingCache::get(
+    const core::TypedExprPtr& expr,
+    const std::string& configKey) {
+  std::lock_guard<std::mutex> l(mutex_);
+  ++numLookups_;
+  auto it = cache_.find(Key{expr, configKey});
+  if (it == cache_.end()) {
+    return nullptr;
+  }
+  ++numHits_;
+  return it->second;
+}
+
+void ConstantFoldingCache::put(
+    const core::TypedExprPtr& expr,
+    const std::string& configKey,
+    const VectorPtr& value) {
+  VELOX_CHECK_EQ(value->encoding(), VectorEncoding::Simple::CONSTANT);
+  if (value->retainedSize() > kMaxValueBytes ||
+      !isFoldableAcrossQueries(expr)) {
+    return;
+  }
+
+  // Copies 'value' out of the query pool it was evaluated in.
+  auto copy = BaseVector::create(value->type(), 1, pool_.get());
+  copy->copy(value.get(), 0, 0, 1);
+  auto cached = BaseVector::wrapInConstant(1, 0, std::move(copy));
+
+  std::lock_guard<std::mutex> l(mutex_);
+  cache_.set(Key{expr, configKey}, std::move(cached));
+}
+
+ConstantFoldingCache::Stats ConstantFoldingCache::stats() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  return {cache_.size(), numHits_, numLookups_};
+}
+
+void ConstantFoldingCache::clear() {
+  std::lock_guard<std::mutex> l(mutex_);
+  cache_.clear();
+  numHits_ = 0;
+  numLookups_ = 0;
+}
+
+} // namespace facebook::velox::exec
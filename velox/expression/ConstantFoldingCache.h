@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/container/EvictingCacheMap.h>
+#include <mutex>
+
+#include "velox/common/base/BitUtil.h"
+#include "velox/common/memory/Memory.h"
+#include "velox/core/Expressions.h"
+#include "velox/vector/BaseVector.h"
+
+namespace facebook::velox::exec {
+
+/// Caches the results of constant folding across ExprSets. Every driver of
+/// every task running a query of the same shape compiles the same constant
+/// subexpressions, e.g. casts of literals or calls with literal arguments, and
+/// evaluates them to fold them. A hit replaces the compilation and the
+/// evaluation of the whole subtree with the cached value.
+///
+/// Entries are keyed on the typed expression and on the query config, since
+/// the config may change the result, e.g. the session timezone. Only values of
+/// expressions whose functions are all deterministic and foldableAcrossQueries
+/// are cached. Functions that read the clock, e.g. current_date, are not, so
+/// the cache only holds values that are valid for any query. Values are single
+/// row constant vectors allocated from a pool owned by the cache. Thread-safe.
+class ConstantFoldingCache {
+ public:
+  /// Values retaining more memory than this are not cached.
+  static constexpr uint64_t kMaxValueBytes = 64 << 10;
+
+  struct Stats {
+    size_t numEntries{0};
+    size_t numHits{0};
+    size_t numLookups{0};
+  };
+
+  /// Keeps the 'maxEntries' most recently used values.
+  ConstantFoldingCache(
+      size_t maxEntries,
+      std::shared_ptr<memory::MemoryPool> pool);
+
+  /// Returns the process-wide cache used by the expression compiler.
+  static ConstantFoldingCache& instance();
+
+  /// Returns true if the value 'expr' folds to can be cached. 'expr' must not
+  /// read any input and must not contain constants backed by vectors, which
+  /// may be allocated from query pools.
+  static bool isCacheable(const core::TypedExprPtr& expr);
+
+  /// Returns true if 'expr' only calls special forms and deterministic
+  /// functions marked foldableAcrossQueries, so that its value may be reused
+  /// by other queries.
+  static bool isFoldableAcrossQueries(const core::TypedExprPtr& expr);
+
+  /// Returns the single row constant vector 'expr' folds to under the config
+  /// of 'configKey' or nullptr if not cached. 'configKey' is
+  /// QueryCtx::queryConfigKey().
+  VectorPtr get(const core::TypedExprPtr& expr, const std::string& configKey);
+
+  /// Caches a copy of 'value', the single row constant vector 'expr' folds to.
+  /// Does nothing unless isFoldableAcrossQueries('expr').
+  void put(
+      const core::TypedExprPtr& expr,
+      const std::string& configKey,
+      const VectorPtr& value);
+
+  Stats stats() const;
+
+  void clear();
+
+ private:
+  struct Key {
+    core::TypedExprPtr expr;
+    std::string configKey;
+
+    bool operator==(const Key& other) const {
+      return configKey == other.configKey && *expr == *other.expr;
+    }
+  };
+
+  struct KeyHasher {
+    size_t operator()(const Key& key) const {
+      return bits::hashMix(
+          key.expr->hash(), std::hash<std::string>()(key.configKey));
+    }
+  };
+
+  const std::shared_ptr<memory::MemoryPool> pool_;
+
+  mutable std::mutex mutex_;
+  folly::EvictingCacheMap<Key, VectorPtr, KeyHasher> cache_;
+  size_t numHits_{0};
+  size_t numLookups_{0};
+};
+
+} // namespace facebook::velox::exec
@@ -19,6 +19,7 @@
 #include <exception>
 #include <functional>
 #include <memory>
+#include <typeindex>
 
 #include "velox/common/base/Portability.h"
 #include "velox/core/QueryCtx.h"
@@ -531,6 +532,24 @@ class EvalCtx {
     return maxSharedSubexprResultsCached_;
   }
 
+  /// Returns data of type 'T' that functions derived from 'vector', e.g. an
+  /// index of the keys of the maps in a map vector. Returns a default
+  /// constructed 'T' on first use. The data lives as long as 'this', i.e. for
+  /// one batch, and is shared by all expressions evaluated with 'this'. Keeps
+  /// a reference to 'vector' so that it is not modified or recycled while the
+  /// data exists.
+  template <typename T>
+  T& derivedData(const VectorPtr& vector) {
+    const std::type_index type(typeid(T));
+    for (const auto& entry : derivedData_) {
+      if (entry.vector.get() == vector.get() && entry.type == type) {
+        return *std::static_pointer_cast<T>(entry.data);
+      }
+    }
+    derivedData_.push_back({vector, type, std::make_shared<T>()});
+    return *std::static_pointer_cast<T>(derivedData_.back().data);
+  }
+
  private:
   void ensureErrorsVectorSize(EvalErrorsPtr& errors, vector_size_t size) const;
 
@@ -581,6 +600,16 @@ class EvalCtx {
   // If 'captureErrorDetails()' is false, stores flags indicating which rows had
   // errors without storing actual exceptions.
   EvalErrorsPtr errors_;
+
+  struct DerivedData {
+    VectorPtr vector;
+    std::type_index type;
+    std::shared_ptr<void> data;
+  };
+
+  // Data derived from input vectors by functions. See derivedData(). There are
+  // few entries, typically one per map or array that is looked up.
+  std::vector<DerivedData> derivedData_;
 };
 
 /// Utility wrapper struct that is used to temporarily reset the value of the
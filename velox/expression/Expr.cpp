@@ -32,6 +32,7 @@
 #include "velox/expression/PeeledEncoding.h"
 #include "velox/expression/ScopedVarSetter.h"
 #include "velox/expression/VectorFunction.h"
+#include "velox/vector/FlatMapVector.h"
 #include "velox/vector/SelectivityVector.h"
 #include "velox/vector/VectorSaver.h"
 
@@ -1492,6 +1493,18 @@ bool Expr::applyFunctionWithPeeling(
   return true;
 }
 
+namespace {
+// Replaces FlatMapVector arguments with the MapVector holding the same maps.
+// The MapVector is materialized once per FlatMapVector.
+void replaceFlatMaps(std::vector<VectorPtr>& args) {
+  for (auto& arg : args) {
+    if (arg->encoding() == VectorEncoding::Simple::FLAT_MAP) {
+      arg = arg->asUnchecked<FlatMapVector>()->mapVector();
+    }
+  }
+}
+} // namespace
+
 void Expr::applyFunction(
     const SelectivityVector& rows,
     EvalCtx& context,
@@ -1500,6 +1513,10 @@ void Expr::applyFunction(
   stats_.numProcessedRows += rows.countSelected();
   auto timer = cpuWallTimer();
 
+  if (!vectorFunctionMetadata_.supportsFlatMapVectors) {
+    replaceFlatMaps(inputValues_);
+  }
+
   computeIsAsciiForInputs(vectorFunction_.get(), inputValues_, rows);
   auto isAscii = type()->isVarchar()
       ? computeIsAsciiForResult(vectorFunction_.get(), inputValues_, rows)
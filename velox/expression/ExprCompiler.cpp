@@ -18,6 +18,7 @@
 #include "velox/expression/CastExpr.h"
 #include "velox/expression/CoalesceExpr.h"
 #include "velox/expression/ConjunctExpr.h"
+#include "velox/expression/ConstantFoldingCache.h"
 #include "velox/expression/ConstantExpr.h"
 #include "velox/expression/Expr.h"
 #include "velox/expression/FieldReference.h"
@@ -85,6 +86,14 @@ struct Scope {
 
   std::vector<TypedExprPtr> rewrittenExpressions;
 
+  // Identifies the query config in ConstantFoldingCache. Owned by the
+  // QueryCtx. Null if the cache is not used.
+  const std::string* foldingCacheConfigKey{nullptr};
+
+  // True while compiling a subtree that was looked up in ConstantFoldingCache.
+  // Its subexpressions are neither looked up nor cached.
+  bool inFoldingCacheLookup{false};
+
   Scope(std::vector<std::string>&& _locals, Scope* _parent, ExprSet* _exprSet)
       : locals(_locals), parent(_parent), exprSet(_exprSet) {}
 
@@ -376,6 +385,24 @@ ExprPtr compileRewrittenExpression(
     return alreadyCompiled;
   }
 
+  // Takes the value of a constant subtree folded by an earlier compilation
+  // from the cache. Only the roots of cacheable subtrees are looked up.
+  bool foldingCacheMiss = false;
+  if (enableConstantFolding && scope->foldingCacheConfigKey != nullptr &&
+      !scope->inFoldingCacheLookup &&
+      !dynamic_cast<const core::ConstantTypedExpr*>(expr.get()) &&
+      ConstantFoldingCache::isCacheable(expr)) {
+    if (auto value = ConstantFoldingCache::instance().get(
+            expr, *scope->foldingCacheConfigKey)) {
+      ExprPtr constant = std::make_shared<ConstantExpr>(std::move(value));
+      constant->computeMetadata();
+      scope->visited[expr.get()] = constant;
+      return constant;
+    }
+    foldingCacheMiss = true;
+    scope->inFoldingCacheLookup = true;
+  }
+
   const bool trackCpuUsage = config.exprTrackCpuUsage();
 
   ExprPtr result;
@@ -514,6 +541,15 @@ ExprPtr compileRewrittenExpression(
   auto folded = enableConstantFolding && !isConstantExpr
       ? tryFoldIfConstant(result, scope)
       : result;
+  if (foldingCacheMiss) {
+    scope->inFoldingCacheLookup = false;
+    if (folded != result) {
+      ConstantFoldingCache::instance().put(
+          expr,
+          *scope->foldingCacheConfigKey,
+          static_cast<const ConstantExpr*>(folded.get())->value());
+    }
+  }
   scope->visited[expr.get()] = folded;
   return folded;
 }
@@ -585,6 +621,11 @@ std::vector<std::shared_ptr<Expr>> compileExpressions(
   std::vector<std::shared_ptr<Expr>> exprs;
   exprs.reserve(sources.size());
 
+  const auto& config = execCtx->queryCtx()->queryConfig();
+  if (enableConstantFolding && config.exprConstantFoldingCacheEnabled()) {
+    scope.foldingCacheConfigKey = &execCtx->queryCtx()->queryConfigKey();
+  }
+
   // Precompute a set of function calls that support flattening. This allows to
   // lock function registry once vs. locking for each function call.
   auto flatteningCandidates = collectFlatteningCandidates(sources);
@@ -593,7 +634,7 @@ std::vector<std::shared_ptr<Expr>> compileExpressions(
     exprs.push_back(compileExpression(
         source,
         &scope,
-        execCtx->queryCtx()->queryConfig(),
+        config,
         execCtx->pool(),
         flatteningCandidates,
         enableConstantFolding));
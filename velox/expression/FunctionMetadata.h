@@ -40,6 +40,17 @@ struct VectorFunctionMetadata {
   /// In this case, 'rows' in VectorFunction::apply will point only to positions
   /// for which all arguments are not null.
   bool defaultNullBehavior{true};
+
+  /// True if the result only depends on the arguments and the query config,
+  /// so that the value a call with constant arguments folds to can be reused
+  /// by later queries. Deterministic functions that read the clock, e.g.
+  /// current_date, set this to false. See ConstantFoldingCache.
+  bool foldableAcrossQueries{true};
+
+  /// True if the function handles FlatMapVector arguments, e.g. to read only
+  /// the values of a constant key. Otherwise FlatMapVector arguments are
+  /// replaced by their MapVector before the function is called.
+  bool supportsFlatMapVectors{false};
 };
 
 class VectorFunctionMetadataBuilder {
@@ -59,6 +70,18 @@ class VectorFunctionMetadataBuilder {
     return *this;
   }
 
+  VectorFunctionMetadataBuilder& foldableAcrossQueries(
+      bool foldableAcrossQueries) {
+    metadata_.foldableAcrossQueries = foldableAcrossQueries;
+    return *this;
+  }
+
+  VectorFunctionMetadataBuilder& supportsFlatMapVectors(
+      bool supportsFlatMapVectors) {
+    metadata_.supportsFlatMapVectors = supportsFlatMapVectors;
+    return *this;
+  }
+
   const VectorFunctionMetadata& build() const {
     return metadata_;
   }
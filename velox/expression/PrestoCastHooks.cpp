@@ -22,6 +22,7 @@
 #include "velox/expression/PrestoCastHooks.h"
 #include "velox/external/date/tz.h"
 #include "velox/functions/lib/string/StringImpl.h"
+#include "velox/type/Conversions.h"
 #include "velox/type/TimestampConversion.h"
 
 namespace facebook::velox::exec {
@@ -97,6 +98,10 @@ Expected<T> doCastToFloatingPoint(const StringView& data) {
     // 'data' only contains white spaces.
     return folly::makeUnexpected(Status::UserError());
   }
+  if (const auto value =
+          util::detail::tryParseFloatingPoint<T>(begin, length)) {
+    return value.value();
+  }
   if constexpr (std::is_same_v<T, float>) {
     result = stringToDoubleConverter.StringToFloat(
         begin, length, &processedCharactersCount);
@@ -107,7 +107,8 @@ SimpleFunctionRegistry::getFunctionSignaturesAndMetadata(
         VectorFunctionMetadata metadata{
             false,
             functions[0]->getMetadata().isDeterministic(),
-            functions[0]->getMetadata().defaultNullBehavior()};
+            functions[0]->getMetadata().defaultNullBehavior(),
+            functions[0]->getMetadata().isFoldableAcrossQueries()};
         result.emplace_back(
             std::pair<VectorFunctionMetadata, const FunctionSignature*>{
                 metadata, &signature});
@@ -15,8 +15,11 @@
  */
 #include "gtest/gtest.h"
 #include "velox/common/base/tests/GTestUtils.h"
+#include "velox/expression/ConstantFoldingCache.h"
 #include "velox/expression/Expr.h"
 #include "velox/expression/FieldReference.h"
+#include "velox/functions/Macros.h"
+#include "velox/functions/Registerer.h"
 #include "velox/functions/prestosql/registration/RegistrationFunctions.h"
 #include "velox/functions/prestosql/types/JsonType.h"
 #include "velox/parse/Expressions.h"
@@ -123,6 +126,129 @@ TEST_F(ExprCompilerTest, constantFolding) {
       "plus(plus(a, 1:BIGINT), 5:BIGINT)", compile(expression)->toString());
 }
 
+TEST_F(ExprCompilerTest, constantFoldingCache) {
+  auto& cache = ConstantFoldingCache::instance();
+  cache.clear();
+
+  auto rowType = ROW({"a", "b"}, {BIGINT(), VARCHAR()});
+  auto field = makeField(rowType);
+
+  // a + cast('6' as bigint), concat(b, upper('abc')). The values of the cast
+  // and of upper are reused across queries.
+  std::vector<core::TypedExprPtr> expressions = {
+      call(
+          "plus",
+          {field("a"),
+           std::make_shared<core::CastTypedExpr>(
+               BIGINT(), varchar("6"), false)}),
+      concatCall({field("b"), call("upper", {varchar("abc")})})};
+
+  auto makeQueryCtx =
+      [&](std::unordered_map<std::string, std::string> config) {
+        return core::QueryCtx::create(
+            nullptr, core::QueryConfig(std::move(config)));
+      };
+
+  auto compileAndEval = [&](const std::shared_ptr<core::QueryCtx>& queryCtx) {
+    core::ExecCtx execCtx(pool(), queryCtx.get());
+    auto exprSet = std::make_unique<ExprSet>(expressions, &execCtx);
+
+    auto data = makeRowVector(
+        {makeFlatVector<int64_t>({1, 2}),
+         makeFlatVector<std::string>({"x", "y"})});
+    SelectivityVector rows(data->size());
+    std::vector<VectorPtr> results(2);
+    EvalCtx evalCtx(&execCtx, exprSet.get(), data.get());
+    exprSet->eval(rows, evalCtx, results);
+    velox::test::assertEqualVectors(
+        makeFlatVector<int64_t>({7, 8}), results[0]);
+    velox::test::assertEqualVectors(
+        makeFlatVector<std::string>({"xABC", "yABC"}), results[1]);
+    return exprSet->toString();
+  };
+
+  const std::unordered_map<std::string, std::string> enabled = {
+      {core::QueryConfig::kExprConstantFoldingCacheEnabled, "true"}};
+
+  // The first compilation folds the constants and caches them.
+  auto queryCtx = makeQueryCtx(enabled);
+  auto expected = compileAndEval(queryCtx);
+  ASSERT_EQ(cache.stats().numEntries, 2);
+  ASSERT_EQ(cache.stats().numLookups, 2);
+  ASSERT_EQ(cache.stats().numHits, 0);
+
+  // Another compilation for the same query takes both from the cache.
+  ASSERT_EQ(compileAndEval(queryCtx), expected);
+  ASSERT_EQ(cache.stats().numEntries, 2);
+  ASSERT_EQ(cache.stats().numLookups, 4);
+  ASSERT_EQ(cache.stats().numHits, 2);
+
+  // Another query with the same config also takes both from the cache.
+  ASSERT_EQ(compileAndEval(makeQueryCtx(enabled)), expected);
+  ASSERT_EQ(cache.stats().numEntries, 2);
+  ASSERT_EQ(cache.stats().numLookups, 6);
+  ASSERT_EQ(cache.stats().numHits, 4);
+
+  // A different config does not hit.
+  auto otherConfig = enabled;
+  otherConfig[core::QueryConfig::kSessionTimezone] = "America/New_York";
+  ASSERT_EQ(compileAndEval(makeQueryCtx(otherConfig)), expected);
+  ASSERT_EQ(cache.stats().numEntries, 4);
+  ASSERT_EQ(cache.stats().numLookups, 8);
+  ASSERT_EQ(cache.stats().numHits, 4);
+
+  // The cache is not used by default.
+  ASSERT_EQ(compileAndEval(makeQueryCtx({})), expected);
+  ASSERT_EQ(cache.stats().numLookups, 8);
+
+  cache.clear();
+}
+
+namespace {
+template <typename T>
+struct NotFoldableNegateFunction {
+  VELOX_DEFINE_FUNCTION_TYPES(T);
+
+  static constexpr bool is_foldable_across_queries = false;
+
+  void call(int64_t& result, int64_t input) {
+    result = -input;
+  }
+};
+} // namespace
+
+TEST_F(ExprCompilerTest, foldableAcrossQueries) {
+  registerFunction<NotFoldableNegateFunction, int64_t, int64_t>(
+      {"not_foldable_negate"});
+
+  auto isFoldable = [](const core::TypedExprPtr& expr) {
+    return ConstantFoldingCache::isFoldableAcrossQueries(expr);
+  };
+
+  ASSERT_TRUE(isFoldable(bigint(1)));
+  ASSERT_TRUE(isFoldable(
+      std::make_shared<core::CastTypedExpr>(BIGINT(), varchar("1"), false)));
+  ASSERT_TRUE(isFoldable(call("upper", {varchar("abc")})));
+  ASSERT_TRUE(isFoldable(std::make_shared<core::CastTypedExpr>(
+      BIGINT(), call("upper", {varchar("1")}), false)));
+
+  // Functions that opt out are not foldable across queries, e.g. current_date
+  // depends on when the query runs.
+  ASSERT_FALSE(isFoldable(call("current_date", {})));
+  ASSERT_FALSE(isFoldable(call("not_foldable_negate", {bigint(1)})));
+  ASSERT_FALSE(isFoldable(std::make_shared<core::CastTypedExpr>(
+      VARCHAR(), call("not_foldable_negate", {bigint(1)}), false)));
+
+  // Their values are not cached.
+  auto& cache = ConstantFoldingCache::instance();
+  cache.clear();
+  cache.put(
+      call("current_date", {}),
+      "",
+      BaseVector::createNullConstant(DATE(), 1, pool()));
+  ASSERT_EQ(cache.stats().numEntries, 0);
+}
+
 TEST_F(ExprCompilerTest, andFlattening) {
   auto rowType =
       ROW({"a", "b", "c", "d"}, {BOOLEAN(), BOOLEAN(), BOOLEAN(), BOOLEAN()});
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#include <xsimd/xsimd.hpp>
+
+#include "velox/common/base/BitUtil.h"
+#include "velox/common/base/SimdUtil.h"
+#include "velox/type/FloatingPointUtil.h"
+
+namespace facebook::velox::functions {
+
+/// Set of distinct values for the array set functions, e.g. array_distinct,
+/// array_intersect and array_except, which build one set per row. Most arrays
+/// are small, so the values are first kept in an array and searched linearly,
+/// comparing a batch of values at a time with SIMD for numeric types. Once
+/// the set has more than kMaxSmallSize values it moves to a hash set.
+///
+/// clear() keeps the memory of both representations so that one set can be
+/// reused for all rows of a batch without allocating. NaNs are equal to each
+/// other, like in util::floating_point::HashSetNaNAware.
+template <typename T>
+class AdaptiveValueSet {
+ public:
+  static constexpr bool kSimd = std::is_same_v<T, int8_t> ||
+      std::is_same_v<T, int16_t> || std::is_same_v<T, int32_t> ||
+      std::is_same_v<T, int64_t> || std::is_same_v<T, float> ||
+      std::is_same_v<T, double>;
+
+  /// Maximum number of values searched linearly.
+  static constexpr int32_t kMaxSmallSize = kSimd ? 32 : 8;
+
+  AdaptiveValueSet() : small_(kSmallCapacity) {}
+
+  /// Inserts 'value'. Returns true if 'value' was not in the set.
+  bool insert(const T& value) {
+    if (isLarge_) {
+      return large_.insert(value).second;
+    }
+    if constexpr (std::is_floating_point_v<T>) {
+      if (std::isnan(value)) {
+        const bool inserted = !hasNaN_;
+        hasNaN_ = true;
+        return inserted;
+      }
+    }
+    if (containsSmall(value)) {
+      return false;
+    }
+    if (numSmall_ == kMaxSmallSize) {
+      makeLarge();
+      return large_.insert(value).second;
+    }
+    small_[numSmall_++] = value;
+    return true;
+  }
+
+  bool contains(const T& value) const {
+    if (isLarge_) {
+      return large_.count(value) > 0;
+    }
+    if constexpr (std::is_floating_point_v<T>) {
+      if (std::isnan(value)) {
+        return hasNaN_;
+      }
+    }
+    return containsSmall(value);
+  }
+
+  size_t size() const {
+    return isLarge_ ? large_.size() : numSmall_ + hasNaN_;
+  }
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  /// Prepares the hash set for 'size' values if that many do not fit the
+  /// array.
+  void reserve(size_t size) {
+    if (size > kMaxSmallSize) {
+      large_.reserve(size);
+    }
+  }
+
+  void clear() {
+    numSmall_ = 0;
+    hasNaN_ = false;
+    if (isLarge_) {
+      large_.clear();
+      isLarge_ = false;
+    }
+  }
+
+ private:
+  // The SIMD search reads full batches past the last value.
+  static constexpr int32_t kSmallCapacity =
+      kMaxSmallSize + simd::kPadding / sizeof(T);
+
+  bool containsSmall(const T& value) const {
+    if constexpr (kSimd) {
+      using Batch = xsimd::batch<T>;
+      const auto target = Batch::broadcast(value);
+      for (int32_t i = 0; i < numSmall_; i += Batch::size) {
+        uint64_t matches = simd::toBitMask(
+            Batch::load_unaligned(small_.data() + i) == target);
+        if (numSmall_ - i < Batch::size) {
+          matches &= bits::lowMask(numSmall_ - i);
+        }
+        if (matches) {
+          return true;
+        }
+      }
+      return false;
+    } else {
+      for (int32_t i = 0; i < numSmall_; ++i) {
+        if (small_[i] == value) {
+          return true;
+        }
+      }
+      return false;
+    }
+  }
+
+  void makeLarge() {
+    for (int32_t i = 0; i < numSmall_; ++i) {
+      large_.insert(small_[i]);
+    }
+    if constexpr (std::is_floating_point_v<T>) {
+      if (hasNaN_) {
+        large_.insert(std::numeric_limits<T>::quiet_NaN());
+      }
+    }
+    isLarge_ = true;
+  }
+
+  // The values while the set is small. Sized to kSmallCapacity.
+  std::vector<T> small_;
+  int32_t numSmall_{0};
+
+  // True if the small set contains NaN. NaNs are not kept in 'small_'
+  // because they do not compare equal.
+  bool hasNaN_{false};
+
+  // True if the values are in 'large_'.
+  bool isLarge_{false};
+  util::floating_point::HashSetNaNAware<T> large_;
+};
+
+} // namespace facebook::velox::functions
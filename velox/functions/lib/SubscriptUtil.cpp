@@ -16,12 +16,14 @@
 
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <type_traits>
 #include <utility>
 
 #include "velox/common/memory/MemoryPool.h"
 #include "velox/functions/lib/SubscriptUtil.h"
 #include "velox/type/Type.h"
+#include "velox/vector/FlatMapVector.h"
 #include "velox/vector/TypeAliases.h"
 
 namespace facebook::velox::functions {
@@ -52,6 +54,34 @@ struct SimpleType<TypeKind::VARCHAR> {
   using type = Varchar;
 };
 
+/// Index of the keys of the maps of a non-constant map vector. Kept in the
+/// EvalCtx so that all subscripts into the same vector in one batch share it.
+/// A map is indexed the second time it is looked up, i.e. when more than one
+/// subscript reads it or the map is referenced from more than one row.
+struct MapKeyIndex {
+  // Maps with fewer keys are searched linearly.
+  static constexpr vector_size_t kMinIndexedMapSize = 32;
+
+  // Returns true if the map at 'mapIndex' was looked up before. Records the
+  // lookup.
+  bool isRepeatedLookup(vector_size_t mapIndex, vector_size_t numMaps) {
+    if (lookedUp.empty()) {
+      lookedUp.resize(bits::nwords(numMaps));
+    }
+    if (bits::isBitSet(lookedUp.data(), mapIndex)) {
+      return true;
+    }
+    bits::setBit(lookedUp.data(), mapIndex);
+    return false;
+  }
+
+  // Bit per map of the vector. Set after the first lookup into the map.
+  std::vector<uint64_t> lookedUp;
+
+  // Key to offset maps of the maps looked up more than once.
+  std::shared_ptr<LookupTableBase> lookupTable;
+};
+
 /// Decode arguments and transform result into a dictionaryVector where the
 /// dictionary maintains a mapping from a given row to the index of the input
 /// map value vector. This allows us to ensure that element_at is zero-copy.
@@ -104,6 +134,33 @@ VectorPtr applyMapTyped(
   auto rawSizes = baseMap->rawSizes();
   auto rawOffsets = baseMap->rawOffsets();
 
+  // Maps that are not constant across batches are indexed for the current
+  // batch only.
+  MapKeyIndex* keyIndex = nullptr;
+  if (!triggerCaching && context.cacheEnabled()) {
+    const auto& baseMapPtr = BaseVector::wrappedVectorShared(mapArg);
+    VELOX_DCHECK_EQ(baseMapPtr.get(), decodedMap->base());
+    keyIndex = &context.derivedData<MapKeyIndex>(baseMapPtr);
+  }
+
+  // Returns the lookup table to search the map at 'mapIndex' with, or nullptr
+  // to search the map linearly.
+  auto lookupTableFor = [&](vector_size_t mapIndex,
+                            vector_size_t size) -> LookupTable<kind>* {
+    if (triggerCaching) {
+      return size >= kMinCachedMapSize ? typedLookupTable : nullptr;
+    }
+    if (keyIndex == nullptr || size < MapKeyIndex::kMinIndexedMapSize ||
+        !keyIndex->isRepeatedLookup(mapIndex, baseMap->size())) {
+      return nullptr;
+    }
+    if (!keyIndex->lookupTable) {
+      keyIndex->lookupTable =
+          std::make_shared<LookupTable<kind>>(*context.pool());
+    }
+    return keyIndex->lookupTable->typedTable<kind>();
+  };
+
   // Lambda that does the search for a key, for each row.
   auto processRow = [&](vector_size_t row, TKey searchKey) {
     size_t mapIndex = mapIndices[row];
@@ -112,20 +169,18 @@ VectorPtr applyMapTyped(
     size_t offsetEnd = offsetStart + size;
     bool found = false;
 
-    if (triggerCaching && size >= kMinCachedMapSize) {
-      VELOX_DCHECK_NOT_NULL(typedLookupTable);
-
+    if (auto* lookupTable = lookupTableFor(mapIndex, size)) {
       // Create map for mapIndex if not created.
-      if (!typedLookupTable->containsMapAtIndex(mapIndex)) {
-        typedLookupTable->ensureMapAtIndex(mapIndex);
+      if (!lookupTable->containsMapAtIndex(mapIndex)) {
+        lookupTable->ensureMapAtIndex(mapIndex);
         // Materialize the map at index row.
-        auto& map = typedLookupTable->getMapAtIndex(mapIndex);
+        auto& map = lookupTable->getMapAtIndex(mapIndex);
         for (size_t offset = offsetStart; offset < offsetEnd; ++offset) {
           map.emplace(decodedMapKeys->valueAt<TKey>(offset), offset);
         }
       }
 
-      auto& map = typedLookupTable->getMapAtIndex(mapIndex);
+      auto& map = lookupTable->getMapAtIndex(mapIndex);
 
       // Fast lookup.
       auto value = map.find(searchKey);
@@ -300,6 +355,60 @@ VectorPtr applyMapComplexType(
       nullsBuilder.build(), indices, rows.end(), baseMap->mapValues());
 }
 
+/// Subscript with a constant key into a FlatMapVector. Returns the values of
+/// the key, with nulls for the maps that do not contain it, without touching
+/// the other keys.
+VectorPtr applyFlatMapConstantKey(
+    const SelectivityVector& rows,
+    const FlatMapVector& flatMap,
+    const DecodedVector& decodedIndex,
+    exec::EvalCtx& context) {
+  std::optional<column_index_t> channel;
+  switch (flatMap.type()->childAt(0)->kind()) {
+    case TypeKind::TINYINT:
+      channel = flatMap.keyChannel(decodedIndex.valueAt<int8_t>(0));
+      break;
+    case TypeKind::SMALLINT:
+      channel = flatMap.keyChannel(decodedIndex.valueAt<int16_t>(0));
+      break;
+    case TypeKind::INTEGER:
+      channel = flatMap.keyChannel(decodedIndex.valueAt<int32_t>(0));
+      break;
+    case TypeKind::BIGINT:
+      channel = flatMap.keyChannel(decodedIndex.valueAt<int64_t>(0));
+      break;
+    case TypeKind::VARCHAR:
+    case TypeKind::VARBINARY:
+      channel = flatMap.keyChannel(decodedIndex.valueAt<StringView>(0));
+      break;
+    default:
+      VELOX_UNREACHABLE();
+  }
+  const auto& valueType = flatMap.type()->childAt(1);
+  if (!channel.has_value()) {
+    return BaseVector::createNullConstant(
+        valueType, rows.end(), context.pool());
+  }
+
+  const auto& values = flatMap.mapValuesAt(*channel);
+  if (flatMap.inMapsAt(*channel) == nullptr && !flatMap.mayHaveNulls()) {
+    return values;
+  }
+
+  // Adds nulls for the maps that do not contain the key.
+  NullsBuilder nullsBuilder(rows.end(), context.pool());
+  rows.applyToSelected([&](vector_size_t row) {
+    if (!flatMap.isInMap(*channel, row)) {
+      nullsBuilder.setNull(row);
+    }
+  });
+  auto indices = allocateIndices(rows.end(), context.pool());
+  auto* rawIndices = indices->asMutable<vector_size_t>();
+  std::iota(rawIndices, rawIndices + rows.end(), 0);
+  return BaseVector::wrapInDictionary(
+      nullsBuilder.build(), indices, rows.end(), values);
+}
+
 } // namespace
 
 VectorPtr MapSubscript::applyMap(
@@ -312,6 +421,18 @@ VectorPtr MapSubscript::applyMap(
   // Ensure map key type and second argument are the same.
   VELOX_CHECK(mapArg->type()->childAt(0)->equivalent(*indexArg->type()));
 
+  if (mapArg->encoding() == VectorEncoding::Simple::FLAT_MAP) {
+    exec::LocalDecodedVector indexHolder(context, *indexArg, rows);
+    if (indexHolder.get()->isConstantMapping() &&
+        !indexHolder.get()->isNullAt(0)) {
+      return applyFlatMapConstantKey(
+          rows,
+          *mapArg->asUnchecked<FlatMapVector>(),
+          *indexHolder.get(),
+          context);
+    }
+  }
+
   if (indexArg->type()->isPrimitiveType()) {
     bool triggerCaching = shouldTriggerCaching(mapArg);
 
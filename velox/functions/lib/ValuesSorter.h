@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include "velox/type/FloatingPointUtil.h"
+#include "velox/vector/TypeAliases.h"
+
+namespace facebook::velox::functions {
+
+/// Sorts runs of non-null values of a primitive type in place, e.g. the
+/// elements of each array for array_sort. Picks the algorithm by run size:
+/// insertion sort for short runs, which are the common case for arrays, LSD
+/// radix sort for long runs of integers and floating point values, and
+/// std::sort otherwise. NaNs are larger than all other values, like
+/// util::floating_point::NaNAwareLessThan.
+///
+/// Keeps its scratch memory, so one sorter should be used for all arrays of
+/// a batch.
+template <typename T>
+class ValuesSorter {
+ public:
+  /// Runs of at most this many values are sorted by insertion sort.
+  static constexpr vector_size_t kMaxInsertionSortSize = 16;
+
+  /// Runs of at least this many values are radix sorted if 'T' supports it.
+  static constexpr vector_size_t kMinRadixSortSize = 256;
+
+  static constexpr bool kRadixSortable = std::is_same_v<T, int8_t> ||
+      std::is_same_v<T, int16_t> || std::is_same_v<T, int32_t> ||
+      std::is_same_v<T, int64_t> || std::is_same_v<T, float> ||
+      std::is_same_v<T, double>;
+
+  /// Sorts 'values[0, size)' in ascending or descending order.
+  void sort(T* values, vector_size_t size, bool ascending) {
+    if (size < 2) {
+      return;
+    }
+    if (ascending) {
+      sortImpl(values, size, Less());
+    } else {
+      sortImpl(values, size, Greater());
+    }
+  }
+
+ private:
+  using Less = std::conditional_t<
+      std::is_floating_point_v<T>,
+      util::floating_point::NaNAwareLessThan<T>,
+      std::less<T>>;
+  using Greater = std::conditional_t<
+      std::is_floating_point_v<T>,
+      util::floating_point::NaNAwareGreaterThan<T>,
+      std::greater<T>>;
+
+  template <typename Compare>
+  void sortImpl(T* values, vector_size_t size, Compare compare) {
+    if (size <= kMaxInsertionSortSize) {
+      insertionSort(values, size, compare);
+      return;
+    }
+    if constexpr (kRadixSortable) {
+      if (size >= kMinRadixSortSize) {
+        radixSort(values, size);
+        if constexpr (std::is_same_v<Compare, Greater>) {
+          std::reverse(values, values + size);
+        }
+        return;
+      }
+    }
+    std::sort(values, values + size, compare);
+  }
+
+  template <typename Compare>
+  static void insertionSort(T* values, vector_size_t size, Compare compare) {
+    for (vector_size_t i = 1; i < size; ++i) {
+      T value = values[i];
+      vector_size_t j = i;
+      for (; j > 0 && compare(value, values[j - 1]); --j) {
+        values[j] = values[j - 1];
+      }
+      values[j] = value;
+    }
+  }
+
+  // Unsigned integer of the size of 'T'.
+  using RadixKey = std::conditional_t<
+      sizeof(T) == 1,
+      uint8_t,
+      std::conditional_t<
+          sizeof(T) == 2,
+          uint16_t,
+          std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+  // Returns an unsigned key that orders like 'value'.
+  static RadixKey radixKey(T value) {
+    constexpr RadixKey kSignBit = RadixKey(1) << (sizeof(RadixKey) * 8 - 1);
+    if constexpr (std::is_floating_point_v<T>) {
+      if (std::isnan(value)) {
+        return ~RadixKey(0);
+      }
+      RadixKey bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      // Negative values order in reverse of their bits.
+      return (bits & kSignBit) ? ~bits : bits | kSignBit;
+    } else {
+      return static_cast<RadixKey>(value) ^ kSignBit;
+    }
+  }
+
+  // Sorts ascending one byte of the keys at a time, skipping bytes that are
+  // the same in all values.
+  void radixSort(T* values, vector_size_t size) {
+    scratch_.resize(size);
+    T* from = values;
+    T* to = scratch_.data();
+    std::array<vector_size_t, 256> counts;
+    constexpr int32_t kKeyBits = sizeof(RadixKey) * 8;
+    for (int32_t shift = 0; shift < kKeyBits; shift += 8) {
+      counts.fill(0);
+      for (vector_size_t i = 0; i < size; ++i) {
+        ++counts[(radixKey(from[i]) >> shift) & 0xff];
+      }
+      if (counts[(radixKey(from[0]) >> shift) & 0xff] == size) {
+        continue;
+      }
+      vector_size_t offset = 0;
+      for (auto& count : counts) {
+        const auto numValues = count;
+        count = offset;
+        offset += numValues;
+      }
+      for (vector_size_t i = 0; i < size; ++i) {
+        to[counts[(radixKey(from[i]) >> shift) & 0xff]++] = from[i];
+      }
+      std::swap(from, to);
+    }
+    if (from != values) {
+      std::copy(from, from + size, values);
+    }
+  }
+
+  std::vector<T> scratch_;
+};
+
+} // namespace facebook::velox::functions
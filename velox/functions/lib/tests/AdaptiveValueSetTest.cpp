@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "velox/functions/lib/AdaptiveValueSet.h"
+#include "velox/type/StringView.h"
+
+namespace facebook::velox::functions {
+namespace {
+
+template <typename T>
+class AdaptiveValueSetTest : public testing::Test {};
+
+using NumericTypes =
+    testing::Types<int8_t, int16_t, int32_t, int64_t, float, double>;
+TYPED_TEST_SUITE(AdaptiveValueSetTest, NumericTypes);
+
+TYPED_TEST(AdaptiveValueSetTest, smallAndLarge) {
+  using T = TypeParam;
+  constexpr int32_t kMaxSmallSize = AdaptiveValueSet<T>::kMaxSmallSize;
+  AdaptiveValueSet<T> set;
+
+  // Fills the set past the small size twice to check that clear() returns to
+  // the small representation.
+  for (auto round = 0; round < 2; ++round) {
+    ASSERT_TRUE(set.empty());
+    for (auto i = 0; i < kMaxSmallSize + 10; ++i) {
+      ASSERT_TRUE(set.insert(static_cast<T>(i * 3)));
+      ASSERT_FALSE(set.insert(static_cast<T>(i * 3)));
+      ASSERT_EQ(set.size(), i + 1);
+      for (auto j = 0; j <= i; ++j) {
+        ASSERT_TRUE(set.contains(static_cast<T>(j * 3))) << i << " " << j;
+        ASSERT_FALSE(set.contains(static_cast<T>(j * 3 + 1)));
+      }
+    }
+    set.clear();
+  }
+
+  // Partial batches do not match stale values.
+  ASSERT_TRUE(set.insert(1));
+  ASSERT_FALSE(set.contains(6));
+}
+
+TYPED_TEST(AdaptiveValueSetTest, nan) {
+  using T = TypeParam;
+  if constexpr (std::is_floating_point_v<T>) {
+    const auto nan = std::numeric_limits<T>::quiet_NaN();
+    AdaptiveValueSet<T> set;
+    ASSERT_FALSE(set.contains(nan));
+    ASSERT_TRUE(set.insert(nan));
+    ASSERT_FALSE(set.insert(-nan));
+    ASSERT_TRUE(set.contains(nan));
+    ASSERT_EQ(set.size(), 1);
+
+    // NaN is kept when the set becomes large.
+    for (auto i = 0; i < AdaptiveValueSet<T>::kMaxSmallSize + 1; ++i) {
+      ASSERT_TRUE(set.insert(i));
+    }
+    ASSERT_TRUE(set.contains(nan));
+    ASSERT_FALSE(set.insert(nan));
+    ASSERT_EQ(set.size(), AdaptiveValueSet<T>::kMaxSmallSize + 2);
+  }
+}
+
+TEST(AdaptiveValueSetNonSimdTest, strings) {
+  AdaptiveValueSet<StringView> set;
+  std::vector<std::string> strings;
+  for (auto i = 0; i < 20; ++i) {
+    strings.push_back(fmt::format("a string that is not inlined {}", i));
+  }
+  for (const auto& string : strings) {
+    ASSERT_TRUE(set.insert(StringView(string)));
+  }
+  for (const auto& string : strings) {
+    ASSERT_FALSE(set.insert(StringView(string)));
+    ASSERT_TRUE(set.contains(StringView(string)));
+  }
+  ASSERT_EQ(set.size(), strings.size());
+  ASSERT_FALSE(set.contains(StringView("other")));
+
+  AdaptiveValueSet<bool> bools;
+  ASSERT_TRUE(bools.insert(true));
+  ASSERT_FALSE(bools.insert(true));
+  ASSERT_FALSE(bools.contains(false));
+  ASSERT_TRUE(bools.insert(false));
+}
+
+} // namespace
+} // namespace facebook::velox::functions
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "velox/functions/lib/ValuesSorter.h"
+#include "velox/type/StringView.h"
+
+namespace facebook::velox::functions {
+namespace {
+
+template <typename T>
+class ValuesSorterTest : public testing::Test {
+ protected:
+  std::vector<T> makeValues(vector_size_t size) {
+    std::vector<T> values(size);
+    for (auto& value : values) {
+      if constexpr (std::is_floating_point_v<T>) {
+        value = std::uniform_real_distribution<T>(-1e6, 1e6)(rng_);
+        // Adds NaNs of both signs, negative zeros and infinities.
+        switch (rng_() % 16) {
+          case 0:
+            value = std::numeric_limits<T>::quiet_NaN();
+            break;
+          case 1:
+            value = -std::numeric_limits<T>::quiet_NaN();
+            break;
+          case 2:
+            value = -0.0;
+            break;
+          case 3:
+            value = -std::numeric_limits<T>::infinity();
+            break;
+          default:
+            break;
+        }
+      } else {
+        value = static_cast<T>(rng_());
+      }
+    }
+    return values;
+  }
+
+  void testSort(vector_size_t size, bool ascending) {
+    auto values = makeValues(size);
+    auto expected = values;
+    if (ascending) {
+      std::sort(
+          expected.begin(),
+          expected.end(),
+          util::floating_point::NaNAwareLessThan<T>());
+    } else {
+      std::sort(
+          expected.begin(),
+          expected.end(),
+          util::floating_point::NaNAwareGreaterThan<T>());
+    }
+
+    sorter_.sort(values.data(), size, ascending);
+    for (auto i = 0; i < size; ++i) {
+      if constexpr (std::is_floating_point_v<T>) {
+        if (std::isnan(expected[i])) {
+          ASSERT_TRUE(std::isnan(values[i])) << size << " " << i;
+          continue;
+        }
+      }
+      ASSERT_EQ(values[i], expected[i]) << size << " " << i;
+    }
+  }
+
+  std::mt19937 rng_{1};
+  ValuesSorter<T> sorter_;
+};
+
+using RadixSortableTypes =
+    testing::Types<int8_t, int16_t, int32_t, int64_t, float, double>;
+TYPED_TEST_SUITE(ValuesSorterTest, RadixSortableTypes);
+
+TYPED_TEST(ValuesSorterTest, sizes) {
+  // Covers insertion sort, std::sort and radix sort. The sorter is reused.
+  for (auto size : {0, 1, 2, 7, 16, 17, 100, 255, 256, 1'000, 10'000}) {
+    this->testSort(size, true);
+    this->testSort(size, false);
+  }
+}
+
+TYPED_TEST(ValuesSorterTest, sameHighBytes) {
+  // Radix sort skips the bytes that are the same in all values.
+  using T = TypeParam;
+  std::vector<T> values;
+  for (auto i = 0; i < 1'000; ++i) {
+    values.push_back(static_cast<T>((i * 37) % 100));
+  }
+  auto expected = values;
+  std::sort(expected.begin(), expected.end());
+  this->sorter_.sort(values.data(), values.size(), true);
+  ASSERT_EQ(values, expected);
+}
+
+TEST(ValuesSorterNonRadixTest, strings) {
+  std::vector<std::string> strings;
+  for (auto i = 0; i < 300; ++i) {
+    strings.push_back(std::to_string((i * 7919) % 300));
+  }
+  std::vector<StringView> values(strings.begin(), strings.end());
+  auto expected = values;
+  std::sort(expected.begin(), expected.end(), std::greater<StringView>());
+
+  ValuesSorter<StringView> sorter;
+  sorter.sort(values.data(), values.size(), false);
+  ASSERT_EQ(values, expected);
+}
+
+} // namespace
+} // namespace facebook::velox::functions
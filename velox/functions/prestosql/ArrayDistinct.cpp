@@ -17,18 +17,18 @@
 #include "velox/expression/EvalCtx.h"
 #include "velox/expression/Expr.h"
 #include "velox/expression/VectorFunction.h"
+#include "velox/functions/lib/AdaptiveValueSet.h"
 #include "velox/functions/lib/RowsTranslationUtil.h"
-#include "velox/type/FloatingPointUtil.h"
 
 namespace facebook::velox::functions {
 namespace {
 
 template <typename T>
 struct ValueSet {
-  util::floating_point::HashSetNaNAware<T> values;
+  AdaptiveValueSet<T> values;
 
   bool insert(const T& value) {
-    return values.insert(value).second;
+    return values.insert(value);
   }
 
   void reset() {
@@ -21,8 +21,8 @@
 #include "velox/expression/VectorFunction.h"
 #include "velox/functions/lib/LambdaFunctionUtil.h"
 #include "velox/functions/lib/RowsTranslationUtil.h"
+#include "velox/functions/lib/ValuesSorter.h"
 #include "velox/functions/prestosql/SimpleComparisonMatcher.h"
-#include "velox/type/FloatingPointUtil.h"
 
 namespace facebook::velox::functions {
 namespace {
@@ -142,6 +142,7 @@ void applyScalarType(
       inputElements.get(), inputElementRows, /*toSourceRow=*/nullptr);
 
   auto flatResults = resultElements->asFlatVector<T>();
+  ValuesSorter<T> sorter;
 
   auto processRow = [&](vector_size_t row) {
     const auto size = inputArray->sizeAt(row);
@@ -173,29 +174,11 @@ void applyScalarType(
         bits::fillBits(rawBits, startRow, startRow + numOneBits, true);
         bits::fillBits(rawBits, endZeroRow, endRow, false);
       }
-    } else if constexpr (kind == TypeKind::REAL || kind == TypeKind::DOUBLE) {
-      T* resultRawValues = flatResults->mutableRawValues();
-      if (ascending) {
-        std::sort(
-            resultRawValues + startRow,
-            resultRawValues + endRow,
-            util::floating_point::NaNAwareLessThan<T>());
-      } else {
-        std::sort(
-            resultRawValues + startRow,
-            resultRawValues + endRow,
-            util::floating_point::NaNAwareGreaterThan<T>());
-      }
     } else {
-      T* resultRawValues = flatResults->mutableRawValues();
-      if (ascending) {
-        std::sort(resultRawValues + startRow, resultRawValues + endRow);
-      } else {
-        std::sort(
-            resultRawValues + startRow,
-            resultRawValues + endRow,
-            std::greater<T>());
-      }
+      sorter.sort(
+          flatResults->mutableRawValues() + startRow,
+          endRow - startRow,
+          ascending);
     }
   };
   rows.applyToSelected(processRow);
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/expression/DecodedArgs.h"
+#include "velox/expression/VectorFunction.h"
+#include "velox/vector/FlatMapVector.h"
+
+namespace facebook::velox::functions {
+namespace {
+
+/// cardinality(map(K, V)) -> bigint. Counts the keys of flat maps from the
+/// in-map bits without materializing the maps. Cardinality of arrays is a
+/// simple function.
+class MapCardinalityFunction : public exec::VectorFunction {
+ public:
+  void apply(
+      const SelectivityVector& rows,
+      std::vector<VectorPtr>& args,
+      const TypePtr& outputType,
+      exec::EvalCtx& context,
+      VectorPtr& result) const override {
+    context.ensureWritable(rows, outputType, result);
+    auto* rawResult =
+        result->asUnchecked<FlatVector<int64_t>>()->mutableRawValues();
+
+    const auto& arg = args[0];
+    if (arg->encoding() == VectorEncoding::Simple::FLAT_MAP) {
+      auto* flatMap = arg->asUnchecked<FlatMapVector>();
+      std::vector<vector_size_t> sizes(flatMap->size());
+      flatMap->mapSizes(sizes.data());
+      rows.applyToSelected([&](auto row) { rawResult[row] = sizes[row]; });
+      return;
+    }
+
+    exec::DecodedArgs decodedArgs(rows, args, context);
+    auto* decodedMap = decodedArgs.at(0);
+    auto* rawSizes = decodedMap->base()->asUnchecked<MapVector>()->rawSizes();
+    rows.applyToSelected([&](auto row) {
+      rawResult[row] = rawSizes[decodedMap->index(row)];
+    });
+  }
+
+  static std::vector<std::shared_ptr<exec::FunctionSignature>> signatures() {
+    // map(K,V) -> bigint
+    return {exec::FunctionSignatureBuilder()
+                .typeVariable("K")
+                .typeVariable("V")
+                .returnType("bigint")
+                .argumentType("map(K,V)")
+                .build()};
+  }
+};
+} // namespace
+
+VELOX_DECLARE_VECTOR_FUNCTION_WITH_METADATA(
+    udf_map_cardinality,
+    MapCardinalityFunction::signatures(),
+    exec::VectorFunctionMetadataBuilder().supportsFlatMapVectors(true).build(),
+    std::make_unique<MapCardinalityFunction>());
+
+} // namespace facebook::velox::functions
@@ -26,11 +26,5 @@ struct CardinalityFunction {
   void call(int64_t& out, const arg_type<Array<Generic<T1>>>& input) {
     out = input.size();
   }
-
-  void call(
-      int64_t& out,
-      const arg_type<Map<Generic<T1>, Generic<T2>>>& input) {
-    out = input.size();
-  }
 };
 } // namespace facebook::velox::functions
@@ -1670,6 +1670,9 @@ template <typename T>
 struct CurrentDateFunction {
   VELOX_DEFINE_FUNCTION_TYPES(T);
 
+  // Reads the clock, so the folded value must not be reused by other queries.
+  static constexpr bool is_foldable_across_queries = false;
+
   const date::time_zone* timeZone_ = nullptr;
 
   FOLLY_ALWAYS_INLINE void initialize(
@@ -50,12 +50,16 @@ struct DecimalPlusFunction {
 #endif
 #endif
   {
+    if (aRescale_ == 0 && bRescale_ == 0) {
+      // Same scales, the common case. No rescaling needed.
+      out = checkedPlus<R>(R(a), R(b));
+      DecimalUtil::valueInRange(out);
+      return;
+    }
     int128_t aRescaled;
     int128_t bRescaled;
-    if (__builtin_mul_overflow(
-            a, DecimalUtil::kPowersOfTen[aRescale_], &aRescaled) ||
-        __builtin_mul_overflow(
-            b, DecimalUtil::kPowersOfTen[bRescale_], &bRescaled)) {
+    if (!DecimalUtil::rescaleWithOverflowCheck(a, aRescale_, aRescaled) ||
+        !DecimalUtil::rescaleWithOverflowCheck(b, bRescale_, bRescaled)) {
       VELOX_ARITHMETIC_ERROR("Decimal overflow: {} + {}", a, b);
     }
     out = checkedPlus<R>(R(aRescaled), R(bRescaled));
@@ -99,12 +103,16 @@ struct DecimalMinusFunction {
 #endif
 #endif
   {
+    if (aRescale_ == 0 && bRescale_ == 0) {
+      // Same scales, the common case. No rescaling needed.
+      out = checkedMinus<R>(R(a), R(b));
+      DecimalUtil::valueInRange(out);
+      return;
+    }
     int128_t aRescaled;
     int128_t bRescaled;
-    if (__builtin_mul_overflow(
-            a, DecimalUtil::kPowersOfTen[aRescale_], &aRescaled) ||
-        __builtin_mul_overflow(
-            b, DecimalUtil::kPowersOfTen[bRescale_], &bRescaled)) {
+    if (!DecimalUtil::rescaleWithOverflowCheck(a, aRescale_, aRescaled) ||
+        !DecimalUtil::rescaleWithOverflowCheck(b, bRescale_, bRescaled)) {
       VELOX_ARITHMETIC_ERROR("Decimal overflow: {} - {}", a, b);
     }
     out = checkedMinus<R>(R(aRescaled), R(bRescaled));
@@ -128,7 +136,13 @@ struct DecimalMultiplyFunction {
 
   template <typename R, typename A, typename B>
   void call(R& out, const A& a, const B& b) {
-    out = checkedMultiply<R>(checkedMultiply<R>(R(a), R(b)), R(1));
+    if constexpr (std::is_same_v<R, int128_t>) {
+      if (!DecimalUtil::multiplyWithOverflowCheck(a, b, out)) {
+        VELOX_ARITHMETIC_ERROR("integer overflow: {} * {}", R(a), R(b));
+      }
+    } else {
+      out = checkedMultiply<R>(R(a), R(b));
+    }
     DecimalUtil::valueInRange(out);
   }
 };
@@ -57,7 +57,10 @@ void registerElementAtFunction(
           return std::make_shared<ElementAtFunction>(
               enableCaching && config.isExpressionEvaluationCacheEnabled());
         }
-      });
+      },
+      exec::VectorFunctionMetadataBuilder()
+          .supportsFlatMapVectors(true)
+          .build());
 }
 
 } // namespace facebook::velox::functions
@@ -15,6 +15,7 @@
  */
 
 #include "velox/expression/VectorFunction.h"
+#include "velox/vector/FlatMapVector.h"
 
 namespace facebook::velox::functions {
 namespace {
@@ -31,7 +32,7 @@ class MapKeyValueFunction : public exec::VectorFunction {
 
     VectorPtr localResult;
 
-    // Input can be constant or flat.
+    // Input can be constant, flat or, for map_keys, flat map.
     if (arg->isConstantEncoding()) {
       auto* constantMap = arg->as<ConstantVector<ComplexType>>();
       const auto& flatMap = constantMap->valueVector();
@@ -73,6 +74,12 @@ class MapKeysFunction : public MapKeyValueFunction {
         "Unsupported type for map_keys function {}",
         mapTypeKindToName(arg->typeKind()));
 
+    if (arg->encoding() == VectorEncoding::Simple::FLAT_MAP) {
+      // Keys of a flat map are assembled from the in-map bits without
+      // materializing the values.
+      return arg->asUnchecked<FlatMapVector>()->mapKeysAsArray();
+    }
+
     auto mapVector = arg->as<MapVector>();
     auto mapKeys = mapVector->mapKeys();
     return std::make_shared<ArrayVector>(
@@ -110,7 +117,7 @@ class MapValuesFunction : public MapKeyValueFunction {
         "Unsupported type for map_values function {}",
         mapTypeKindToName(arg->typeKind()));
 
-    auto mapVector = arg->as<MapVector>();
+    auto mapVector = arg->wrappedVector()->as<MapVector>();
     auto mapValues = mapVector->mapValues();
     return std::make_shared<ArrayVector>(
         context.pool(),
@@ -135,9 +142,10 @@ class MapValuesFunction : public MapKeyValueFunction {
 };
 } // namespace
 
-VELOX_DECLARE_VECTOR_FUNCTION(
+VELOX_DECLARE_VECTOR_FUNCTION_WITH_METADATA(
     udf_map_keys,
     MapKeysFunction::signatures(),
+    exec::VectorFunctionMetadataBuilder().supportsFlatMapVectors(true).build(),
     std::make_unique<MapKeysFunction>());
 
 VELOX_DECLARE_VECTOR_FUNCTION(
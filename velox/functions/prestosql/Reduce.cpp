@@ -51,7 +51,9 @@ void checkArraySizes(
 /// Populates indices of the n-th elements of the arrays.
 /// Selects 'row' in 'arrayRows' if corresponding array has an n-th element.
 /// Sets elementIndices[row] to the index of the n-th element in the 'elements'
-/// vector.
+/// vector. Only visits 'rows', i.e. the arrays that had an (n-1)-th element.
+/// Indices of other rows are left as is: they are still valid indices into
+/// 'elements'.
 /// Returns true if at least one array has n-th element.
 bool toNthElementRows(
     const ArrayVectorPtr& arrayVector,
@@ -66,7 +68,6 @@ bool toNthElementRows(
   auto* rawElementIndices = elementIndices->asMutable<vector_size_t>();
 
   arrayRows.clearAll();
-  memset(rawElementIndices, 0, elementIndices->size());
 
   rows.applyToSelected([&](auto row) {
     if (!rawNulls || !bits::isBitNull(rawNulls, row)) {
@@ -159,6 +160,15 @@ class ReduceFunction : public exec::VectorFunction {
     BufferPtr elementIndices =
         allocateIndices(flatArray->size(), context.pool());
     SelectivityVector arrayRows(flatArray->size(), false);
+    SelectivityVector previousRows(flatArray->size(), false);
+    SelectivityVector firstRows(flatArray->size(), false);
+    SelectivityVector finishedRows(flatArray->size(), false);
+
+    // The state of step n is written to one of 'partialResult' and
+    // 'otherResult' while the state of step n-1 is read from the other. This
+    // keeps the result of the lambda unshared, so it is written in place
+    // instead of being copied with all its rows at every step.
+    VectorPtr otherResult;
 
     // Iteratively apply input function to array elements.
     // First, apply input function to first elements of all arrays.
@@ -168,6 +178,8 @@ class ReduceFunction : public exec::VectorFunction {
     // some arrays will run out of elements.
     while (auto entry = inputFuncIt.next()) {
       VectorPtr state = initialState;
+      VectorPtr* stepResult = &partialResult;
+      previousRows = *entry.rows;
 
       vector_size_t n = 0;
       while (true) {
@@ -182,9 +194,29 @@ class ReduceFunction : public exec::VectorFunction {
         // Set elementIndices[row] to the index of the n-th element in the
         // array's elements vector.
         if (!toNthElementRows(
-                flatArray, *entry.rows, n, arrayRows, elementIndices)) {
+                flatArray, previousRows, n, arrayRows, elementIndices)) {
           break; // Ran out of elements in all arrays.
         }
+        if (n == 0) {
+          firstRows = arrayRows;
+        } else {
+          // Arrays that ran out of elements at this step have their final
+          // state in 'state'. Copy it so that both buffers have it.
+          finishedRows = previousRows;
+          finishedRows.deselect(arrayRows);
+          if (!*stepResult) {
+            *stepResult = BaseVector::create(
+                initialState->type(), rows.end(), context.pool());
+          }
+          if (finishedRows.hasSelections()) {
+            BaseVector::ensureWritable(
+                finishedRows,
+                initialState->type(),
+                context.pool(),
+                *stepResult);
+            (*stepResult)->copy(state.get(), finishedRows, nullptr);
+          }
+        }
 
         // Create dictionary row -> element in array's elements vector.
         auto dictNthElements = BaseVector::wrapInDictionary(
@@ -203,10 +235,20 @@ class ReduceFunction : public exec::VectorFunction {
             &context,
             lambdaArgs,
             nullptr,
-            &partialResult);
-        state = partialResult;
+            stepResult);
+        state = *stepResult;
+        stepResult =
+            stepResult == &partialResult ? &otherResult : &partialResult;
+        std::swap(previousRows, arrayRows);
         n++;
       }
+
+      // The final states of all non-empty arrays are in 'state'.
+      if (n > 0 && state != partialResult) {
+        BaseVector::ensureWritable(
+            firstRows, initialState->type(), context.pool(), partialResult);
+        partialResult->copy(state.get(), firstRows, nullptr);
+      }
     }
 
     // Apply output function.
@@ -345,6 +387,94 @@ core::TypedExprPtr toArraySum(
   return plus;
 }
 
+// Returns f(x) if 'expr' is 'greatest(s, f(x))' or 'greatest(f(x), s)' for
+// 'name' of greatest or least. Returns nullptr otherwise.
+core::TypedExprPtr extractFromMinMax(
+    const std::string& name,
+    const core::CallTypedExpr& expr,
+    const std::string& s) {
+  if (expr.name() != name || expr.inputs().size() != 2) {
+    return nullptr;
+  }
+  if (isVariableReference(expr.inputs()[0], s)) {
+    return expr.inputs()[1];
+  }
+  if (isVariableReference(expr.inputs()[1], s)) {
+    return expr.inputs()[0];
+  }
+  return nullptr;
+}
+
+core::TypedExprPtr toArrayMinMax(
+    const std::string& prefix,
+    const core::CallTypedExpr& reduce,
+    const RowTypePtr& inputArgs,
+    const core::TypedExprPtr& expr,
+    bool isMax) {
+  if (containsVariableReference(expr, inputArgs->nameOf(0))) {
+    return nullptr;
+  }
+  auto& array = reduce.inputs()[0];
+  auto& initial = reduce.inputs()[1];
+  // The array and the initial state are referenced twice in the rewritten
+  // expression, so these must be columns or constants.
+  if (!dynamic_cast<const core::FieldAccessTypedExpr*>(array.get()) ||
+      !(dynamic_cast<const core::FieldAccessTypedExpr*>(initial.get()) ||
+        dynamic_cast<const core::ConstantTypedExpr*>(initial.get()))) {
+    return nullptr;
+  }
+  switch (initial->type()->kind()) {
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+    case TypeKind::REAL:
+    case TypeKind::DOUBLE:
+      break;
+    default:
+      return nullptr;
+  }
+  if (!expr->type()->equivalent(*initial->type())) {
+    return nullptr;
+  }
+  // Like greatest and least, array_max and array_min return null if any
+  // element is null and order NaN above all other values. Unlike reduce they
+  // return null for empty arrays, which is why these are special cased.
+  auto lambda = std::make_shared<core::LambdaTypedExpr>(
+      ROW({inputArgs->nameOf(1)}, {inputArgs->childAt(1)}), expr);
+  auto transform = std::make_shared<core::CallTypedExpr>(
+      ARRAY(expr->type()),
+      std::vector<core::TypedExprPtr>({array, lambda}),
+      prefix + "transform");
+  auto arrayMinMax = std::make_shared<core::CallTypedExpr>(
+      initial->type(),
+      std::vector<core::TypedExprPtr>({transform}),
+      prefix + (isMax ? "array_max" : "array_min"));
+  auto minMax = std::make_shared<core::CallTypedExpr>(
+      initial->type(),
+      std::vector<core::TypedExprPtr>({initial, arrayMinMax}),
+      prefix + (isMax ? "greatest" : "least"));
+  auto cardinality = std::make_shared<core::CallTypedExpr>(
+      BIGINT(),
+      std::vector<core::TypedExprPtr>({array}),
+      prefix + "cardinality");
+  auto isEmpty = std::make_shared<core::CallTypedExpr>(
+      BOOLEAN(),
+      std::vector<core::TypedExprPtr>(
+          {cardinality,
+           std::make_shared<core::ConstantTypedExpr>(
+               BIGINT(), variant::create<int64_t>(0))}),
+      prefix + "eq");
+  auto ifExpr = std::make_shared<core::CallTypedExpr>(
+      initial->type(),
+      std::vector<core::TypedExprPtr>({isEmpty, initial, minMax}),
+      "if");
+  VLOG(1) << "Rewrite expression: " << reduce.toString() << " => "
+          << ifExpr->toString();
+  addThreadLocalRuntimeStat("numReduceRewrite", RuntimeCounter(1));
+  return ifExpr;
+}
+
 core::TypedExprPtr rewriteReduce(
     const std::string& prefix,
     const core::TypedExprPtr& expr) {
@@ -415,6 +545,16 @@ core::TypedExprPtr rewriteReduce(
         "if");
     return toArraySum(prefix, *reduce, inputArgs, ifExpr);
   }
+  if (auto fx = extractFromMinMax(prefix + "greatest", *inputBody, s)) {
+    // greatest(s, f(x)) =>
+    // if(cardinality(array) = 0, s0, greatest(s0, array_max(transform(...))))
+    return toArrayMinMax(prefix, *reduce, inputArgs, fx, true);
+  }
+  if (auto fx = extractFromMinMax(prefix + "least", *inputBody, s)) {
+    // least(s, f(x)) =>
+    // if(cardinality(array) = 0, s0, least(s0, array_min(transform(...))))
+    return toArrayMinMax(prefix, *reduce, inputArgs, fx, false);
+  }
   return nullptr;
 }
 
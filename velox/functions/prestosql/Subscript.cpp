@@ -58,7 +58,10 @@ void registerSubscriptFunction(
           return std::make_shared<SubscriptFunction>(
               enableCaching && config.isExpressionEvaluationCacheEnabled());
         }
-      });
+      },
+      exec::VectorFunctionMetadataBuilder()
+          .supportsFlatMapVectors(true)
+          .build());
 }
 
 } // namespace facebook::velox::functions
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+#include "velox/benchmarks/ExpressionBenchmarkBuilder.h"
+#include "velox/functions/Macros.h"
+#include "velox/functions/Registerer.h"
+#include "velox/functions/prestosql/registration/RegistrationFunctions.h"
+#include "velox/type/FloatingPointUtil.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+
+namespace {
+
+// array_distinct with a hash set for every row, regardless of the array size.
+template <typename TExec>
+struct ArrayDistinctHashSetFunction {
+  VELOX_DEFINE_FUNCTION_TYPES(TExec);
+
+  void call(
+      out_type<Array<int64_t>>& out,
+      const arg_type<Array<int64_t>>& array) {
+    values_.clear();
+    bool hasNull = false;
+    for (const auto& item : array) {
+      if (!item.has_value()) {
+        if (!hasNull) {
+          hasNull = true;
+          out.add_null();
+        }
+      } else if (values_.insert(*item).second) {
+        out.push_back(*item);
+      }
+    }
+  }
+
+ private:
+  util::floating_point::HashSetNaNAware<int64_t> values_;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+  folly::Init init{&argc, &argv};
+  memory::MemoryManager::initialize({});
+  functions::prestosql::registerArrayFunctions();
+
+  registerFunction<
+      ArrayDistinctHashSetFunction,
+      Array<int64_t>,
+      Array<int64_t>>({"array_distinct_hash_set"});
+
+  ExpressionBenchmarkBuilder benchmarkBuilder;
+  auto inputType = ROW({"c0", "c1"}, {ARRAY(BIGINT()), ARRAY(BIGINT())});
+
+  // Arrays of up to 8, 32 and 256 elements. The smaller sizes use the linear
+  // SIMD search, the largest one the hash set.
+  for (size_t maxSize : {8, 32, 256}) {
+    const VectorFuzzer::Options options{
+        .vectorSize = 1000, .nullRatio = 0.01, .containerLength = maxSize};
+
+    benchmarkBuilder
+        .addBenchmarkSet(fmt::format("array_distinct_{}", maxSize), inputType)
+        .withFuzzerOptions(options)
+        .addExpression("adaptive", "array_distinct(c0)")
+        .addExpression("hash_set", "array_distinct_hash_set(c0)");
+
+    benchmarkBuilder
+        .addBenchmarkSet(fmt::format("array_set_ops_{}", maxSize), inputType)
+        .withFuzzerOptions(options)
+        .addExpression("intersect", "array_intersect(c0, c1)")
+        .addExpression("except", "array_except(c0, c1)")
+        .addExpression("overlap", "arrays_overlap(c0, c1)")
+        .disableTesting();
+  }
+
+  benchmarkBuilder.registerBenchmarks();
+  // Make sure all expressions within benchmarkSets have the same results.
+  benchmarkBuilder.testBenchmarks();
+  folly::runBenchmarks();
+  return 0;
+}
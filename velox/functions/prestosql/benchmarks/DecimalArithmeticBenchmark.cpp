@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+
+#include "velox/benchmarks/ExpressionBenchmarkBuilder.h"
+#include "velox/functions/prestosql/registration/RegistrationFunctions.h"
+
+using namespace facebook;
+using namespace facebook::velox;
+
+int main(int argc, char** argv) {
+  folly::Init init(&argc, &argv);
+  memory::MemoryManager::initialize({});
+
+  functions::prestosql::registerAllScalarFunctions();
+
+  ExpressionBenchmarkBuilder benchmarkBuilder;
+  const vector_size_t vectorSize = 1'000;
+  auto vectorMaker = benchmarkBuilder.vectorMaker();
+
+  // Money amounts. Long decimals whose values fit in 64 bits are the common
+  // case.
+  auto shortDecimal = vectorMaker.flatVector<int64_t>(
+      vectorSize,
+      [](auto row) { return 1'000 + row * 37; },
+      nullptr,
+      DECIMAL(12, 2));
+  auto longDecimal = vectorMaker.flatVector<int128_t>(
+      vectorSize,
+      [](auto row) { return 100'000 + row * 1'234; },
+      nullptr,
+      DECIMAL(38, 2));
+  auto otherLongDecimal = vectorMaker.flatVector<int128_t>(
+      vectorSize,
+      [](auto row) { return 1 + row % 100; },
+      nullptr,
+      DECIMAL(38, 2));
+  auto longDecimalScale4 = vectorMaker.flatVector<int128_t>(
+      vectorSize,
+      [](auto row) { return 5'000 + row; },
+      nullptr,
+      DECIMAL(38, 4));
+  // Values that need 128-bit arithmetic.
+  auto largeLongDecimal = vectorMaker.flatVector<int128_t>(
+      vectorSize,
+      [](auto row) {
+        return HugeInt::build(row % 1'000, 0xFFFFFFFFFFFFFFFF - row);
+      },
+      nullptr,
+      DECIMAL(38, 2));
+
+  benchmarkBuilder
+      .addBenchmarkSet(
+          "decimal_arithmetic",
+          vectorMaker.rowVector(
+              {"short", "long", "other_long", "long_scale_4", "large_long"},
+              {shortDecimal,
+               longDecimal,
+               otherLongDecimal,
+               longDecimalScale4,
+               largeLongDecimal}))
+      .addExpression("plus_short", "short + short")
+      .addExpression("plus_long_same_scale", "long + other_long")
+      .addExpression("plus_long_rescale", "long + long_scale_4")
+      .addExpression("plus_large_long", "large_long + long")
+      .addExpression("minus_long_rescale", "long - long_scale_4")
+      .addExpression("multiply_short_to_long", "short * short")
+      .addExpression("multiply_long", "long * other_long")
+      .addExpression("multiply_large_long", "large_long * other_long")
+      .addExpression("divide_long", "long / other_long")
+      .addExpression("divide_long_rescale", "long / long_scale_4")
+      .addExpression("divide_large_long", "large_long / other_long")
+      .withIterations(100)
+      .disableTesting();
+
+  benchmarkBuilder.registerBenchmarks();
+  folly::runBenchmarks();
+  return 0;
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+#include "velox/benchmarks/ExpressionBenchmarkBuilder.h"
+#include "velox/functions/prestosql/registration/RegistrationFunctions.h"
+
+using namespace facebook::velox;
+
+int main(int argc, char** argv) {
+  folly::Init init{&argc, &argv};
+  memory::MemoryManager::initialize({});
+  functions::prestosql::registerAllScalarFunctions();
+
+  ExpressionBenchmarkBuilder benchmarkBuilder;
+  auto inputType = ROW({"c0"}, {ARRAY(INTEGER())});
+
+  // Arrays of up to 10, 1'000 and 5'000 elements. 'step' evaluates the lambda
+  // once per element position. 's -> 1 * s' keeps reduce from being rewritten.
+  // 'rewrite' lambdas are evaluated as array_sum or array_max over transform.
+  for (size_t maxSize : {10, 1'000, 5'000}) {
+    const VectorFuzzer::Options options{
+        .vectorSize = 100, .nullRatio = 0.01, .containerLength = maxSize};
+
+    benchmarkBuilder
+        .addBenchmarkSet(fmt::format("reduce_sum_{}", maxSize), inputType)
+        .withFuzzerOptions(options)
+        .addExpression(
+            "step",
+            "reduce(c0, 0, (s, x) -> s + cast(x as bigint), s -> 1 * s)")
+        .addExpression(
+            "rewrite",
+            "reduce(c0, 0, (s, x) -> s + cast(x as bigint), s -> s)");
+
+    benchmarkBuilder
+        .addBenchmarkSet(fmt::format("reduce_max_{}", maxSize), inputType)
+        .withFuzzerOptions(options)
+        .addExpression(
+            "step",
+            "reduce(c0, 0, (s, x) -> greatest(s, cast(x as bigint)), s -> 1 * s)")
+        .addExpression(
+            "rewrite",
+            "reduce(c0, 0, (s, x) -> greatest(s, cast(x as bigint)), s -> s)");
+
+    benchmarkBuilder
+        .addBenchmarkSet(fmt::format("reduce_hash_{}", maxSize), inputType)
+        .withFuzzerOptions(options)
+        .addExpression(
+            "step",
+            "reduce(c0, 0, (s, x) -> (s * 31 + cast(x as bigint)) % 1000003, s -> s)")
+        .disableTesting();
+  }
+
+  benchmarkBuilder.registerBenchmarks();
+  // Make sure all expressions within benchmarkSets have the same results.
+  benchmarkBuilder.testBenchmarks();
+  folly::runBenchmarks();
+  return 0;
+}
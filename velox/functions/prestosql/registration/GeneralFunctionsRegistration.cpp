@@ -104,8 +104,7 @@ void registerGeneralFunctions(const std::string& prefix) {
 
   registerFunction<CardinalityFunction, int64_t, Array<Generic<T1>>>(
       {prefix + "cardinality"});
-  registerFunction<CardinalityFunction, int64_t, Map<Generic<T1>, Generic<T2>>>(
-      {prefix + "cardinality"});
+  VELOX_REGISTER_VECTOR_FUNCTION(udf_map_cardinality, prefix + "cardinality");
 
   registerFailFunction({prefix + "fail"});
 
@@ -73,3 +73,24 @@ TEST_F(CardinalityTest, map) {
   testMapCardinality(sizeAt, nullptr);
   testMapCardinality(sizeAt, nullEvery(5));
 }
+
+TEST_F(CardinalityTest, flatMap) {
+  // {1: 10, 2: 20}, {1: 11, 3: 31}, {1: 12, 2: 22}, null.
+  auto flatMap = makeFlatMapVector(
+      makeFlatVector<int64_t>({1, 2, 3}),
+      {makeFlatVector<int64_t>({10, 11, 12, 13}),
+       makeFlatVector<int64_t>({20, 21, 22, 23}),
+       makeFlatVector<int64_t>({30, 31, 32, 33})},
+      {std::nullopt,
+       std::vector<bool>{true, false, true, false},
+       std::vector<bool>{false, true, false, false}},
+      {false, false, false, true});
+  auto result = evaluate("cardinality(c0)", makeRowVector({flatMap}));
+  test::assertEqualVectors(
+      makeNullableFlatVector<int64_t>({2, 2, 2, std::nullopt}), result);
+
+  // Arrays still use the simple function.
+  result = evaluate(
+      "cardinality(c0)", makeRowVector({makeArrayVector<int64_t>({{1, 2}})}));
+  test::assertEqualVectors(makeFlatVector<int64_t>({2}), result);
+}
@@ -1030,6 +1030,44 @@ TEST_F(ElementAtTest, errorStatesArray) {
       [](auto row) { return row == 40; });
 }
 
+TEST_F(ElementAtTest, repeatedLookupsIntoNonConstantMaps) {
+  // Maps with 50 keys, large enough to be indexed on repeated lookups. Key k
+  // of map r maps to k * 10 + r.
+  constexpr int32_t kNumKeys = 50;
+  auto maps = makeMapVector<int64_t, int64_t>(
+      3,
+      [&](auto /*row*/) { return kNumKeys; },
+      [&](auto index) { return index % kNumKeys; },
+      [&](auto index) { return index % kNumKeys * 10 + index / kNumKeys; });
+  // Repeat the maps so that some are looked up from several rows.
+  auto data = makeRowVector({
+      wrapInDictionary(makeIndices({0, 0, 1, 2, 2, 1, 0}), maps),
+      makeFlatVector<int64_t>({1, 49, 2, 3, 49, 100, 0}),
+  });
+
+  auto result = evaluate(
+      "element_at(c0, 1) + element_at(c0, 2) + element_at(c0, 49)", data);
+  test::assertEqualVectors(
+      makeFlatVector<int64_t>({520, 520, 523, 526, 526, 523, 520}), result);
+
+  result = evaluate("element_at(c0, c1) + element_at(c0, c1 + 1)", data);
+  test::assertEqualVectors(
+      makeNullableFlatVector<int64_t>(
+          {30, std::nullopt, 52, 74, std::nullopt, std::nullopt, 10}),
+      result);
+
+  // Same map vector in several projections.
+  result = evaluate(
+      "row_constructor(element_at(c0, 10), element_at(c0, 20), c0[30])", data);
+  test::assertEqualVectors(
+      makeRowVector({
+          makeFlatVector<int64_t>({100, 100, 101, 102, 102, 101, 100}),
+          makeFlatVector<int64_t>({200, 200, 201, 202, 202, 201, 200}),
+          makeFlatVector<int64_t>({300, 300, 301, 302, 302, 301, 300}),
+      }),
+      result);
+}
+
 TEST_F(ElementAtTest, testCachingOptimzation) {
   std::vector<std::vector<std::pair<int64_t, std::optional<int64_t>>>>
       inputMapVectorData;
@@ -1182,3 +1220,34 @@ TEST_F(ElementAtTest, floatingPointCornerCases) {
   testFloatingPointCornerCases<float>();
   testFloatingPointCornerCases<double>();
 }
+
+TEST_F(ElementAtTest, flatMap) {
+  // {1: 10, 2: 20}, {1: 11, 3: 31}, {1: 12, 2: 22}, null.
+  auto flatMap = makeFlatMapVector(
+      makeFlatVector<int64_t>({1, 2, 3}),
+      {makeFlatVector<int64_t>({10, 11, 12, 13}),
+       makeFlatVector<int64_t>({20, 21, 22, 23}),
+       makeFlatVector<int64_t>({30, 31, 32, 33})},
+      {std::nullopt,
+       std::vector<bool>{true, false, true, false},
+       std::vector<bool>{false, true, false, false}},
+      {false, false, false, true});
+  auto data = makeRowVector({flatMap, makeFlatVector<int64_t>({2, 3, 1, 1})});
+
+  auto result = evaluate("element_at(c0, 1)", data);
+  test::assertEqualVectors(
+      makeNullableFlatVector<int64_t>({10, 11, 12, std::nullopt}), result);
+
+  result = evaluate("element_at(c0, 2)", data);
+  test::assertEqualVectors(
+      makeNullableFlatVector<int64_t>({20, std::nullopt, 22, std::nullopt}),
+      result);
+
+  result = evaluate("element_at(c0, 4)", data);
+  test::assertEqualVectors(makeNullConstant(TypeKind::BIGINT, 4), result);
+
+  // Non-constant keys read the materialized maps.
+  result = evaluate("element_at(c0, c1)", data);
+  test::assertEqualVectors(
+      makeNullableFlatVector<int64_t>({20, 31, 12, std::nullopt}), result);
+}
@@ -194,3 +194,44 @@ TEST_F(MapEntriesTest, differentSizedValueKeyVectors) {
 
   test::assertEqualVectors(arrayVector, result);
 }
+
+TEST_F(MapEntriesTest, flatMap) {
+  // {1: 10, 2: 20}, {1: 11, 3: 31}, {1: 12, 2: 22}, null.
+  auto flatMap = makeFlatMapVector(
+      makeFlatVector<int64_t>({1, 2, 3}),
+      {makeFlatVector<int64_t>({10, 11, 12, 13}),
+       makeFlatVector<int64_t>({20, 21, 22, 23}),
+       makeFlatVector<int64_t>({30, 31, 32, 33})},
+      {std::nullopt,
+       std::vector<bool>{true, false, true, false},
+       std::vector<bool>{false, true, false, false}},
+      {false, false, false, true});
+  auto map = makeNullableMapVector<int64_t, int64_t>({
+      {{{1, 10}, {2, 20}}},
+      {{{1, 11}, {3, 31}}},
+      {{{1, 12}, {2, 22}}},
+      std::nullopt,
+  });
+
+  // map_entries has no flat map fast path and sees the materialized maps.
+  auto expected = evaluate("map_entries(c0)", makeRowVector({map}));
+  auto result = evaluate("map_entries(c0)", makeRowVector({flatMap}));
+  test::assertEqualVectors(expected, result);
+
+  // Flat maps under a dictionary are peeled to the flat map.
+  auto indices = makeIndicesInReverse(4);
+  expected = evaluate(
+      "map_entries(c0)", makeRowVector({wrapInDictionary(indices, map)}));
+  result = evaluate(
+      "map_entries(c0)", makeRowVector({wrapInDictionary(indices, flatMap)}));
+  test::assertEqualVectors(expected, result);
+
+  // Casts peel their input the same way.
+  expected = evaluate(
+      "map_entries(cast(c0 as map(bigint, double)))",
+      makeRowVector({wrapInDictionary(indices, map)}));
+  result = evaluate(
+      "map_entries(cast(c0 as map(bigint, double)))",
+      makeRowVector({wrapInDictionary(indices, flatMap)}));
+  test::assertEqualVectors(expected, result);
+}
@@ -258,6 +258,31 @@ TEST_F(MapKeysTest, unknown) {
   test::assertEqualVectors(expected, result);
 }
 
+TEST_F(MapKeysTest, flatMap) {
+  // {1: 10, 2: 20}, {1: 11, 3: 31}, {1: 12, 2: 22}, null.
+  auto flatMap = makeFlatMapVector(
+      makeFlatVector<int64_t>({1, 2, 3}),
+      {makeFlatVector<int64_t>({10, 11, 12, 13}),
+       makeFlatVector<int64_t>({20, 21, 22, 23}),
+       makeFlatVector<int64_t>({30, 31, 32, 33})},
+      {std::nullopt,
+       std::vector<bool>{true, false, true, false},
+       std::vector<bool>{false, true, false, false}},
+      {false, false, false, true});
+  auto data = makeRowVector({flatMap});
+
+  auto result = evaluate("map_keys(c0)", data);
+  test::assertEqualVectors(
+      makeNullableArrayVector<int64_t>({{{1, 2}}, {{1, 3}}, {{1, 2}}, {}}),
+      result);
+
+  result = evaluate("map_values(c0)", data);
+  test::assertEqualVectors(
+      makeNullableArrayVector<int64_t>(
+          {{{10, 20}}, {{11, 31}}, {{12, 22}}, {}}),
+      result);
+}
+
 TEST_F(MapValuesTest, noNulls) {
   auto sizeAt = [](vector_size_t row) { return row % 7; };
   testMapValues(sizeAt, nullptr);
@@ -130,6 +130,33 @@ TEST_F(ReduceTest, conditional) {
   assertEqualVectors(expectedResult, result);
 }
 
+// Arrays of very different sizes, so that arrays run out of elements at many
+// steps. The state alternates between two vectors from step to step.
+TEST_F(ReduceTest, longArrays) {
+  vector_size_t size = 100;
+  auto inputArray = makeArrayVector<int64_t>(
+      size,
+      [](auto row) { return (row * 97) % 3'000; },
+      [](auto row, auto index) { return row + index; },
+      nullEvery(13));
+  auto input = makeRowVector({inputArray});
+
+  auto result = evaluate<SimpleVector<int64_t>>(
+      "reduce(c0, 1, (s, x) -> (s * 31 + x) % 1000003, s -> s)", input);
+
+  auto expectedResult = makeFlatVector<int64_t>(
+      size,
+      [](auto row) {
+        int64_t state = 1;
+        for (auto i = 0; i < (row * 97) % 3'000; i++) {
+          state = (state * 31 + row + i) % 1000003;
+        }
+        return state;
+      },
+      nullEvery(13));
+  assertEqualVectors(expectedResult, result);
+}
+
 TEST_F(ReduceTest, finalSelection) {
   vector_size_t size = 1'000;
   auto inputArray = makeArrayVector<int64_t>(
@@ -322,6 +349,14 @@ TEST_F(ReduceTest, rewrites) {
     SCOPED_TRACE("if");
     testReduceRewrite(input, "if(x % 2 = 0, s + 1, s)");
   }
+  {
+    SCOPED_TRACE("greatest");
+    testReduceRewrite(input, "greatest(s, x * 2)");
+  }
+  {
+    SCOPED_TRACE("least");
+    testReduceRewrite(input, "least(x, s)");
+  }
 }
 
 } // namespace
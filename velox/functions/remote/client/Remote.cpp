@@ -16,7 +16,9 @@
 
 #include "velox/functions/remote/client/Remote.h"
 
+#include <folly/futures/Future.h>
 #include <folly/io/async/EventBase.h>
+#include <deque>
 #include "velox/expression/Expr.h"
 #include "velox/expression/VectorFunction.h"
 #include "velox/functions/remote/client/ThriftClient.h"
@@ -43,7 +45,10 @@ class RemoteFunction : public exec::VectorFunction {
         location_(metadata.location),
         thriftClient_(getThriftClient(location_, &eventBase_)),
         serdeFormat_(metadata.serdeFormat),
-        serde_(getSerde(serdeFormat_)) {
+        serde_(getSerde(serdeFormat_)),
+        maxRowsPerRequest_(metadata.maxRowsPerRequest),
+        maxRequestsInFlight_(
+            std::max<uint32_t>(1, metadata.maxRequestsInFlight)) {
     std::vector<TypePtr> types;
     types.reserve(inputArgs.size());
     serializedInputTypes_.reserve(inputArgs.size());
@@ -85,8 +90,73 @@ class RemoteFunction : public exec::VectorFunction {
         rows.end(),
         std::move(args));
 
-    // Send to remote server.
-    remote::RemoteFunctionResponse remoteResponse;
+    const vector_size_t numRows = rows.end();
+    const vector_size_t rowsPerRequest =
+        maxRowsPerRequest_ > 0 ? maxRowsPerRequest_ : numRows;
+    if (numRows <= rowsPerRequest) {
+      auto response =
+          waitForResponse(invokeFunction(remoteRowVector, outputType, context));
+      result = readResult(response, outputType, context);
+      return;
+    }
+
+    // Splits the batch in ranges of 'rowsPerRequest' rows and keeps up to
+    // 'maxRequestsInFlight_' of them in flight. Ranges without selected rows
+    // are not sent.
+    BaseVector::ensureWritable(rows, outputType, context.pool(), result);
+    std::deque<std::pair<
+        vector_size_t,
+        folly::SemiFuture<remote::RemoteFunctionResponse>>>
+        inFlight;
+    const auto processOldest = [&]() {
+      auto [offset, future] = std::move(inFlight.front());
+      inFlight.pop_front();
+      auto response = waitForResponse(std::move(future));
+      auto output = readResult(response, outputType, context);
+      // Copies only the selected rows. The other rows of 'result' may have
+      // values set by the evaluation of other expressions.
+      std::vector<BaseVector::CopyRange> ranges;
+      bits::forEachSetBit(
+          rows.allBits(),
+          offset,
+          offset + output->size(),
+          [&](vector_size_t row) {
+            if (!ranges.empty() &&
+                ranges.back().targetIndex + ranges.back().count == row) {
+              ++ranges.back().count;
+            } else {
+              ranges.push_back({row - offset, row, 1});
+            }
+          });
+      result->copyRanges(output.get(), ranges);
+    };
+    for (vector_size_t offset = 0; offset < numRows; offset += rowsPerRequest) {
+      const auto size = std::min(rowsPerRequest, numRows - offset);
+      if (bits::countBits(rows.allBits(), offset, offset + size) == 0) {
+        continue;
+      }
+      if (inFlight.size() == maxRequestsInFlight_) {
+        processOldest();
+      }
+      inFlight.emplace_back(
+          offset,
+          invokeFunction(
+              std::static_pointer_cast<RowVector>(
+                  remoteRowVector->slice(offset, size)),
+              outputType,
+              context));
+    }
+    while (!inFlight.empty()) {
+      processOldest();
+    }
+  }
+
+  // Sends the rows of 'input' to the remote server. The returned future
+  // completes when the event base is driven by waitForResponse().
+  folly::SemiFuture<remote::RemoteFunctionResponse> invokeFunction(
+      const RowVectorPtr& input,
+      const TypePtr& outputType,
+      exec::EvalCtx& context) const {
     remote::RemoteFunctionRequest request;
     request.throwOnError_ref() = context.throwOnError();
 
@@ -96,15 +166,22 @@ class RemoteFunction : public exec::VectorFunction {
     functionHandle->argumentTypes_ref() = serializedInputTypes_;
 
     auto requestInputs = request.inputs_ref();
-    requestInputs->rowCount_ref() = remoteRowVector->size();
+    requestInputs->rowCount_ref() = input->size();
     requestInputs->pageFormat_ref() = serdeFormat_;
 
     // TODO: serialize only active rows.
-    requestInputs->payload_ref() = rowVectorToIOBuf(
-        remoteRowVector, rows.end(), *context.pool(), serde_.get());
+    requestInputs->payload_ref() =
+        rowVectorToIOBuf(input, input->size(), *context.pool(), serde_.get());
+
+    return thriftClient_->semifuture_invokeFunction(request);
+  }
 
+  // Runs 'eventBase_' until 'future' completes. All the requests in flight
+  // make progress meanwhile.
+  remote::RemoteFunctionResponse waitForResponse(
+      folly::SemiFuture<remote::RemoteFunctionResponse> future) const {
     try {
-      thriftClient_->sync_invokeFunction(remoteResponse, request);
+      return std::move(future).via(&eventBase_).getVia(&eventBase_);
     } catch (const std::exception& e) {
       VELOX_FAIL(
           "Error while executing remote function '{}' at '{}': {}",
@@ -112,22 +189,29 @@ class RemoteFunction : public exec::VectorFunction {
           location_.describe(),
           e.what());
     }
+  }
 
+  VectorPtr readResult(
+      const remote::RemoteFunctionResponse& response,
+      const TypePtr& outputType,
+      exec::EvalCtx& context) const {
     auto outputRowVector = IOBufToRowVector(
-        remoteResponse.get_result().get_payload(),
+        response.get_result().get_payload(),
         ROW({outputType}),
         *context.pool(),
         serde_.get());
-    result = outputRowVector->childAt(0);
+    return outputRowVector->childAt(0);
   }
 
   const std::string functionName_;
   folly::SocketAddress location_;
 
-  folly::EventBase eventBase_;
+  mutable folly::EventBase eventBase_;
   std::unique_ptr<RemoteFunctionClient> thriftClient_;
   remote::PageFormat serdeFormat_;
   std::unique_ptr<VectorSerde> serde_;
+  const vector_size_t maxRowsPerRequest_;
+  const uint32_t maxRequestsInFlight_;
 
   // Structures we construct once to cache:
   RowTypePtr remoteInputType_;
@@ -30,6 +30,15 @@ struct RemoteVectorFunctionMetadata : public exec::VectorFunctionMetadata {
 
   /// The serialization format to be used
   remote::PageFormat serdeFormat{remote::PageFormat::PRESTO_PAGE};
+
+  /// Maximum number of rows sent in one request. Larger batches are split
+  /// into multiple requests. 0 means no limit.
+  vector_size_t maxRowsPerRequest{0};
+
+  /// Maximum number of requests of one batch which are in flight at the same
+  /// time. Requests are issued asynchronously and a new one is sent as soon
+  /// as the oldest one completes.
+  uint32_t maxRequestsInFlight{4};
 };
 
 /// Registers a new remote function. It will use the meatadata defined in
@@ -62,6 +62,12 @@ class RemoteFunctionTest
                                .build()};
     registerRemoteFunction("remote_plus", plusSignatures, metadata);
 
+    RemoteVectorFunctionMetadata batchedMetadata = metadata;
+    batchedMetadata.maxRowsPerRequest = 7;
+    batchedMetadata.maxRequestsInFlight = 3;
+    registerRemoteFunction(
+        "remote_batched_plus", plusSignatures, batchedMetadata);
+
     RemoteVectorFunctionMetadata wrongMetadata = metadata;
     wrongMetadata.location = folly::SocketAddress(); // empty address.
     registerRemoteFunction("remote_wrong_port", plusSignatures, wrongMetadata);
@@ -84,6 +90,8 @@ class RemoteFunctionTest
     // needed for tests since the thrift service runs in the same process.
     registerFunction<PlusFunction, int64_t, int64_t, int64_t>(
         {remotePrefix_ + ".remote_plus"});
+    registerFunction<PlusFunction, int64_t, int64_t, int64_t>(
+        {remotePrefix_ + ".remote_batched_plus"});
     registerFunction<CheckedDivideFunction, double, double, double>(
         {remotePrefix_ + ".remote_divide"});
     registerFunction<SubstrFunction, Varchar, Varchar, int32_t>(
@@ -140,6 +148,30 @@ TEST_P(RemoteFunctionTest, simple) {
   assertEqualVectors(expected, results);
 }
 
+TEST_P(RemoteFunctionTest, batched) {
+  // 100 rows are sent in 15 requests of up to 7 rows, 3 at a time.
+  auto inputVector = makeFlatVector<int64_t>(100, [](auto row) { return row; });
+  auto results = evaluate<SimpleVector<int64_t>>(
+      "remote_batched_plus(c0, c0)", makeRowVector({inputVector}));
+  auto expected =
+      makeFlatVector<int64_t>(100, [](auto row) { return row * 2; });
+  assertEqualVectors(expected, results);
+
+  // Requests for ranges of rows that are not selected are skipped.
+  results = evaluate<SimpleVector<int64_t>>(
+      "if(c0 < 20 or c0 > 80, remote_batched_plus(c0, c0), 0::bigint)",
+      makeRowVector({inputVector}));
+  expected = makeFlatVector<int64_t>(
+      100, [](auto row) { return row < 20 || row > 80 ? row * 2 : 0; });
+  assertEqualVectors(expected, results);
+
+  // Rows that are not selected keep the values set by the other branch.
+  results = evaluate<SimpleVector<int64_t>>(
+      "if(c0 >= 20 and c0 <= 80, 0::bigint, remote_batched_plus(c0, c0))",
+      makeRowVector({inputVector}));
+  assertEqualVectors(expected, results);
+}
+
 TEST_P(RemoteFunctionTest, string) {
   auto inputVector =
       makeFlatVector<StringView>({"hello", "my", "remote", "world"});
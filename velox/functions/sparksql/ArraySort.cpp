@@ -21,7 +21,7 @@
 #include "velox/expression/Expr.h"
 #include "velox/expression/VectorFunction.h"
 #include "velox/functions/lib/RowsTranslationUtil.h"
-#include "velox/functions/sparksql/Comparisons.h"
+#include "velox/functions/lib/ValuesSorter.h"
 #include "velox/type/Type.h"
 #include "velox/vector/BaseVector.h"
 #include "velox/vector/ComplexVector.h"
@@ -103,6 +103,7 @@ void applyTyped(
 
   auto flatResults = (*resultElements)->asFlatVector<T>();
   T* resultRawValues = flatResults->mutableRawValues();
+  ValuesSorter<T> sorter;
 
   auto processRow = [&](vector_size_t row) {
     auto size = inputArray->sizeAt(row);
@@ -143,13 +144,8 @@ void applyTyped(
       bits::fillBits(rawBits, rowBegin, mid, smallerValue);
       bits::fillBits(rawBits, mid, rowEnd, !smallerValue);
     } else {
-      if (ascending) {
-        std::sort(
-            resultRawValues + rowBegin, resultRawValues + rowEnd, Less<T>());
-      } else {
-        std::sort(
-            resultRawValues + rowBegin, resultRawValues + rowEnd, Greater<T>());
-      }
+      // Orders like Less<T> and Greater<T>, i.e. NaN is the largest value.
+      sorter.sort(resultRawValues + rowBegin, rowEnd - rowBegin, ascending);
     }
   };
 
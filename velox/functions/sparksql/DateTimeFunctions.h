@@ -138,6 +138,9 @@ struct UnixDateFunction {
 
 template <typename T>
 struct UnixTimestampFunction {
+  // Reads the clock, so the folded value must not be reused by other queries.
+  static constexpr bool is_foldable_across_queries = false;
+
   // unix_timestamp();
   // If no parameters, return the current unix timestamp without adjusting
   // timezones.
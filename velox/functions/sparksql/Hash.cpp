@@ -16,6 +16,7 @@
 #include "velox/functions/sparksql/Hash.h"
 
 #include <folly/CPortability.h>
+#include <xsimd/xsimd.hpp>
 
 #include "velox/common/base/BitUtil.h"
 #include "velox/expression/DecodedArgs.h"
@@ -274,6 +275,14 @@ void hashSimdTyped(
   const ArgType* __restrict rawA =
       args[hashIdx]->asUnchecked<FlatVector<ArgType>>()->rawValues();
   auto* __restrict rawResult = result.template mutableRawValues<ReturnType>();
+  // Murmur3 is the only 32 bit hash. It hashes dense ranges of rows in SIMD
+  // batches.
+  if constexpr (std::is_same_v<ReturnType, int32_t>) {
+    if (rows->isAllSelected()) {
+      HashClass::hashBatch(rawA, rawResult, rows->begin(), rows->end());
+      return;
+    }
+  }
   rows->applyToSelected([&](auto row) {
     rawResult[row] = hashOne<HashClass>(rawA[row], rawResult[row]);
   });
@@ -308,6 +317,38 @@ void hashSimd(
   }
 }
 
+// Hashes the values of 'decoded', a dictionary or constant, with the same
+// 'seed' for all rows. Each distinct value of the base vector is hashed once.
+template <typename HashClass, TypeKind kind>
+void hashDistinctValues(
+    const SelectivityVector& rows,
+    DecodedVector& decoded,
+    typename HashClass::SeedType seed,
+    typename HashClass::ReturnType* rawResult) {
+  using T = typename TypeTraits<kind>::NativeType;
+  using ReturnType = typename HashClass::ReturnType;
+  if (!rows.hasSelections()) {
+    return;
+  }
+  if (decoded.isConstantMapping()) {
+    const ReturnType hash =
+        hashOne<HashClass>(decoded.valueAt<T>(rows.begin()), seed);
+    rows.applyToSelected([&](auto row) { rawResult[row] = hash; });
+    return;
+  }
+
+  const auto* base = decoded.base()->asUnchecked<SimpleVector<T>>();
+  std::vector<ReturnType> hashes(base->size());
+  for (auto i = 0; i < base->size(); ++i) {
+    if (!base->isNullAt(i)) {
+      hashes[i] = hashOne<HashClass>(base->valueAt(i), seed);
+    }
+  }
+  const auto* indices = decoded.indices();
+  rows.applyToSelected(
+      [&](auto row) { rawResult[row] = hashes[indices[row]]; });
+}
+
 // ReturnType can be either int32_t or int64_t
 // HashClass contains the function like hashInt32
 template <
@@ -350,6 +391,23 @@ void applyWithType(
       continue;
     }
 
+    // The first argument is hashed with the same seed for all rows. The values
+    // of a dictionary are hashed once if there are fewer than rows.
+    if (i == hashIdx && args[i]->type()->isPrimitiveType() &&
+        (decoded->isConstantMapping() ||
+         (!decoded->isIdentityMapping() &&
+          decoded->base()->size() <= selected->countSelected()))) {
+      VELOX_DYNAMIC_SCALAR_TEMPLATE_TYPE_DISPATCH(
+          hashDistinctValues,
+          HashClass,
+          kind,
+          *selected,
+          *decoded,
+          hashSeed,
+          result.mutableRawValues());
+      continue;
+    }
+
     auto hasher = createVectorHasher<HashClass>(*decoded);
     selected->applyToSelected([&](auto row) {
       result.set(row, hasher->hashNotNullAt(row, result.valueAt(row)));
@@ -373,6 +431,48 @@ class Murmur3Hash final {
   using SeedType = int32_t;
   using ReturnType = int32_t;
 
+  // Sets 'hashes[row]' to the hash of 'values[row]' seeded with 'hashes[row]'
+  // for all rows in [begin, end). Values of 4 and 8 bytes are hashed a SIMD
+  // batch of rows at a time.
+  template <typename T>
+  static void hashBatch(
+      const T* values,
+      int32_t* hashes,
+      vector_size_t begin,
+      vector_size_t end) {
+    constexpr bool k4Bytes = std::is_same_v<T, int8_t> ||
+        std::is_same_v<T, int16_t> || std::is_same_v<T, int32_t> ||
+        std::is_same_v<T, float>;
+    constexpr bool k8Bytes = std::is_same_v<T, int64_t> ||
+        std::is_same_v<T, double> || std::is_same_v<T, Timestamp>;
+    auto row = begin;
+    if constexpr (k4Bytes || k8Bytes) {
+      constexpr int32_t kStep = Batch::size;
+      uint32_t low[kStep];
+      uint32_t high[kStep];
+      for (; row + kStep <= end; row += kStep) {
+        for (auto i = 0; i < kStep; ++i) {
+          const auto bits = toBits(values[row + i]);
+          low[i] = bits;
+          if constexpr (k8Bytes) {
+            high[i] = bits >> 32;
+          }
+        }
+        auto* rawHashes = reinterpret_cast<uint32_t*>(hashes + row);
+        auto h1 = mixH1(
+            Batch::load_unaligned(rawHashes),
+            mixK1(Batch::load_unaligned(low)));
+        if constexpr (k8Bytes) {
+          h1 = mixH1(h1, mixK1(Batch::load_unaligned(high)));
+        }
+        fmix(h1, k8Bytes ? 8 : 4).store_unaligned(rawHashes);
+      }
+    }
+    for (; row < end; ++row) {
+      hashes[row] = hashOne<Murmur3Hash>(values[row], hashes[row]);
+    }
+  }
+
   static uint32_t hashInt32(int32_t input, uint32_t seed) {
     uint32_t k1 = mixK1(input);
     uint32_t h1 = mixH1(seed, k1);
@@ -430,6 +530,58 @@ class Murmur3Hash final {
   }
 
  private:
+  using Batch = xsimd::batch<uint32_t>;
+
+  // Returns the bits hashed by hashInt32, hashInt64, hashFloat, hashDouble and
+  // hashTimestamp.
+  static uint32_t toBits(int32_t input) {
+    return input;
+  }
+
+  static uint32_t toBits(float input) {
+    return input == -0.f ? 0 : *reinterpret_cast<uint32_t*>(&input);
+  }
+
+  static uint64_t toBits(int64_t input) {
+    return input;
+  }
+
+  static uint64_t toBits(double input) {
+    return input == -0. ? 0 : *reinterpret_cast<uint64_t*>(&input);
+  }
+
+  static uint64_t toBits(Timestamp input) {
+    return input.toMicros();
+  }
+
+  static Batch rotateLeft(Batch input, int32_t distance) {
+    return (input << distance) | (input >> (32 - distance));
+  }
+
+  static Batch mixK1(Batch k1) {
+    k1 *= xsimd::broadcast<uint32_t>(0xcc9e2d51);
+    k1 = rotateLeft(k1, 15);
+    k1 *= xsimd::broadcast<uint32_t>(0x1b873593);
+    return k1;
+  }
+
+  static Batch mixH1(Batch h1, Batch k1) {
+    h1 ^= k1;
+    h1 = rotateLeft(h1, 13);
+    return h1 * xsimd::broadcast<uint32_t>(5) +
+        xsimd::broadcast<uint32_t>(0xe6546b64);
+  }
+
+  static Batch fmix(Batch h1, uint32_t length) {
+    h1 ^= xsimd::broadcast<uint32_t>(length);
+    h1 ^= h1 >> 16;
+    h1 *= xsimd::broadcast<uint32_t>(0x85ebca6b);
+    h1 ^= h1 >> 13;
+    h1 *= xsimd::broadcast<uint32_t>(0xc2b2ae35);
+    h1 ^= h1 >> 16;
+    return h1;
+  }
+
   static uint32_t mixK1(uint32_t k1) {
     k1 *= 0xcc9e2d51;
     k1 = bits::rotateLeft(k1, 15);
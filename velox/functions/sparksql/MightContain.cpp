@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/functions/sparksql/MightContain.h"
+
+#include <folly/hash/Hash.h>
+
+#include "velox/common/base/BloomFilter.h"
+#include "velox/common/base/SplitBlockBloomFilter.h"
+#include "velox/expression/DecodedArgs.h"
+
+namespace facebook::velox::functions::sparksql {
+namespace {
+
+// Probes a bloom filter deserialized once per expression.
+template <typename Filter>
+class MightContainFunction final : public exec::VectorFunction {
+ public:
+  explicit MightContainFunction(Filter bloomFilter)
+      : bloomFilter_(std::move(bloomFilter)) {}
+
+  void apply(
+      const SelectivityVector& rows,
+      std::vector<VectorPtr>& args,
+      const TypePtr& /* outputType */,
+      exec::EvalCtx& context,
+      VectorPtr& result) const final {
+    context.ensureWritable(rows, BOOLEAN(), result);
+    // A reused result may have nulls in 'rows'.
+    result->clearNulls(rows);
+    auto* rawResult = result->asUnchecked<FlatVector<bool>>()
+                          ->template mutableRawValues<uint64_t>();
+    exec::DecodedArgs decodedArgs(rows, {args[1]}, context);
+    auto* values = decodedArgs.at(0);
+
+    if (values->isIdentityMapping()) {
+      probeFlat(rows, values->data<int64_t>(), rawResult);
+      return;
+    }
+    rows.applyToSelected([&](auto row) {
+      bits::setBit(
+          rawResult,
+          row,
+          bloomFilter_.mayContain(
+              folly::hasher<int64_t>()(values->valueAt<int64_t>(row))));
+    });
+  }
+
+ private:
+  // Number of rows to prefetch the filter ahead of the probed row.
+  static constexpr int32_t kPrefetchDistance = 16;
+
+  // Hashes all selected values first, then probes them, prefetching the part
+  // of the filter of each value a few rows ahead.
+  void probeFlat(
+      const SelectivityVector& rows,
+      const int64_t* values,
+      uint64_t* rawResult) const {
+    std::vector<uint64_t> hashes(rows.end());
+    rows.applyToSelected([&](auto row) {
+      hashes[row] = folly::hasher<int64_t>()(values[row]);
+    });
+    rows.applyToSelected([&](auto row) {
+      if constexpr (std::is_same_v<Filter, SplitBlockBloomFilter<>>) {
+        if (row + kPrefetchDistance < rows.end()) {
+          bloomFilter_.prefetch(hashes[row + kPrefetchDistance]);
+        }
+      }
+      bits::setBit(rawResult, row, bloomFilter_.mayContain(hashes[row]));
+    });
+  }
+
+  const Filter bloomFilter_;
+};
+
+// Returns false for all rows. Used if the bloom filter is not a constant.
+class NoBloomFilterFunction final : public exec::VectorFunction {
+ public:
+  void apply(
+      const SelectivityVector& rows,
+      std::vector<VectorPtr>& /* args */,
+      const TypePtr& /* outputType */,
+      exec::EvalCtx& context,
+      VectorPtr& result) const final {
+    context.ensureWritable(rows, BOOLEAN(), result);
+    auto* flatResult = result->asUnchecked<FlatVector<bool>>();
+    rows.applyToSelected([&](auto row) { flatResult->set(row, false); });
+  }
+};
+
+} // namespace
+
+std::vector<std::shared_ptr<exec::FunctionSignature>> mightContainSignatures() {
+  return {exec::FunctionSignatureBuilder()
+              .returnType("boolean")
+              .argumentType("varbinary")
+              .argumentType("bigint")
+              .build()};
+}
+
+std::shared_ptr<exec::VectorFunction> makeMightContain(
+    const std::string& name,
+    const std::vector<exec::VectorFunctionArg>& inputArgs,
+    const core::QueryConfig& /* config */) {
+  VELOX_CHECK_EQ(inputArgs.size(), 2);
+  const auto& serializedVector = inputArgs[0].constantValue;
+  static const auto kNoBloomFilter = std::make_shared<NoBloomFilterFunction>();
+  if (serializedVector == nullptr || serializedVector->isNullAt(0)) {
+    return kNoBloomFilter;
+  }
+
+  const auto serialized =
+      serializedVector->as<ConstantVector<StringView>>()->valueAt(0).str();
+  if (SplitBlockBloomFilter<>::isSplitBlock(serialized.data())) {
+    SplitBlockBloomFilter<> bloomFilter;
+    bloomFilter.merge(serialized.data());
+    if (!bloomFilter.isSet()) {
+      return kNoBloomFilter;
+    }
+    return std::make_shared<MightContainFunction<SplitBlockBloomFilter<>>>(
+        std::move(bloomFilter));
+  }
+  BloomFilter<> bloomFilter;
+  bloomFilter.merge(serialized.data());
+  if (!bloomFilter.isSet()) {
+    return kNoBloomFilter;
+  }
+  return std::make_shared<MightContainFunction<BloomFilter<>>>(
+      std::move(bloomFilter));
+}
+
+} // namespace facebook::velox::functions::sparksql
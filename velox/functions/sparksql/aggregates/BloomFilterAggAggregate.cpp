@@ -17,6 +17,7 @@
 #include "velox/functions/sparksql/aggregates/BloomFilterAggAggregate.h"
 
 #include "velox/common/base/BloomFilter.h"
+#include "velox/common/base/SplitBlockBloomFilter.h"
 #include "velox/exec/Aggregate.h"
 #include "velox/expression/FunctionSignature.h"
 #include "velox/vector/FlatVector.h"
@@ -25,6 +26,8 @@ namespace facebook::velox::functions::aggregate::sparksql {
 
 namespace {
 
+// 'Filter' is BloomFilter or SplitBlockBloomFilter.
+template <template <typename> class Filter>
 struct BloomFilterAccumulator {
   explicit BloomFilterAccumulator(HashStringAllocator* allocator)
       : bloomFilter{StlAllocator<uint64_t>(allocator)} {}
@@ -55,10 +58,13 @@ struct BloomFilterAccumulator {
     bloomFilter.insert(folly::hasher<int64_t>()(value));
   }
 
-  BloomFilter<StlAllocator<uint64_t>> bloomFilter;
+  Filter<StlAllocator<uint64_t>> bloomFilter;
 };
 
+template <template <typename> class Filter>
 class BloomFilterAggAggregate : public exec::Aggregate {
+  using Accumulator = BloomFilterAccumulator<Filter>;
+
  public:
   explicit BloomFilterAggAggregate(
       const TypePtr& resultType,
@@ -69,7 +75,7 @@ class BloomFilterAggAggregate : public exec::Aggregate {
         maxNumBits_(config.sparkBloomFilterMaxNumBits()) {}
 
   int32_t accumulatorFixedWidthSize() const override {
-    return sizeof(BloomFilterAccumulator);
+    return sizeof(Accumulator);
   }
 
   bool isFixedSize() const override {
@@ -98,7 +104,7 @@ class BloomFilterAggAggregate : public exec::Aggregate {
       }
       auto group = groups[row];
       auto tracker = trackRowSize(group);
-      auto accumulator = value<BloomFilterAccumulator>(group);
+      auto accumulator = value<Accumulator>(group);
       accumulator->init(capacity_);
       accumulator->insert(decodedRaw_.valueAt<int64_t>(row));
     });
@@ -118,7 +124,7 @@ class BloomFilterAggAggregate : public exec::Aggregate {
       auto group = groups[row];
       auto tracker = trackRowSize(group);
       auto serialized = decodedIntermediate_.valueAt<StringView>(row);
-      auto accumulator = value<BloomFilterAccumulator>(group);
+      auto accumulator = value<Accumulator>(group);
       accumulator->mergeWith(serialized);
     });
   }
@@ -131,7 +137,7 @@ class BloomFilterAggAggregate : public exec::Aggregate {
     decodeArguments(rows, args);
     computeCapacity();
     auto tracker = trackRowSize(group);
-    auto accumulator = value<BloomFilterAccumulator>(group);
+    auto accumulator = value<Accumulator>(group);
     accumulator->init(capacity_);
     if (decodedRaw_.isConstantMapping()) {
       // All values are same, just do for the first.
@@ -156,7 +162,7 @@ class BloomFilterAggAggregate : public exec::Aggregate {
     VELOX_CHECK_EQ(args.size(), 1);
     decodedIntermediate_.decode(*args[0], rows);
     auto tracker = trackRowSize(group);
-    auto accumulator = value<BloomFilterAccumulator>(group);
+    auto accumulator = value<Accumulator>(group);
     rows.applyToSelected([&](auto row) {
       if (UNLIKELY(decodedIntermediate_.isNullAt(row))) {
         return;
@@ -176,7 +182,7 @@ class BloomFilterAggAggregate : public exec::Aggregate {
     char* rawBuffer = flatResult->getRawStringBufferWithSpace(totalSize);
     for (vector_size_t i = 0; i < numGroups; ++i) {
       auto group = groups[i];
-      auto accumulator = value<BloomFilterAccumulator>(group);
+      auto accumulator = value<Accumulator>(group);
       if (UNLIKELY(!accumulator->initialized())) {
         flatResult->setNull(i, true);
         continue;
@@ -202,7 +208,7 @@ class BloomFilterAggAggregate : public exec::Aggregate {
       folly::Range<const vector_size_t*> indices) override {
     setAllNulls(groups, indices);
     for (auto i : indices) {
-      new (groups[i] + offset_) BloomFilterAccumulator(allocator_);
+      new (groups[i] + offset_) Accumulator(allocator_);
     }
   }
 
@@ -240,7 +246,7 @@ class BloomFilterAggAggregate : public exec::Aggregate {
     int32_t totalSize = 0;
     for (vector_size_t i = 0; i < numGroups; ++i) {
       auto group = groups[i];
-      auto accumulator = value<BloomFilterAccumulator>(group);
+      auto accumulator = value<Accumulator>(group);
       if (UNLIKELY(!accumulator->initialized())) {
         continue;
       }
@@ -320,7 +326,13 @@ exec::AggregateRegistrationResult registerBloomFilterAggAggregate(
           const std::vector<TypePtr>& /* argTypes */,
           const TypePtr& resultType,
           const core::QueryConfig& config) -> std::unique_ptr<exec::Aggregate> {
-        return std::make_unique<BloomFilterAggAggregate>(resultType, config);
+        if (config.sparkBloomFilterSplitBlock()) {
+          return std::make_unique<
+              BloomFilterAggAggregate<SplitBlockBloomFilter>>(
+              resultType, config);
+        }
+        return std::make_unique<BloomFilterAggAggregate<BloomFilter>>(
+            resultType, config);
       },
       withCompanionFunctions,
       overwrite);
@@ -15,6 +15,7 @@
  */
 
 #include "velox/common/base/BloomFilter.h"
+#include "velox/common/base/SplitBlockBloomFilter.h"
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/exec/tests/utils/AssertQueryBuilder.h"
 #include "velox/exec/tests/utils/PlanBuilder.h"
@@ -31,8 +32,9 @@ class BloomFilterAggAggregateTest
     registerAggregateFunctions("");
   }
 
+  template <typename Filter = BloomFilter<>>
   VectorPtr getSerializedBloomFilter(int32_t capacity) {
-    BloomFilter bloomFilter;
+    Filter bloomFilter;
     bloomFilter.reset(capacity);
     for (auto i = 0; i < 9; ++i) {
       bloomFilter.insert(folly::hasher<int64_t>()(i));
@@ -52,6 +54,19 @@ TEST_F(BloomFilterAggAggregateTest, basic) {
   testAggregations(vectors, {}, {"bloom_filter_agg(c0, 5, 64)"}, expected);
 }
 
+TEST_F(BloomFilterAggAggregateTest, splitBlock) {
+  auto vectors = {makeRowVector({makeFlatVector<int64_t>(
+      100, [](vector_size_t row) { return row % 9; })})};
+  auto expected = {makeRowVector(
+      {getSerializedBloomFilter<SplitBlockBloomFilter<>>(4)})};
+  testAggregations(
+      vectors,
+      {},
+      {"bloom_filter_agg(c0, 5, 64)"},
+      expected,
+      {{core::QueryConfig::kSparkBloomFilterSplitBlock, "true"}});
+}
+
 TEST_F(BloomFilterAggAggregateTest, bloomFilterAggArgument) {
   auto vectors = {makeRowVector({makeFlatVector<int64_t>(
       100, [](vector_size_t row) { return row % 9; })})};
@@ -58,6 +58,46 @@ int main(int argc, char** argv) {
     }
   }
 
+  // Hashing several columns, as done to partition rows for a shuffle.
+  for (auto& inputType : {INTEGER(), BIGINT(), DOUBLE()}) {
+    benchmarkBuilder
+        .addBenchmarkSet(
+            fmt::format("hash#3x{}", inputType->toString()),
+            ROW({"c0", "c1", "c2"}, {inputType, inputType, inputType}))
+        .withFuzzerOptions({.vectorSize = 4096, .nullRatio = 0})
+        .addExpression("hash", "hash(c0, c1, c2)")
+        .addExpression("xxhash64", "xxhash64(c0, c1, c2)")
+        .withIterations(100);
+  }
+
+  // Dictionary encoded columns with few distinct values. The values of the
+  // first column are hashed once.
+  auto& vectorMaker = benchmarkBuilder.vectorMaker();
+  constexpr vector_size_t kSize = 4096;
+  for (auto numDistinct : {16, 1024}) {
+    auto indices = AlignedBuffer::allocate<vector_size_t>(
+        kSize, benchmarkBuilder.pool());
+    auto* rawIndices = indices->asMutable<vector_size_t>();
+    for (auto i = 0; i < kSize; ++i) {
+      rawIndices[i] = (i * 7919) % numDistinct;
+    }
+    auto strings = vectorMaker.flatVector<std::string>(
+        numDistinct, [](auto row) { return fmt::format("value {}", row); });
+    auto dictionary =
+        BaseVector::wrapInDictionary(nullptr, indices, kSize, strings);
+    auto flat = BaseVector::copy(*dictionary);
+    auto longs = vectorMaker.flatVector<int64_t>(
+        kSize, [](auto row) { return row; });
+
+    benchmarkBuilder
+        .addBenchmarkSet(
+            fmt::format("hash#dictionary#{}_distinct", numDistinct),
+            vectorMaker.rowVector({dictionary, flat, longs}))
+        .addExpression("dictionary", "hash(c0, c2)")
+        .addExpression("flat", "hash(c1, c2)")
+        .withIterations(100);
+  }
+
   benchmarkBuilder.registerBenchmarks();
   folly::runBenchmarks();
   return 0;
@@ -268,5 +268,51 @@ TEST_F(HashTest, simd) {
   runSIMDHashAndAssert<int64_t>(-1, -939490007, 1024, 3);
 }
 
+TEST_F(HashTest, simdDistinctValues) {
+  // Each row of the SIMD batches has a different value and seed.
+  auto c0 = makeFlatVector<int64_t>(
+      100, [](auto row) { return row * 0x9E3779B97F4A7C15; });
+  auto c1 = makeFlatVector<double>(
+      100, [](auto row) { return row % 7 == 0 ? -0.0 : row * 1.5; });
+  auto c2 = makeFlatVector<int32_t>(100, [](auto row) { return row - 50; });
+  auto result = evaluate("hash(c0, c1, c2)", makeRowVector({c0, c1, c2}));
+
+  auto expected = makeFlatVector<int32_t>(100, [&](auto row) {
+    return evaluateOnce<int32_t>(
+               "hash(c0, c1, c2)",
+               std::optional(c0->valueAt(row)),
+               std::optional(c1->valueAt(row)),
+               std::optional(c2->valueAt(row)))
+        .value();
+  });
+  assertEqualVectors(expected, result);
+}
+
+TEST_F(HashTest, dictionary) {
+  auto base = makeNullableFlatVector<std::string>(
+      {"Spark", std::nullopt, "", "abcdefghijklmnopqrstuvwxyz"});
+  auto indices = makeIndices(100, [](auto row) { return (row * 7) % 4; });
+  auto dictionary = wrapInDictionary(indices, 100, base);
+  auto flat = flatten(dictionary);
+  assertEqualVectors(hash(flat), hash(dictionary));
+
+  // Dictionary over a larger base.
+  indices = makeIndices(3, [](auto row) { return row + 1; });
+  dictionary = wrapInDictionary(indices, 3, base);
+  assertEqualVectors(hash(flatten(dictionary)), hash(dictionary));
+
+  // Multiple columns. Only the first one is hashed once per distinct value.
+  auto c1 = makeFlatVector<int64_t>(100, [](auto row) { return row; });
+  assertEqualVectors(
+      evaluate("hash(c0, c1)", makeRowVector({flat, c1})),
+      evaluate("hash(c0, c1)", makeRowVector({dictionary, c1})));
+
+  auto constant = makeConstant<int64_t>(-1, 100);
+  assertEqualVectors(makeConstant<int32_t>(-939490007, 100), hash(constant));
+  assertEqualVectors(
+      evaluate("hash(c0, c1)", makeRowVector({flatten(constant), c1})),
+      evaluate("hash(c0, c1)", makeRowVector({constant, c1})));
+}
+
 } // namespace
 } // namespace facebook::velox::functions::sparksql::test
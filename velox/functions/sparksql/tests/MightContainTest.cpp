@@ -16,6 +16,7 @@
 
 #include "velox/functions/sparksql/MightContain.h"
 #include "velox/common/base/BloomFilter.h"
+#include "velox/common/base/SplitBlockBloomFilter.h"
 #include "velox/functions/sparksql/tests/SparkFunctionBaseTest.h"
 
 namespace facebook::velox::functions::sparksql::test {
@@ -26,7 +27,8 @@ class MightContainTest : public SparkFunctionBaseTest {
   void testMightContain(
       const std::optional<std::string>& serialized,
       const VectorPtr& value,
-      const VectorPtr& expected) {
+      const VectorPtr& expected,
+      VectorPtr result = nullptr) {
     // Not using `evaluate()` because the bloom filter binary cannot be parsed
     // by DuckDB parser.
     auto selected = SelectivityVector(value->size());
@@ -46,13 +48,14 @@ class MightContainTest : public SparkFunctionBaseTest {
         &execCtx_);
     auto data = makeRowVector({value});
     exec::EvalCtx evalCtx(&execCtx_, &expr, data.get());
-    std::vector<VectorPtr> results(1);
+    std::vector<VectorPtr> results{std::move(result)};
     expr.eval(selected, evalCtx, results);
     velox::test::assertEqualVectors(expected, results[0]);
   }
 
+  template <typename Filter = BloomFilter<>>
   std::string getSerializedBloomFilter(int32_t kSize) {
-    BloomFilter bloomFilter;
+    Filter bloomFilter;
     bloomFilter.reset(kSize);
     for (auto i = 0; i < kSize; ++i) {
       bloomFilter.insert(folly::hasher<int64_t>()(i));
@@ -84,6 +87,43 @@ TEST_F(MightContainTest, basic) {
   testMightContain(serialized, values, expected);
 }
 
+TEST_F(MightContainTest, splitBlock) {
+  constexpr int32_t kSize = 1'000;
+  auto serialized = getSerializedBloomFilter<SplitBlockBloomFilter<>>(kSize);
+  auto value =
+      makeFlatVector<int64_t>(kSize, [](vector_size_t row) { return row; });
+  testMightContain(serialized, value, makeConstant(true, kSize));
+
+  auto values = makeNullableFlatVector<int64_t>(
+      {1, 2, 3, std::nullopt, 123451, 23456, 999});
+  auto expected = makeNullableFlatVector<bool>(
+      {true, true, true, std::nullopt, false, false, true});
+  testMightContain(serialized, values, expected);
+
+  // Dictionary encoded values.
+  auto indices = makeIndicesInReverse(kSize);
+  testMightContain(
+      serialized,
+      wrapInDictionary(indices, kSize, value),
+      makeConstant(true, kSize));
+}
+
+TEST_F(MightContainTest, reusedResult) {
+  // The nulls of a reused result vector do not leak into the output.
+  constexpr int32_t kSize = 100;
+  auto value =
+      makeFlatVector<int64_t>(kSize, [](vector_size_t row) { return row; });
+  for (const auto& serialized :
+       {getSerializedBloomFilter(kSize),
+        getSerializedBloomFilter<SplitBlockBloomFilter<>>(kSize)}) {
+    testMightContain(
+        serialized,
+        value,
+        makeConstant(true, kSize),
+        makeAllNullFlatVector<bool>(kSize));
+  }
+}
+
 TEST_F(MightContainTest, nullBloomFilter) {
   auto value = makeFlatVector<int64_t>({2, 4});
   auto expected = makeNullConstant(TypeKind::BOOLEAN, value->size());
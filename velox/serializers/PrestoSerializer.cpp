@@ -25,6 +25,7 @@
 #include "velox/vector/BiasVector.h"
 #include "velox/vector/ComplexVector.h"
 #include "velox/vector/DictionaryVector.h"
+#include "velox/vector/FlatMapVector.h"
 #include "velox/vector/FlatVector.h"
 #include "velox/vector/VectorTypeUtils.h"
 
@@ -2307,6 +2308,13 @@ void serializeColumn(
     case VectorEncoding::Simple::MAP:
       serializeMapVector(vector, ranges, stream, scratch);
       break;
+    case VectorEncoding::Simple::FLAT_MAP:
+      serializeMapVector(
+          vector->asUnchecked<FlatMapVector>()->mapVector(),
+          ranges,
+          stream,
+          scratch);
+      break;
     case VectorEncoding::Simple::LAZY:
       serializeColumn(
           BaseVector::loadedVectorShared(vector), ranges, stream, scratch);
@@ -2899,6 +2907,13 @@ void serializeColumn(
     case VectorEncoding::Simple::MAP:
       serializeMapVector(vector, rows, stream, scratch);
       break;
+    case VectorEncoding::Simple::FLAT_MAP:
+      serializeMapVector(
+          vector->asUnchecked<FlatMapVector>()->mapVector(),
+          rows,
+          stream,
+          scratch);
+      break;
     case VectorEncoding::Simple::LAZY:
       serializeColumn(
           BaseVector::loadedVectorShared(vector), rows, stream, scratch);
@@ -3176,6 +3191,13 @@ void estimateSerializedSizeInt(
           scratch);
       break;
     }
+    case VectorEncoding::Simple::FLAT_MAP:
+      estimateSerializedSizeInt(
+          vector->asUnchecked<FlatMapVector>()->mapVector().get(),
+          ranges,
+          sizes,
+          scratch);
+      break;
     case VectorEncoding::Simple::LAZY:
       estimateSerializedSizeInt(vector->loadedVector(), ranges, sizes, scratch);
       break;
@@ -3466,6 +3488,13 @@ void estimateSerializedSizeInt(
           scratch);
       break;
     }
+    case VectorEncoding::Simple::FLAT_MAP:
+      estimateSerializedSizeInt(
+          vector->asUnchecked<FlatMapVector>()->mapVector().get(),
+          rows,
+          sizes,
+          scratch);
+      break;
     case VectorEncoding::Simple::LAZY:
       estimateSerializedSizeInt(vector->loadedVector(), rows, sizes, scratch);
       break;
@@ -3742,7 +3771,8 @@ class PrestoBatchVectorSerializer : public BatchVectorSerializer {
  public:
   PrestoBatchVectorSerializer(memory::MemoryPool* pool, const SerdeOpts& opts)
       : pool_(pool),
-        codec_(common::compressionKindToCodec(opts.compressionKind)),
+        codec_(common::compressionKindToCodec(
+            opts.compressionKind, opts.compressionDictionary)),
         opts_(opts) {}
 
   void serialize(
@@ -3899,6 +3929,13 @@ class PrestoBatchVectorSerializer : public BatchVectorSerializer {
             arrayVector->elements(), childRanges, childSizes.data(), scratch);
         break;
       }
+      case VectorEncoding::Simple::FLAT_MAP:
+        estimateSerializedSizeImpl(
+            vector->asUnchecked<FlatMapVector>()->mapVector(),
+            ranges,
+            sizes,
+            scratch);
+        break;
       case VectorEncoding::Simple::LAZY:
         estimateSerializedSizeImpl(
             vector->as<LazyVector>()->loadedVectorShared(),
@@ -3926,7 +3963,8 @@ class PrestoIterativeVectorSerializer : public IterativeVectorSerializer {
       const SerdeOpts& opts)
       : opts_(opts),
         streamArena_(streamArena),
-        codec_(common::compressionKindToCodec(opts.compressionKind)) {
+        codec_(common::compressionKindToCodec(
+            opts.compressionKind, opts.compressionDictionary)) {
     const auto types = rowType->children();
     const auto numTypes = types.size();
     streams_.resize(numTypes);
@@ -4178,8 +4216,8 @@ void PrestoVectorSerde::deserialize(
     vector_size_t resultOffset,
     const Options* options) {
   const auto prestoOptions = toPrestoOptions(options);
-  const auto codec =
-      common::compressionKindToCodec(prestoOptions.compressionKind);
+  const auto codec = common::compressionKindToCodec(
+      prestoOptions.compressionKind, prestoOptions.compressionDictionary);
   auto const header = PrestoHeader::read(source);
 
   int64_t actualCheckSum = 0;
@@ -72,6 +72,12 @@ class PrestoVectorSerde : public VectorSerde {
     /// than this causes subsequent compression attempts to be skipped. The more
     /// times compression misses the target the less frequently it is tried.
     float minCompressionRatio{0.8};
+
+    /// If set, pages are compressed with this dictionary. Requires zstd
+    /// compression. The reader must use the same dictionary, which the
+    /// Presto wire format does not carry, so this is only usable when the
+    /// dictionary is exchanged out of band, e.g. in spilling.
+    std::shared_ptr<const common::ZstdDictionary> compressionDictionary;
   };
 
   /// Adds the serialized sizes of the rows of 'vector' in 'ranges[i]' to
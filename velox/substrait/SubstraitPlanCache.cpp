@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/substrait/SubstraitPlanCache.h"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+namespace facebook::velox::substrait {
+namespace {
+
+std::string serializeDeterministic(const ::substrait::Plan& substraitPlan) {
+  std::string serialized;
+  {
+    google::protobuf::io::StringOutputStream stream(&serialized);
+    google::protobuf::io::CodedOutputStream output(&stream);
+    output.SetSerializationDeterministic(true);
+    VELOX_CHECK(
+        substraitPlan.SerializeToCodedStream(&output),
+        "Failed to serialize Substrait plan");
+  }
+  return serialized;
+}
+} // namespace
+
+SubstraitPlanCache::SubstraitPlanCache(
+    size_t maxEntries,
+    memory::MemoryPool* pool)
+    : pool_(pool), cache_(maxEntries) {
+  VELOX_CHECK_GT(maxEntries, 0);
+  VELOX_CHECK_NOT_NULL(pool_);
+}
+
+std::shared_ptr<const SubstraitPlanCache::Entry>
+SubstraitPlanCache::getOrConvert(const ::substrait::Plan& substraitPlan) {
+  auto key = serializeDeterministic(substraitPlan);
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    ++numLookups_;
+    auto it = cache_.find(key);
+    if (it != cache_.end()) {
+      ++numHits_;
+      return it->second;
+    }
+  }
+
+  // Converts outside of the lock. If the same plan is converted concurrently,
+  // the last conversion replaces the others in the cache.
+  SubstraitVeloxPlanConverter converter(pool_);
+  auto entry = std::make_shared<Entry>();
+  entry->plan = converter.toVeloxPlan(substraitPlan);
+  entry->splitInfos = converter.splitInfos();
+
+  std::lock_guard<std::mutex> l(mutex_);
+  cache_.set(std::move(key), entry);
+  return entry;
+}
+
+SubstraitPlanCache::Stats SubstraitPlanCache::stats() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  return Stats{cache_.size(), numHits_, numLookups_};
+}
+
+void SubstraitPlanCache::clear() {
+  std::lock_guard<std::mutex> l(mutex_);
+  cache_.clear();
+}
+
+} // namespace facebook::velox::substrait
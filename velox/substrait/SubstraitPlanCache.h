@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <folly/container/EvictingCacheMap.h>
+#include <mutex>
+
+#include "velox/substrait/SubstraitToVeloxPlan.h"
+
+namespace facebook::velox::substrait {
+
+/// Caches the Velox plans converted from Substrait plans. Frontends often send
+/// the same plan repeatedly and a hit skips parsing types, resolving function
+/// signatures and rebuilding the PlanNode tree. Plans are keyed by their
+/// deterministic serialization, so only identical plans hit. Converted plans
+/// are immutable and are shared by all the queries using them. Thread-safe.
+class SubstraitPlanCache {
+ public:
+  /// A converted plan and the splits of its leaf nodes.
+  struct Entry {
+    core::PlanNodePtr plan;
+    std::unordered_map<
+        core::PlanNodeId,
+        std::shared_ptr<SubstraitVeloxPlanConverter::SplitInfo>>
+        splitInfos;
+  };
+
+  struct Stats {
+    size_t numEntries{0};
+    size_t numHits{0};
+    size_t numLookups{0};
+  };
+
+  /// Keeps the 'maxEntries' most recently used plans. 'pool' holds the
+  /// constant vectors of the converted plans and must outlive the cache.
+  SubstraitPlanCache(size_t maxEntries, memory::MemoryPool* pool);
+
+  /// Returns the conversion of 'substraitPlan'. Converts the plan and caches
+  /// the result if it is not cached.
+  std::shared_ptr<const Entry> getOrConvert(
+      const ::substrait::Plan& substraitPlan);
+
+  Stats stats() const;
+
+  void clear();
+
+ private:
+  memory::MemoryPool* const pool_;
+
+  mutable std::mutex mutex_;
+  folly::EvictingCacheMap<std::string, std::shared_ptr<const Entry>> cache_;
+  size_t numHits_{0};
+  size_t numLookups_{0};
+};
+
+} // namespace facebook::velox::substrait
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/substrait/tests/JsonToProtoConverter.h"
+
+#include "velox/dwio/common/tests/utils/DataFiles.h"
+#include "velox/exec/tests/utils/OperatorTestBase.h"
+
+#include "velox/substrait/SubstraitPlanCache.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::test;
+using namespace facebook::velox::exec::test;
+using namespace facebook::velox::substrait;
+
+class SubstraitPlanCacheTest : public OperatorTestBase {
+ protected:
+  ::substrait::Plan readPlan() {
+    auto planPath = getDataFilePath(
+        "velox/substrait/tests", "data/substrait_virtualTable.json");
+    ::substrait::Plan substraitPlan;
+    JsonToProtoConverter::readFromFile(planPath, substraitPlan);
+    return substraitPlan;
+  }
+};
+
+TEST_F(SubstraitPlanCacheTest, hitAndEvict) {
+  SubstraitPlanCache cache(1, pool_.get());
+  const auto substraitPlan = readPlan();
+
+  auto entry = cache.getOrConvert(substraitPlan);
+  ASSERT_NE(entry->plan, nullptr);
+  ASSERT_EQ(cache.stats().numEntries, 1);
+  ASSERT_EQ(cache.stats().numHits, 0);
+
+  // The same plan reuses the conversion.
+  ASSERT_EQ(cache.getOrConvert(substraitPlan), entry);
+  ASSERT_EQ(cache.stats().numHits, 1);
+  ASSERT_EQ(cache.stats().numLookups, 2);
+
+  RowVectorPtr expectedData = makeRowVector(
+      {makeFlatVector<int64_t>(
+           {2499109626526694126, 2342493223442167775, 4077358421272316858}),
+       makeFlatVector<int32_t>({581869302, -708632711, -133711905}),
+       makeFlatVector<double>(
+           {0.90579193414549275, 0.96886777112423139, 0.63235925003444637}),
+       makeFlatVector<bool>({true, false, false}),
+       makeFlatVector<int32_t>(3, nullptr, nullEvery(1))});
+  createDuckDbTable({expectedData});
+  assertQuery(entry->plan, "SELECT * FROM tmp");
+
+  // A different plan replaces the only entry.
+  auto otherPlan = substraitPlan;
+  otherPlan.add_extension_uris()->set_uri("/other.yaml");
+  auto otherEntry = cache.getOrConvert(otherPlan);
+  ASSERT_NE(otherEntry, entry);
+  ASSERT_EQ(cache.stats().numEntries, 1);
+  ASSERT_NE(cache.getOrConvert(substraitPlan), entry);
+  ASSERT_EQ(cache.stats().numHits, 1);
+
+  cache.clear();
+  ASSERT_EQ(cache.stats().numEntries, 0);
+}
@@ -18,7 +18,10 @@
 
 #include <folly/Conv.h>
 #include <folly/Expected.h>
+#include <folly/Portability.h>
 #include <cctype>
+#include <cstring>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include "velox/common/base/Exceptions.h"
@@ -131,6 +134,126 @@ Expected<T> callFollyTo(const F& v) {
   return result.value();
 }
 
+/// Parses the 'size' decimal digits at 'data' into 'value'. Returns false if
+/// any character is not a digit. 'size' must be at most 19 so that the value
+/// fits in 64 bits. Converts 8 digits at a time with 64-bit arithmetic.
+inline bool parseDigits(const char* data, size_t size, uint64_t& value) {
+  value = 0;
+  if constexpr (folly::kIsLittleEndian) {
+    for (; size >= 8; data += 8, size -= 8) {
+      uint64_t chunk;
+      std::memcpy(&chunk, data, sizeof(chunk));
+      // A byte is a digit if its high nibble is 3 and stays 3 after adding 6.
+      if (((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+           (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >>
+            4)) != 0x3333333333333333ULL) {
+        return false;
+      }
+      // The first digit is in the lowest byte. Combines pairs of digits, then
+      // pairs of 2 digit numbers, then pairs of 4 digit numbers.
+      chunk -= 0x3030303030303030ULL;
+      chunk = (chunk * 10 + (chunk >> 8)) & 0x00FF00FF00FF00FFULL;
+      chunk = (chunk * 100 + (chunk >> 16)) & 0x0000FFFF0000FFFFULL;
+      chunk = (chunk * 10'000 + (chunk >> 32)) & 0xFFFFFFFFULL;
+      value = value * 100'000'000 + chunk;
+    }
+  }
+  for (; size > 0; ++data, --size) {
+    const uint8_t digit = *data - '0';
+    if (digit > 9) {
+      return false;
+    }
+    value = value * 10 + digit;
+  }
+  return true;
+}
+
+/// Fast path for casting a string of an optional sign followed by at most 19
+/// digits to an integral type of at most 64 bits. Returns std::nullopt if 'v'
+/// has any other form or if the value does not fit in 'T'. The caller then
+/// falls back to the general conversion, which also produces the error.
+template <typename T>
+std::optional<T> tryParseInteger(folly::StringPiece v) {
+  static_assert(std::is_integral_v<T> && sizeof(T) <= sizeof(int64_t));
+  const char* data = v.data();
+  size_t size = v.size();
+  bool negative = false;
+  if (size > 0 && (data[0] == '-' || data[0] == '+')) {
+    negative = data[0] == '-';
+    ++data;
+    --size;
+  }
+  uint64_t magnitude;
+  if (size == 0 || size > 19 || !parseDigits(data, size, magnitude)) {
+    return std::nullopt;
+  }
+  constexpr auto kMax = static_cast<uint64_t>(std::numeric_limits<T>::max());
+  if (negative) {
+    if (magnitude > kMax + 1) {
+      return std::nullopt;
+    }
+    return static_cast<T>(0 - magnitude);
+  }
+  if (magnitude > kMax) {
+    return std::nullopt;
+  }
+  return static_cast<T>(magnitude);
+}
+
+/// Fast path for casting a string of an optional '-' followed by digits with
+/// an optional fractional part, e.g. '-123.45', to REAL or DOUBLE. Applies if
+/// the digits without the decimal point form an integer that is exact in 'T'.
+/// This integer is then divided by a power of ten that is also exact in 'T',
+/// so the single rounding of the division gives the correctly rounded result.
+/// Returns std::nullopt for any other input.
+template <typename T>
+std::optional<T> tryParseFloatingPoint(const char* data, size_t size) {
+  static_assert(std::is_floating_point_v<T>);
+  // Integers of up to this many digits are exact in 'T'.
+  constexpr size_t kMaxDigits = std::is_same_v<T, float> ? 7 : 15;
+  static constexpr uint64_t kPowersOfTen[] = {
+      1,
+      10,
+      100,
+      1'000,
+      10'000,
+      100'000,
+      1'000'000,
+      10'000'000,
+      100'000'000,
+      1'000'000'000,
+      10'000'000'000,
+      100'000'000'000,
+      1'000'000'000'000,
+      10'000'000'000'000,
+      100'000'000'000'000,
+      1'000'000'000'000'000};
+
+  bool negative = false;
+  if (size > 0 && data[0] == '-') {
+    negative = true;
+    ++data;
+    --size;
+  }
+  const auto* point = static_cast<const char*>(std::memchr(data, '.', size));
+  const size_t numWholeDigits = point ? point - data : size;
+  const size_t numFractionDigits = point ? size - numWholeDigits - 1 : 0;
+  if (numWholeDigits == 0 || (point && numFractionDigits == 0) ||
+      numWholeDigits + numFractionDigits > kMaxDigits) {
+    return std::nullopt;
+  }
+  uint64_t whole;
+  uint64_t fraction = 0;
+  if (!parseDigits(data, numWholeDigits, whole) ||
+      (point && !parseDigits(point + 1, numFractionDigits, fraction))) {
+    return std::nullopt;
+  }
+  const T value =
+      static_cast<T>(whole * kPowersOfTen[numFractionDigits] + fraction) /
+      static_cast<T>(kPowersOfTen[numFractionDigits]);
+  return negative ? -value : value;
+}
+
 } // namespace detail
 
 /// To BOOLEAN converter.
@@ -308,6 +431,11 @@ struct Converter<
   }
 
   static Expected<T> tryCast(folly::StringPiece v) {
+    if constexpr (sizeof(T) <= sizeof(int64_t)) {
+      if (const auto result = detail::tryParseInteger<T>(v)) {
+        return result.value();
+      }
+    }
     if constexpr (TPolicy::truncate) {
       return convertStringToInt(v);
     } else {
@@ -316,19 +444,11 @@ struct Converter<
   }
 
   static Expected<T> tryCast(const StringView& v) {
-    if constexpr (TPolicy::truncate) {
-      return convertStringToInt(folly::StringPiece(v));
-    } else {
-      return detail::callFollyTo<T>(folly::StringPiece(v));
-    }
+    return tryCast(folly::StringPiece(v));
   }
 
   static Expected<T> tryCast(const std::string& v) {
-    if constexpr (TPolicy::truncate) {
-      return convertStringToInt(v);
-    } else {
-      return detail::callFollyTo<T>(v);
-    }
+    return tryCast(folly::StringPiece(v));
   }
 
   static Expected<T> tryCast(const bool& v) {
@@ -471,15 +591,22 @@ struct Converter<
   }
 
   static Expected<T> tryCast(folly::StringPiece v) {
+    // folly converts to REAL through double, which can round differently.
+    if constexpr (std::is_same_v<T, double>) {
+      if (const auto result =
+              detail::tryParseFloatingPoint<T>(v.data(), v.size())) {
+        return result.value();
+      }
+    }
     return tryCast<folly::StringPiece>(v);
   }
 
   static Expected<T> tryCast(const StringView& v) {
-    return tryCast<folly::StringPiece>(folly::StringPiece(v));
+    return tryCast(folly::StringPiece(v));
   }
 
   static Expected<T> tryCast(const std::string& v) {
-    return tryCast<std::string>(v);
+    return tryCast(folly::StringPiece(v));
   }
 
   static Expected<T> tryCast(const bool& v) {
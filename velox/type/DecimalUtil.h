@@ -91,6 +91,45 @@ class DecimalUtil {
         value);
   }
 
+  /// Returns true if 'value' fits in 64 bits. Arithmetic on such values can
+  /// use 64-bit instructions instead of 128-bit library calls.
+  template <typename T>
+  FOLLY_ALWAYS_INLINE static bool fitsInInt64(T value) {
+    if constexpr (sizeof(T) <= sizeof(int64_t)) {
+      return true;
+    } else {
+      return value == static_cast<int64_t>(value);
+    }
+  }
+
+  /// Sets 'result' to 'value' * 10^'rescale'. Returns false if the product
+  /// overflows int128_t. A value that fits in 64 bits times at most 10^19
+  /// cannot overflow, so the 128-bit overflow check is skipped.
+  template <typename T>
+  FOLLY_ALWAYS_INLINE static bool
+  rescaleWithOverflowCheck(T value, uint8_t rescale, int128_t& result) {
+    if (rescale <= 19 && fitsInInt64(value)) {
+      result = static_cast<int128_t>(value) * kPowersOfTen[rescale];
+      return true;
+    }
+    return !__builtin_mul_overflow(value, kPowersOfTen[rescale], &result);
+  }
+
+  /// Sets 'result' to 'a' * 'b'. Returns false if the product overflows
+  /// int128_t. The product of two values that fit in 64 bits cannot overflow,
+  /// so it is computed with one 64x64->128 bit multiplication.
+  template <typename A, typename B>
+  FOLLY_ALWAYS_INLINE static bool
+  multiplyWithOverflowCheck(A a, B b, int128_t& result) {
+    if (fitsInInt64(a) && fitsInInt64(b)) {
+      result = static_cast<int128_t>(static_cast<int64_t>(a)) *
+          static_cast<int64_t>(b);
+      return true;
+    }
+    return !__builtin_mul_overflow(
+        static_cast<int128_t>(a), static_cast<int128_t>(b), &result);
+  }
+
   // Returns true if the precision can represent the value.
   template <typename T>
   FOLLY_ALWAYS_INLINE static bool valueInPrecisionRange(
@@ -288,12 +327,41 @@ class DecimalUtil {
       resultSign *= -1;
       unsignedDivisor *= -1;
     }
-    unsignedDividendRescaled = checkedMultiply<R>(
-        unsignedDividendRescaled,
-        R(DecimalUtil::kPowersOfTen[aRescale]),
-        "Decimal");
-    R quotient = unsignedDividendRescaled / unsignedDivisor;
-    R remainder = unsignedDividendRescaled % unsignedDivisor;
+    if constexpr (std::is_same_v<R, int128_t>) {
+      int128_t rescaled;
+      if (!rescaleWithOverflowCheck(
+              unsignedDividendRescaled, aRescale, rescaled)) {
+        VELOX_ARITHMETIC_ERROR(
+            "Decimal overflow: {} * {}",
+            unsignedDividendRescaled,
+            DecimalUtil::kPowersOfTen[aRescale]);
+      }
+      unsignedDividendRescaled = rescaled;
+    } else {
+      unsignedDividendRescaled = checkedMultiply<R>(
+          unsignedDividendRescaled,
+          R(DecimalUtil::kPowersOfTen[aRescale]),
+          "Decimal");
+    }
+    R quotient;
+    R remainder;
+    if constexpr (sizeof(R) > sizeof(int64_t) || sizeof(B) > sizeof(int64_t)) {
+      // 128-bit division is a library call. Use the 64-bit division
+      // instruction if both non-negative operands fit in 64 bits.
+      constexpr int128_t kMax = std::numeric_limits<uint64_t>::max();
+      if (unsignedDividendRescaled <= kMax && unsignedDivisor <= kMax) {
+        const auto dividend = static_cast<uint64_t>(unsignedDividendRescaled);
+        const auto divisor = static_cast<uint64_t>(unsignedDivisor);
+        quotient = dividend / divisor;
+        remainder = dividend % divisor;
+      } else {
+        quotient = unsignedDividendRescaled / unsignedDivisor;
+        remainder = unsignedDividendRescaled % unsignedDivisor;
+      }
+    } else {
+      quotient = unsignedDividendRescaled / unsignedDivisor;
+      remainder = unsignedDividendRescaled % unsignedDivisor;
+    }
     if (!noRoundUp && static_cast<const B>(remainder) * 2 >= unsignedDivisor) {
       ++quotient;
     }
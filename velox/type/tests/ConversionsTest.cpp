@@ -1007,6 +1007,73 @@ TEST_F(ConversionsTest, toRealAndDouble) {
   }
 }
 
+TEST_F(ConversionsTest, parseNumbers) {
+  // Runs of 8 digits are parsed at once, the remainder digit by digit.
+  for (const auto* digits :
+       {"0", "7", "12345678", "123456789", "1234567812345678", "00000012"}) {
+    uint64_t value;
+    ASSERT_TRUE(detail::parseDigits(digits, strlen(digits), value));
+    ASSERT_EQ(value, folly::to<uint64_t>(digits)) << digits;
+  }
+  for (const auto* notDigits :
+       {"1234567/", "1234567:", "123 5678", "12345678a", "-1234567"}) {
+    uint64_t value;
+    ASSERT_FALSE(detail::parseDigits(notDigits, strlen(notDigits), value))
+        << notDigits;
+  }
+
+  EXPECT_EQ(
+      detail::tryParseInteger<int64_t>("9223372036854775807"),
+      std::numeric_limits<int64_t>::max());
+  EXPECT_EQ(
+      detail::tryParseInteger<int64_t>("-9223372036854775808"),
+      std::numeric_limits<int64_t>::min());
+  EXPECT_EQ(detail::tryParseInteger<int64_t>("+0012"), 12);
+  EXPECT_EQ(detail::tryParseInteger<int8_t>("-128"), -128);
+  EXPECT_EQ(detail::tryParseInteger<int8_t>("127"), 127);
+  // Out of range, too many digits and other forms are left to the general
+  // conversion.
+  EXPECT_FALSE(detail::tryParseInteger<int8_t>("128").has_value());
+  EXPECT_FALSE(detail::tryParseInteger<int8_t>("-129").has_value());
+  EXPECT_FALSE(
+      detail::tryParseInteger<int64_t>("9223372036854775808").has_value());
+  EXPECT_FALSE(
+      detail::tryParseInteger<int64_t>("00000000000000000001").has_value());
+  EXPECT_FALSE(detail::tryParseInteger<int32_t>(" 1").has_value());
+  EXPECT_FALSE(detail::tryParseInteger<int32_t>("1.5").has_value());
+  EXPECT_FALSE(detail::tryParseInteger<int32_t>("-").has_value());
+  EXPECT_FALSE(detail::tryParseInteger<int32_t>("").has_value());
+
+  auto parseDouble = [](const char* str) {
+    return detail::tryParseFloatingPoint<double>(str, strlen(str));
+  };
+  EXPECT_EQ(parseDouble("0.1"), 0.1);
+  EXPECT_EQ(parseDouble("-123.45"), -123.45);
+  EXPECT_EQ(parseDouble("12345678.1234567"), 12345678.1234567);
+  EXPECT_EQ(parseDouble("42"), 42.0);
+  EXPECT_TRUE(std::signbit(parseDouble("-0").value()));
+  EXPECT_FALSE(parseDouble("1234567890.1234567").has_value());
+  EXPECT_FALSE(parseDouble("1.").has_value());
+  EXPECT_FALSE(parseDouble(".5").has_value());
+  EXPECT_FALSE(parseDouble("1e5").has_value());
+  EXPECT_FALSE(parseDouble("+1.5").has_value());
+  EXPECT_FALSE(parseDouble("1.5 ").has_value());
+
+  EXPECT_EQ(detail::tryParseFloatingPoint<float>("1.234567", 8), 1.234567f);
+  EXPECT_FALSE(
+      detail::tryParseFloatingPoint<float>("1.2345678", 9).has_value());
+
+  // Results of the fast paths match those of the general conversion.
+  testConversion<std::string, int64_t>(
+      {"1234567890123456789", "-42", "+7"}, {1234567890123456789, -42, 7});
+  testConversion<std::string, int64_t>(
+      {"1234567890123456789", "-42", "+7"},
+      {1234567890123456789, -42, 7},
+      /*truncate*/ true);
+  testConversion<std::string, double>(
+      {"3.14159", "-0.001", "100"}, {3.14159, -0.001, 100.0});
+}
+
 TEST_F(ConversionsTest, toTimestamp) {
   // From string.
   {
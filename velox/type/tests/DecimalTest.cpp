@@ -272,6 +272,66 @@ TEST(DecimalTest, valueInPrecisionRange) {
       DecimalUtil::kLongDecimalMin - 1, LongDecimalType::kMaxPrecision));
 }
 
+TEST(DecimalTest, overflowChecks) {
+  ASSERT_TRUE(DecimalUtil::fitsInInt64<int64_t>(
+      std::numeric_limits<int64_t>::min()));
+  ASSERT_TRUE(DecimalUtil::fitsInInt64<int128_t>(-1));
+  ASSERT_FALSE(DecimalUtil::fitsInInt64<int128_t>(
+      static_cast<int128_t>(std::numeric_limits<int64_t>::max()) + 1));
+
+  int128_t result;
+  // 64-bit values rescaled by at most 10^19 never overflow.
+  ASSERT_TRUE(DecimalUtil::rescaleWithOverflowCheck<int64_t>(
+      std::numeric_limits<int64_t>::min(), 19, result));
+  ASSERT_EQ(
+      result,
+      static_cast<int128_t>(std::numeric_limits<int64_t>::min()) *
+          DecimalUtil::kPowersOfTen[19]);
+  ASSERT_TRUE(DecimalUtil::rescaleWithOverflowCheck<int128_t>(
+      DecimalUtil::kShortDecimalMax, 20, result));
+  ASSERT_EQ(
+      result,
+      DecimalUtil::kShortDecimalMax * DecimalUtil::kPowersOfTen[20]);
+  ASSERT_FALSE(DecimalUtil::rescaleWithOverflowCheck<int128_t>(
+      DecimalUtil::kLongDecimalMax, 2, result));
+
+  ASSERT_TRUE(DecimalUtil::multiplyWithOverflowCheck<int64_t, int64_t>(
+      std::numeric_limits<int64_t>::min(),
+      std::numeric_limits<int64_t>::min(),
+      result));
+  ASSERT_EQ(result, static_cast<int128_t>(1) << 126);
+  ASSERT_TRUE(DecimalUtil::multiplyWithOverflowCheck<int128_t, int64_t>(
+      DecimalUtil::kLongDecimalMax, -1, result));
+  ASSERT_EQ(result, DecimalUtil::kLongDecimalMin);
+  ASSERT_FALSE(DecimalUtil::multiplyWithOverflowCheck<int128_t, int128_t>(
+      DecimalUtil::kLongDecimalMax, 100, result));
+}
+
+TEST(DecimalTest, divideWithRoundUp) {
+  // Operands that fit in 64 bits use 64-bit division. Others use 128-bit
+  // division. Both round half away from zero.
+  int128_t result;
+  DecimalUtil::divideWithRoundUp<int128_t, int128_t, int128_t>(
+      result, 25, 10, false, 0, 0);
+  ASSERT_EQ(result, 3);
+  DecimalUtil::divideWithRoundUp<int128_t, int128_t, int128_t>(
+      result, -25, 10, false, 0, 0);
+  ASSERT_EQ(result, -3);
+  DecimalUtil::divideWithRoundUp<int128_t, int128_t, int128_t>(
+      result, 1, 3, false, 19, 0);
+  ASSERT_EQ(result, 3'333'333'333'333'333'333ULL);
+  DecimalUtil::divideWithRoundUp<int128_t, int128_t, int128_t>(
+      result, DecimalUtil::kLongDecimalMax, 7, false, 0, 0);
+  ASSERT_EQ(result, DecimalUtil::kLongDecimalMax / 7);
+  DecimalUtil::divideWithRoundUp<int128_t, int128_t, int64_t>(
+      result, 2, -3, true, 20, 0);
+  ASSERT_EQ(result, -DecimalUtil::kPowersOfTen[20] * 2 / 3);
+  VELOX_ASSERT_THROW(
+      (DecimalUtil::divideWithRoundUp<int128_t, int128_t, int128_t>(
+          result, DecimalUtil::kLongDecimalMax, 3, false, 1, 0)),
+      "Decimal overflow");
+}
+
 TEST(DecimalTest, computeAverage) {
   auto validateSameValues = [](int128_t value, int64_t maxCount) {
     SCOPED_TRACE(fmt::format("value={} maxCount={}", value, maxCount));
@@ -21,6 +21,7 @@
 #include "velox/vector/ComplexVector.h"
 #include "velox/vector/DecodedVector.h"
 #include "velox/vector/DictionaryVector.h"
+#include "velox/vector/FlatMapVector.h"
 #include "velox/vector/FlatVector.h"
 #include "velox/vector/LazyVector.h"
 #include "velox/vector/SequenceVector.h"
@@ -777,6 +778,8 @@ const VectorPtr& BaseVector::wrappedVectorShared(const VectorPtr& vector) {
                                    : vector;
     case VectorEncoding::Simple::LAZY:
       return wrappedVectorShared(loadedVectorShared(vector));
+    case VectorEncoding::Simple::FLAT_MAP:
+      return vector->asUnchecked<FlatMapVector>()->mapVector();
     default:
       return vector;
   }
@@ -869,6 +872,11 @@ void BaseVector::flattenVector(VectorPtr& vector) {
       BaseVector::flattenVector(loadedVector);
       return;
     }
+    case VectorEncoding::Simple::FLAT_MAP: {
+      vector = vector->asUnchecked<FlatMapVector>()->mapVector();
+      BaseVector::flattenVector(vector);
+      return;
+    }
     default:
       BaseVector::ensureWritable(
           SelectivityVector::empty(), vector->type(), vector->pool(), vector);
@@ -69,6 +69,11 @@ void DecodedVector::decode(
       isIdentityMapping_ = true;
       setBaseData(vector, rows);
       return;
+    case VectorEncoding::Simple::FLAT_MAP:
+      // Decodes the MapVector with the same maps.
+      isIdentityMapping_ = true;
+      setBaseData(*vector.wrappedVector(), rows);
+      return;
     case VectorEncoding::Simple::CONSTANT: {
       isConstantMapping_ = true;
       if (isLazyNotLoaded(vector)) {
@@ -176,6 +181,9 @@ void DecodedVector::combineWrappers(
       case VectorEncoding::Simple::MAP:
         setBaseData(*values, rows);
         return;
+      case VectorEncoding::Simple::FLAT_MAP:
+        setBaseData(*values->wrappedVector(), rows);
+        return;
       case VectorEncoding::Simple::DICTIONARY: {
         applyDictionaryWrapper(*values, rows);
         values = values->valueVector().get();
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/vector/FlatMapVector.h"
+
+#include "velox/vector/DecodedVector.h"
+
+namespace facebook::velox {
+
+FlatMapVector::FlatMapVector(
+    velox::memory::MemoryPool* pool,
+    const TypePtr& type,
+    BufferPtr nulls,
+    vector_size_t length,
+    VectorPtr distinctKeys,
+    std::vector<VectorPtr> mapValues,
+    std::vector<BufferPtr> inMaps,
+    std::optional<vector_size_t> nullCount)
+    : BaseVector(
+          pool,
+          type,
+          VectorEncoding::Simple::FLAT_MAP,
+          std::move(nulls),
+          length,
+          std::nullopt,
+          nullCount),
+      distinctKeys_(std::move(distinctKeys)),
+      mapValues_(std::move(mapValues)),
+      inMaps_(std::move(inMaps)) {
+  VELOX_CHECK_EQ(type->kind(), TypeKind::MAP);
+  VELOX_CHECK_NOT_NULL(distinctKeys_);
+  VELOX_CHECK_EQ(distinctKeys_->size(), mapValues_.size());
+  VELOX_CHECK_EQ(inMaps_.size(), mapValues_.size());
+  for (const auto& values : mapValues_) {
+    VELOX_CHECK_GE(values->size(), length);
+  }
+
+  const auto& keyType = type->childAt(0);
+  DecodedVector decodedKeys(*distinctKeys_);
+  for (column_index_t channel = 0; channel < mapValues_.size(); ++channel) {
+    VELOX_CHECK(!decodedKeys.isNullAt(channel), "Map keys cannot be null");
+    bool inserted;
+    switch (keyType->kind()) {
+      case TypeKind::TINYINT:
+        inserted = intKeyChannels_
+                       .emplace(decodedKeys.valueAt<int8_t>(channel), channel)
+                       .second;
+        break;
+      case TypeKind::SMALLINT:
+        inserted = intKeyChannels_
+                       .emplace(decodedKeys.valueAt<int16_t>(channel), channel)
+                       .second;
+        break;
+      case TypeKind::INTEGER:
+        inserted = intKeyChannels_
+                       .emplace(decodedKeys.valueAt<int32_t>(channel), channel)
+                       .second;
+        break;
+      case TypeKind::BIGINT:
+        inserted = intKeyChannels_
+                       .emplace(decodedKeys.valueAt<int64_t>(channel), channel)
+                       .second;
+        break;
+      case TypeKind::VARCHAR:
+      case TypeKind::VARBINARY:
+        inserted =
+            stringKeyChannels_
+                .emplace(decodedKeys.valueAt<StringView>(channel), channel)
+                .second;
+        break;
+      default:
+        VELOX_UNSUPPORTED(
+            "Unsupported key type for FlatMapVector: {}", keyType->toString());
+    }
+    VELOX_CHECK(inserted, "Duplicate key in FlatMapVector");
+  }
+}
+
+vector_size_t FlatMapVector::mapSizes(vector_size_t* rawSizes) const {
+  std::fill(rawSizes, rawSizes + length_, 0);
+  vector_size_t numEntries = 0;
+  for (column_index_t channel = 0; channel < mapValues_.size(); ++channel) {
+    forEachInMap(channel, [&](vector_size_t index) {
+      ++rawSizes[index];
+      ++numEntries;
+    });
+  }
+  return numEntries;
+}
+
+vector_size_t FlatMapVector::makeOffsetsAndSizes(
+    BufferPtr& offsets,
+    BufferPtr& sizes) const {
+  offsets = allocateOffsets(length_, pool_);
+  sizes = allocateSizes(length_, pool_);
+  auto* rawOffsets = offsets->asMutable<vector_size_t>();
+  auto* rawSizes = sizes->asMutable<vector_size_t>();
+  const auto numEntries = mapSizes(rawSizes);
+  vector_size_t offset = 0;
+  for (vector_size_t i = 0; i < length_; ++i) {
+    rawOffsets[i] = offset;
+    offset += rawSizes[i];
+  }
+  return numEntries;
+}
+
+void FlatMapVector::copyEntries(
+    const vector_size_t* rawOffsets,
+    BaseVector& keys,
+    BaseVector* values) const {
+  // Position of the next key of each map.
+  std::vector<vector_size_t> nextEntries(rawOffsets, rawOffsets + length_);
+  std::vector<CopyRange> keyRanges;
+  std::vector<CopyRange> valueRanges;
+  for (column_index_t channel = 0; channel < mapValues_.size(); ++channel) {
+    keyRanges.clear();
+    valueRanges.clear();
+    forEachInMap(channel, [&](vector_size_t index) {
+      const auto entry = nextEntries[index]++;
+      keyRanges.push_back(
+          {.sourceIndex = static_cast<vector_size_t>(channel),
+           .targetIndex = entry,
+           .count = 1});
+      valueRanges.push_back(
+          {.sourceIndex = index, .targetIndex = entry, .count = 1});
+    });
+    keys.copyRanges(distinctKeys_.get(), keyRanges);
+    if (values != nullptr) {
+      values->copyRanges(mapValues_[channel].get(), valueRanges);
+    }
+  }
+}
+
+ArrayVectorPtr FlatMapVector::mapKeysAsArray() const {
+  BufferPtr offsets;
+  BufferPtr sizes;
+  const auto numEntries = makeOffsetsAndSizes(offsets, sizes);
+  const auto& keyType = type_->childAt(0);
+  auto keys = BaseVector::create(keyType, numEntries, pool_);
+  copyEntries(offsets->as<vector_size_t>(), *keys, nullptr);
+  return std::make_shared<ArrayVector>(
+      pool_,
+      ARRAY(keyType),
+      nulls_,
+      length_,
+      std::move(offsets),
+      std::move(sizes),
+      std::move(keys),
+      nullCount_);
+}
+
+const VectorPtr& FlatMapVector::mapVector() const {
+  std::call_once(mapVectorOnce_, [&]() {
+    BufferPtr offsets;
+    BufferPtr sizes;
+    const auto numEntries = makeOffsetsAndSizes(offsets, sizes);
+    auto keys = BaseVector::create(type_->childAt(0), numEntries, pool_);
+    auto values = BaseVector::create(type_->childAt(1), numEntries, pool_);
+    copyEntries(offsets->as<vector_size_t>(), *keys, values.get());
+    mapVector_ = std::make_shared<MapVector>(
+        pool_,
+        type_,
+        nulls_,
+        length_,
+        std::move(offsets),
+        std::move(sizes),
+        std::move(keys),
+        std::move(values),
+        nullCount_);
+    mapVectorCreated_.store(true, std::memory_order_release);
+  });
+  return mapVector_;
+}
+
+bool FlatMapVector::containsNullAt(vector_size_t index) const {
+  if (isNullAt(index)) {
+    return true;
+  }
+  for (column_index_t channel = 0; channel < mapValues_.size(); ++channel) {
+    if (isInMap(channel, index) && mapValues_[channel]->containsNullAt(index)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool FlatMapVector::mayHaveNullsRecursive() const {
+  if (BaseVector::mayHaveNullsRecursive()) {
+    return true;
+  }
+  for (const auto& values : mapValues_) {
+    if (values->mayHaveNullsRecursive()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+VectorPtr FlatMapVector::copyPreserveEncodings() const {
+  std::vector<VectorPtr> mapValues;
+  mapValues.reserve(mapValues_.size());
+  for (const auto& values : mapValues_) {
+    mapValues.push_back(values->copyPreserveEncodings());
+  }
+  std::vector<BufferPtr> inMaps;
+  inMaps.reserve(inMaps_.size());
+  for (const auto& inMap : inMaps_) {
+    inMaps.push_back(AlignedBuffer::copy(pool_, inMap));
+  }
+  return std::make_shared<FlatMapVector>(
+      pool_,
+      type_,
+      AlignedBuffer::copy(pool_, nulls_),
+      length_,
+      distinctKeys_->copyPreserveEncodings(),
+      std::move(mapValues),
+      std::move(inMaps),
+      nullCount_);
+}
+
+VectorPtr FlatMapVector::slice(vector_size_t offset, vector_size_t length)
+    const {
+  std::vector<VectorPtr> mapValues;
+  mapValues.reserve(mapValues_.size());
+  for (const auto& values : mapValues_) {
+    mapValues.push_back(values->slice(offset, length));
+  }
+  std::vector<BufferPtr> inMaps;
+  inMaps.reserve(inMaps_.size());
+  for (const auto& inMap : inMaps_) {
+    inMaps.push_back(
+        inMap ? sliceBuffer(*BOOLEAN(), inMap, offset, length, pool_)
+              : nullptr);
+  }
+  return std::make_shared<FlatMapVector>(
+      pool_,
+      type_,
+      sliceNulls(offset, length),
+      length,
+      distinctKeys_,
+      std::move(mapValues),
+      std::move(inMaps));
+}
+
+uint64_t FlatMapVector::retainedSize() const {
+  auto size = BaseVector::retainedSize() + distinctKeys_->retainedSize();
+  for (column_index_t channel = 0; channel < mapValues_.size(); ++channel) {
+    size += mapValues_[channel]->retainedSize();
+    if (inMaps_[channel] != nullptr) {
+      size += inMaps_[channel]->capacity();
+    }
+  }
+  if (mapVectorCreated_.load(std::memory_order_acquire)) {
+    // The nulls are shared with 'this' and counted above.
+    size += mapVector_->retainedSize() - BaseVector::retainedSize();
+  }
+  return size;
+}
+
+uint64_t FlatMapVector::estimateFlatSize() const {
+  auto size = BaseVector::retainedSize() + distinctKeys_->retainedSize();
+  for (const auto& values : mapValues_) {
+    size += values->estimateFlatSize();
+  }
+  return size;
+}
+
+void FlatMapVector::validate(const VectorValidateOptions& options) const {
+  BaseVector::validate(options);
+  distinctKeys_->validate(options);
+  for (column_index_t channel = 0; channel < mapValues_.size(); ++channel) {
+    mapValues_[channel]->validate(options);
+    VELOX_CHECK_GE(mapValues_[channel]->size(), length_);
+    if (inMaps_[channel] != nullptr) {
+      VELOX_CHECK_GE(inMaps_[channel]->size(), bits::nbytes(length_));
+    }
+  }
+}
+
+} // namespace facebook::velox
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include <folly/container/F14Map.h>
+
+#include "velox/vector/ComplexVector.h"
+
+namespace facebook::velox {
+
+/// A vector of maps laid out like a DWRF flat map: one vector of values per
+/// distinct key and a bitmap per key telling which maps contain the key. A
+/// lookup of one key touches only the values of that key, so accessing a few
+/// keys of maps with hundreds of keys does not read the other keys.
+///
+/// The map at 'index' contains 'distinctKeys[channel]' with the value at
+/// 'index' in 'mapValues[channel]' if the map is not null and
+/// 'inMaps[channel]' is null or has bit 'index' set. The keys of each map are
+/// in channel order. Keys must be of an integer or string type.
+///
+/// The vector is read-only. mapVector() returns the same maps as a MapVector,
+/// materialized on first use. wrappedVector() returns that MapVector too, so
+/// that decoding, copying and comparing see a FlatMapVector like a MapVector.
+/// Vector functions receive that MapVector unless their metadata sets
+/// supportsFlatMapVectors.
+class FlatMapVector : public BaseVector {
+ public:
+  FlatMapVector(const FlatMapVector&) = delete;
+  FlatMapVector& operator=(const FlatMapVector&) = delete;
+
+  FlatMapVector(
+      velox::memory::MemoryPool* pool,
+      const TypePtr& type,
+      BufferPtr nulls,
+      vector_size_t length,
+      VectorPtr distinctKeys,
+      std::vector<VectorPtr> mapValues,
+      std::vector<BufferPtr> inMaps,
+      std::optional<vector_size_t> nullCount = std::nullopt);
+
+  const VectorPtr& distinctKeys() const {
+    return distinctKeys_;
+  }
+
+  column_index_t numDistinctKeys() const {
+    return mapValues_.size();
+  }
+
+  const VectorPtr& mapValuesAt(column_index_t channel) const {
+    return mapValues_[channel];
+  }
+
+  /// Returns the in-map bits of the key at 'channel'. nullptr means that all
+  /// non-null maps contain the key.
+  const BufferPtr& inMapsAt(column_index_t channel) const {
+    return inMaps_[channel];
+  }
+
+  /// Returns true if the map at 'index' contains the key at 'channel'.
+  bool isInMap(column_index_t channel, vector_size_t index) const {
+    if (isNullAt(index)) {
+      return false;
+    }
+    const auto& inMap = inMaps_[channel];
+    return inMap == nullptr || bits::isBitSet(inMap->as<uint64_t>(), index);
+  }
+
+  /// Returns the channel of an integer key or std::nullopt if no map contains
+  /// 'key'.
+  std::optional<column_index_t> keyChannel(int64_t key) const {
+    auto it = intKeyChannels_.find(key);
+    if (it == intKeyChannels_.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+  /// Returns the channel of a string key or std::nullopt if no map contains
+  /// 'key'.
+  std::optional<column_index_t> keyChannel(StringView key) const {
+    auto it = stringKeyChannels_.find(key);
+    if (it == stringKeyChannels_.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+  /// Sets 'rawSizes[i]' to the number of keys in the map at 'i' for all maps.
+  /// Null maps have size 0. Returns the total number of keys.
+  vector_size_t mapSizes(vector_size_t* rawSizes) const;
+
+  /// Returns the keys of each map as an array, without reading the values.
+  ArrayVectorPtr mapKeysAsArray() const;
+
+  /// Returns the maps as a MapVector. The MapVector is created on first use
+  /// and shares the nulls of 'this'. Safe to call from multiple threads.
+  const VectorPtr& mapVector() const;
+
+  bool containsNullAt(vector_size_t index) const override;
+
+  std::optional<int32_t> compare(
+      const BaseVector* other,
+      vector_size_t index,
+      vector_size_t otherIndex,
+      CompareFlags flags) const override {
+    return mapVector()->compare(other, index, otherIndex, flags);
+  }
+
+  uint64_t hashValueAt(vector_size_t index) const override {
+    return mapVector()->hashValueAt(index);
+  }
+
+  std::unique_ptr<SimpleVector<uint64_t>> hashAll() const override {
+    return mapVector()->hashAll();
+  }
+
+  const BaseVector* wrappedVector() const override {
+    return mapVector().get();
+  }
+
+  bool mayHaveNullsRecursive() const override;
+
+  void resize(vector_size_t /*newSize*/, bool /*setNotNull*/ = true)
+      override {
+    VELOX_UNSUPPORTED("FlatMapVector is read-only");
+  }
+
+  VectorPtr copyPreserveEncodings() const override;
+
+  VectorPtr slice(vector_size_t offset, vector_size_t length) const override;
+
+  /// Includes the MapVector returned by mapVector() if it has been created.
+  uint64_t retainedSize() const override;
+
+  /// Estimates the size from the value vectors, without materializing the
+  /// maps.
+  uint64_t estimateFlatSize() const override;
+
+  using BaseVector::toString;
+
+  std::string toString(vector_size_t index) const override {
+    return mapVector()->toString(index);
+  }
+
+  void validate(const VectorValidateOptions& options) const override;
+
+ private:
+  // Calls 'func(index)' for each map that contains the key at 'channel'.
+  template <typename Func>
+  void forEachInMap(column_index_t channel, Func func) const {
+    const auto& inMap = inMaps_[channel];
+    if (inMap != nullptr) {
+      bits::forEachSetBit(
+          inMap->as<uint64_t>(), 0, length_, [&](vector_size_t index) {
+            if (!rawNulls_ || !bits::isBitNull(rawNulls_, index)) {
+              func(index);
+            }
+          });
+    } else if (rawNulls_ != nullptr) {
+      bits::forEachSetBit(rawNulls_, 0, length_, func);
+    } else {
+      for (vector_size_t index = 0; index < length_; ++index) {
+        func(index);
+      }
+    }
+  }
+
+  // Allocates offsets and sizes for the keys of all maps in channel order.
+  // Returns the total number of keys.
+  vector_size_t makeOffsetsAndSizes(BufferPtr& offsets, BufferPtr& sizes)
+      const;
+
+  // Copies the keys, and the values if 'values' is not null, of all maps into
+  // the positions given by 'rawOffsets'.
+  void copyEntries(
+      const vector_size_t* rawOffsets,
+      BaseVector& keys,
+      BaseVector* values) const;
+
+  const VectorPtr distinctKeys_;
+  const std::vector<VectorPtr> mapValues_;
+  const std::vector<BufferPtr> inMaps_;
+
+  // Channel of each key. Only the map matching the key type is used.
+  folly::F14FastMap<int64_t, column_index_t> intKeyChannels_;
+  folly::F14FastMap<StringView, column_index_t> stringKeyChannels_;
+
+  // MapVector with the same maps, created once on first use.
+  // 'mapVectorCreated_' is set after 'mapVector_' is set.
+  mutable std::once_flag mapVectorOnce_;
+  mutable std::atomic_bool mapVectorCreated_{false};
+  mutable VectorPtr mapVector_;
+};
+
+using FlatMapVectorPtr = std::shared_ptr<FlatMapVector>;
+
+} // namespace facebook::velox
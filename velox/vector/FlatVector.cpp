@@ -17,6 +17,7 @@
 #include "velox/vector/FlatVector.h"
 #include "velox/vector/ComplexVector.h"
 #include "velox/vector/ConstantVector.h"
+#include "velox/vector/FlatMapVector.h"
 #include "velox/vector/TypeAliases.h"
 
 namespace facebook {
@@ -217,6 +218,15 @@ void FlatVector<StringView>::acquireSharedStringBuffersRecursive(
       return;
     }
 
+    case VectorEncoding::Simple::FLAT_MAP: {
+      auto* flatMap = source->asUnchecked<FlatMapVector>();
+      acquireSharedStringBuffersRecursive(flatMap->distinctKeys().get());
+      for (column_index_t i = 0; i < flatMap->numDistinctKeys(); ++i) {
+        acquireSharedStringBuffersRecursive(flatMap->mapValuesAt(i).get());
+      }
+      return;
+    }
+
     case VectorEncoding::Simple::CONSTANT: {
       // wrappedVector can be constant vector only if the underlying type is
       // primitive.
@@ -32,7 +32,8 @@ Simple mapNameToSimple(const std::string& name) {
       {"SEQUENCE", Simple::SEQUENCE},
       {"ROW", Simple::ROW},
       {"MAP", Simple::MAP},
-      {"ARRAY", Simple::ARRAY}};
+      {"ARRAY", Simple::ARRAY},
+      {"FLAT_MAP", Simple::FLAT_MAP}};
 
   if (vecNameMap.find(name) == vecNameMap.end()) {
     throw std::invalid_argument(
@@ -39,7 +39,8 @@ enum class Simple {
   MAP,
   ARRAY,
   LAZY,
-  FUNCTION
+  FUNCTION,
+  FLAT_MAP
 };
 
 inline std::ostream& operator<<(
@@ -66,6 +67,8 @@ inline std::ostream& operator<<(
       return out << "LAZY";
     case VectorEncoding::Simple::FUNCTION:
       return out << "FUNCTION";
+    case VectorEncoding::Simple::FLAT_MAP:
+      return out << "FLAT_MAP";
   }
   return out;
 }
@@ -16,6 +16,7 @@
 #include "velox/vector/VectorPrinter.h"
 #include <sstream>
 #include "velox/vector/ComplexVector.h"
+#include "velox/vector/FlatMapVector.h"
 
 namespace facebook::velox {
 
@@ -331,6 +332,19 @@ std::string printTypeAndEncodingTree(
       out << printTypeAndEncodingTree(*mapVector->mapValues(), newIndent);
       break;
     }
+    case VectorEncoding::Simple::FLAT_MAP: {
+      auto* flatMapVector = vector.as<FlatMapVector>();
+      printEncodingAndType(vector, indent, out);
+      out << indent << "Keys: " << std::endl;
+      out << printTypeAndEncodingTree(
+          *flatMapVector->distinctKeys(), newIndent);
+      for (auto i = 0; i < flatMapVector->numDistinctKeys(); ++i) {
+        out << indent << "Values " << i << ": " << std::endl;
+        out << printTypeAndEncodingTree(
+            *flatMapVector->mapValuesAt(i), newIndent);
+      }
+      break;
+    }
     case VectorEncoding::Simple::ROW: {
       printEncodingAndType(vector, indent, out);
       const auto* rowVector = vector.as<RowVector>();
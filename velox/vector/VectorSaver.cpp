@@ -16,6 +16,7 @@
 #include "velox/vector/VectorSaver.h"
 #include <fstream>
 #include "velox/vector/ComplexVector.h"
+#include "velox/vector/FlatMapVector.h"
 #include "velox/vector/FlatVector.h"
 
 namespace facebook::velox {
@@ -27,6 +28,7 @@ enum class Encoding : int8_t {
   kConstant = 1,
   kDictionary = 2,
   kLazy = 3,
+  kFlatMap = 4,
 };
 
 template <typename T>
@@ -84,6 +86,9 @@ void writeEncoding(VectorEncoding::Simple encoding, std::ostream& out) {
     case VectorEncoding::Simple::LAZY:
       write<int32_t>((int8_t)Encoding::kLazy, out);
       return;
+    case VectorEncoding::Simple::FLAT_MAP:
+      write<int32_t>((int8_t)Encoding::kFlatMap, out);
+      return;
     default:
       VELOX_UNSUPPORTED("Unsupported encoding: {}", mapSimpleToName(encoding));
   }
@@ -96,6 +101,7 @@ Encoding readEncoding(std::istream& in) {
     case Encoding::kConstant:
     case Encoding::kDictionary:
     case Encoding::kLazy:
+    case Encoding::kFlatMap:
       return encoding;
     default:
       VELOX_UNSUPPORTED("Unsupported encoding: {}", encoding);
@@ -520,6 +526,48 @@ VectorPtr readMapVector(
       pool, type, nulls, size, offsets, sizes, keys, values);
 }
 
+void writeFlatMapVector(const BaseVector& vector, std::ostream& out) {
+  // Nulls buffer.
+  writeOptionalBuffer(vector.nulls(), out);
+
+  // Distinct keys.
+  auto flatMap = vector.as<FlatMapVector>();
+  saveVector(*flatMap->distinctKeys(), out);
+
+  // Values and in-map buffer of each key.
+  for (column_index_t i = 0; i < flatMap->numDistinctKeys(); ++i) {
+    saveVector(*flatMap->mapValuesAt(i), out);
+    writeOptionalBuffer(flatMap->inMapsAt(i), out);
+  }
+}
+
+VectorPtr readFlatMapVector(
+    const TypePtr& type,
+    vector_size_t size,
+    std::istream& in,
+    memory::MemoryPool* pool) {
+  // Nulls buffer.
+  BufferPtr nulls = readOptionalBuffer(in, pool);
+
+  auto distinctKeys = restoreVector(in, pool);
+
+  std::vector<VectorPtr> mapValues(distinctKeys->size());
+  std::vector<BufferPtr> inMaps(distinctKeys->size());
+  for (auto i = 0; i < distinctKeys->size(); ++i) {
+    mapValues[i] = restoreVector(in, pool);
+    inMaps[i] = readOptionalBuffer(in, pool);
+  }
+
+  return std::make_shared<FlatMapVector>(
+      pool,
+      type,
+      nulls,
+      size,
+      std::move(distinctKeys),
+      std::move(mapValues),
+      std::move(inMaps));
+}
+
 void writeLazyVector(const BaseVector& vector, std::ostream& out) {
   auto lazyVector = dynamic_cast<const LazyVector*>(&vector);
   // check if the vector was loaded.
@@ -619,6 +667,9 @@ void saveVector(const BaseVector& vector, std::ostream& out) {
     case VectorEncoding::Simple::MAP:
       writeMapVector(vector, out);
       return;
+    case VectorEncoding::Simple::FLAT_MAP:
+      writeFlatMapVector(vector, out);
+      return;
     case VectorEncoding::Simple::LAZY:
       writeLazyVector(vector, out);
       return;
@@ -664,6 +715,8 @@ VectorPtr restoreVector(std::istream& in, memory::MemoryPool* pool) {
       return readConstantVector(type, size, in, pool);
     case Encoding::kDictionary:
       return readDictionaryVector(type, size, in, pool);
+    case Encoding::kFlatMap:
+      return readFlatMapVector(type, size, in, pool);
     case Encoding::kLazy:
       return readLazyVector(type, size, in, pool);
     default:
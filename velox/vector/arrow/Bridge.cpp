@@ -994,6 +994,15 @@ void exportToArrowImpl(
       exportMaps(
           *vec.asUnchecked<MapVector>(), rows, options, out, pool, *holder);
       break;
+    case VectorEncoding::Simple::FLAT_MAP:
+      exportMaps(
+          *vec.wrappedVector()->asUnchecked<MapVector>(),
+          rows,
+          options,
+          out,
+          pool,
+          *holder);
+      break;
     case VectorEncoding::Simple::DICTIONARY:
       options.flattenDictionary
           ? exportFlattenedVector(vec, rows, options, out, pool, *holder)
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/vector/DecodedVector.h"
+#include "velox/vector/FlatMapVector.h"
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::test;
+
+class FlatMapVectorTest : public testing::Test, public VectorTestBase {
+ protected:
+  static void SetUpTestCase() {
+    memory::MemoryManager::testingSetInstance({});
+  }
+
+  // Maps with keys 1, 2 and 3. Key 1 is in all maps, row 3 is null.
+  //  {1: 10, 2: 20}, {1: 11, 3: 31}, {1: 12, 2: 22}, null
+  std::shared_ptr<FlatMapVector> makeFlatMap() {
+    return makeFlatMapVector(
+        makeFlatVector<int64_t>({1, 2, 3}),
+        {makeFlatVector<int64_t>({10, 11, 12, 13}),
+         makeFlatVector<int64_t>({20, 21, 22, 23}),
+         makeFlatVector<int64_t>({30, 31, 32, 33})},
+        {std::nullopt,
+         std::vector<bool>{true, false, true, false},
+         std::vector<bool>{false, true, false, false}},
+        {false, false, false, true});
+  }
+
+  MapVectorPtr makeExpected() {
+    return makeNullableMapVector<int64_t, int64_t>({
+        {{{1, 10}, {2, 20}}},
+        {{{1, 11}, {3, 31}}},
+        {{{1, 12}, {2, 22}}},
+        std::nullopt,
+    });
+  }
+};
+
+TEST_F(FlatMapVectorTest, mapVector) {
+  auto flatMap = makeFlatMap();
+  ASSERT_EQ(flatMap->encoding(), VectorEncoding::Simple::FLAT_MAP);
+  ASSERT_EQ(flatMap->numDistinctKeys(), 3);
+
+  const auto& mapVector = flatMap->mapVector();
+  ASSERT_EQ(mapVector->encoding(), VectorEncoding::Simple::MAP);
+  assertEqualVectors(makeExpected(), mapVector);
+
+  // The MapVector is created once.
+  ASSERT_EQ(flatMap->mapVector().get(), mapVector.get());
+  ASSERT_EQ(flatMap->wrappedVector(), mapVector.get());
+  ASSERT_EQ(BaseVector::wrappedVectorShared(flatMap).get(), mapVector.get());
+}
+
+TEST_F(FlatMapVectorTest, concurrentMapVector) {
+  auto flatMap = makeFlatMap();
+  std::vector<const BaseVector*> mapVectors(4);
+  std::vector<std::thread> threads;
+  for (auto i = 0; i < mapVectors.size(); ++i) {
+    threads.emplace_back(
+        [&, i]() { mapVectors[i] = flatMap->mapVector().get(); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto* mapVector : mapVectors) {
+    ASSERT_EQ(mapVector, flatMap->mapVector().get());
+  }
+  assertEqualVectors(makeExpected(), flatMap->mapVector());
+}
+
+TEST_F(FlatMapVectorTest, retainedSize) {
+  auto flatMap = makeFlatMap();
+  const auto size = flatMap->retainedSize();
+  ASSERT_GT(size, 0);
+
+  // The MapVector is counted once created. Its nulls are shared.
+  const auto& mapVector = flatMap->mapVector();
+  ASSERT_EQ(
+      flatMap->retainedSize(),
+      size + mapVector->retainedSize() - flatMap->nulls()->capacity());
+}
+
+TEST_F(FlatMapVectorTest, keyChannel) {
+  auto flatMap = makeFlatMap();
+  ASSERT_EQ(flatMap->keyChannel(1), 0);
+  ASSERT_EQ(flatMap->keyChannel(3), 2);
+  ASSERT_FALSE(flatMap->keyChannel(4).has_value());
+
+  ASSERT_TRUE(flatMap->isInMap(0, 1));
+  ASSERT_TRUE(flatMap->isInMap(1, 2));
+  ASSERT_FALSE(flatMap->isInMap(1, 1));
+  ASSERT_FALSE(flatMap->isInMap(0, 3));
+
+  auto stringFlatMap = std::make_shared<FlatMapVector>(
+      pool(),
+      MAP(VARCHAR(), BIGINT()),
+      nullptr,
+      2,
+      makeFlatVector<std::string>({"a", "a long key that is not inlined"}),
+      std::vector<VectorPtr>{
+          makeFlatVector<int64_t>({1, 2}), makeFlatVector<int64_t>({3, 4})},
+      std::vector<BufferPtr>{nullptr, nullptr});
+  ASSERT_EQ(stringFlatMap->keyChannel(StringView("a")), 0);
+  ASSERT_EQ(
+      stringFlatMap->keyChannel(StringView("a long key that is not inlined")),
+      1);
+  ASSERT_FALSE(stringFlatMap->keyChannel(StringView("b")).has_value());
+}
+
+TEST_F(FlatMapVectorTest, duplicateKeys) {
+  VELOX_ASSERT_THROW(
+      std::make_shared<FlatMapVector>(
+          pool(),
+          MAP(BIGINT(), BIGINT()),
+          nullptr,
+          2,
+          makeFlatVector<int64_t>({1, 1}),
+          std::vector<VectorPtr>{
+              makeFlatVector<int64_t>({1, 2}),
+              makeFlatVector<int64_t>({3, 4})},
+          std::vector<BufferPtr>{nullptr, nullptr}),
+      "Duplicate key");
+}
+
+TEST_F(FlatMapVectorTest, mapSizesAndKeys) {
+  auto flatMap = makeFlatMap();
+  std::vector<vector_size_t> sizes(flatMap->size());
+  ASSERT_EQ(flatMap->mapSizes(sizes.data()), 6);
+  ASSERT_EQ(sizes, (std::vector<vector_size_t>{2, 2, 2, 0}));
+
+  auto keys = flatMap->mapKeysAsArray();
+  assertEqualVectors(
+      makeNullableArrayVector<int64_t>({{{1, 2}}, {{1, 3}}, {{1, 2}}, {}}),
+      keys);
+  ASSERT_TRUE(keys->isNullAt(3));
+}
+
+TEST_F(FlatMapVectorTest, decodeAndCopy) {
+  auto flatMap = makeFlatMap();
+  auto expected = makeExpected();
+
+  DecodedVector decoded(*flatMap);
+  ASSERT_TRUE(decoded.isIdentityMapping());
+  ASSERT_EQ(decoded.base()->encoding(), VectorEncoding::Simple::MAP);
+  for (auto i = 0; i < flatMap->size(); ++i) {
+    ASSERT_EQ(decoded.isNullAt(i), expected->isNullAt(i));
+    ASSERT_TRUE(expected->equalValueAt(decoded.base(), i, decoded.index(i)));
+  }
+
+  auto target = BaseVector::create(flatMap->type(), flatMap->size(), pool());
+  target->copy(flatMap.get(), 0, 0, flatMap->size());
+  assertEqualVectors(expected, target);
+
+  for (auto i = 0; i < flatMap->size(); ++i) {
+    ASSERT_TRUE(flatMap->equalValueAt(expected.get(), i, i));
+    ASSERT_EQ(flatMap->hashValueAt(i), expected->hashValueAt(i));
+  }
+}
+
+TEST_F(FlatMapVectorTest, slice) {
+  auto flatMap = makeFlatMap();
+  auto slice = flatMap->slice(1, 3);
+  ASSERT_EQ(slice->encoding(), VectorEncoding::Simple::FLAT_MAP);
+  assertEqualVectors(
+      makeExpected()->slice(1, 3),
+      slice->asUnchecked<FlatMapVector>()->mapVector());
+
+  auto copy = flatMap->copyPreserveEncodings();
+  ASSERT_EQ(copy->encoding(), VectorEncoding::Simple::FLAT_MAP);
+  assertEqualVectors(
+      makeExpected(), copy->asUnchecked<FlatMapVector>()->mapVector());
+}
+
+TEST_F(FlatMapVectorTest, readOnly) {
+  auto flatMap = makeFlatMap();
+  VELOX_ASSERT_THROW(flatMap->resize(10), "FlatMapVector is read-only");
+}
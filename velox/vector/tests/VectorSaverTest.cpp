@@ -22,6 +22,7 @@
 #include "velox/functions/prestosql/types/HyperLogLogType.h"
 #include "velox/functions/prestosql/types/JsonType.h"
 #include "velox/functions/prestosql/types/TimestampWithTimeZoneType.h"
+#include "velox/vector/FlatMapVector.h"
 #include "velox/vector/fuzzer/VectorFuzzer.h"
 #include "velox/vector/tests/utils/VectorTestBase.h"
 
@@ -81,6 +82,20 @@ class VectorSaverTest : public testing::Test, public VectorTestBase {
             expected->as<MapVector>()->mapValues(),
             actual->as<MapVector>()->mapValues());
         break;
+      case VectorEncoding::Simple::FLAT_MAP: {
+        auto expectedFlatMap = expected->as<FlatMapVector>();
+        auto actualFlatMap = actual->as<FlatMapVector>();
+        assertEqualEncodings(
+            expectedFlatMap->distinctKeys(), actualFlatMap->distinctKeys());
+        for (auto i = 0; i < expectedFlatMap->numDistinctKeys(); ++i) {
+          assertEqualEncodings(
+              expectedFlatMap->mapValuesAt(i), actualFlatMap->mapValuesAt(i));
+          ASSERT_EQ(
+              expectedFlatMap->inMapsAt(i) != nullptr,
+              actualFlatMap->inMapsAt(i) != nullptr);
+        }
+        break;
+      }
       case VectorEncoding::Simple::ROW: {
         auto expectedRow = expected->as<RowVector>();
         auto actualRow = actual->as<RowVector>();
@@ -423,6 +438,33 @@ TEST_F(VectorSaverTest, map) {
   testRoundTrip(opts, MAP(BIGINT(), VARCHAR()));
 }
 
+TEST_F(VectorSaverTest, flatMap) {
+  auto inMap = AlignedBuffer::allocate<bool>(4, pool(), false);
+  bits::setBit(inMap->asMutable<uint64_t>(), 1);
+  bits::setBit(inMap->asMutable<uint64_t>(), 2);
+
+  testRoundTrip(std::make_shared<FlatMapVector>(
+      pool(),
+      MAP(BIGINT(), VARCHAR()),
+      makeNulls({false, false, true, false}),
+      4,
+      makeFlatVector<int64_t>({1, 2}),
+      std::vector<VectorPtr>{
+          makeFlatVector<std::string>({"a", "b", "c", "d"}),
+          makeConstant<std::string>("a long string that is not inlined", 4)},
+      std::vector<BufferPtr>{nullptr, inMap}));
+
+  // No keys.
+  testRoundTrip(std::make_shared<FlatMapVector>(
+      pool(),
+      MAP(VARCHAR(), BIGINT()),
+      nullptr,
+      3,
+      makeFlatVector<std::string>(std::vector<std::string>{}),
+      std::vector<VectorPtr>{},
+      std::vector<BufferPtr>{}));
+}
+
 TEST_F(VectorSaverTest, constantInteger) {
   testRoundTrip(makeConstant<int64_t>(-1234987634, 100));
   testRoundTrip(makeConstant<int32_t>(12389, 100));
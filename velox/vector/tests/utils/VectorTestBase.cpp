@@ -110,6 +110,41 @@ BufferPtr VectorTestBase::makeNulls(const std::vector<bool>& values) {
   return nulls;
 }
 
+std::shared_ptr<FlatMapVector> VectorTestBase::makeFlatMapVector(
+    const VectorPtr& distinctKeys,
+    const std::vector<VectorPtr>& mapValues,
+    const std::vector<std::optional<std::vector<bool>>>& inMaps,
+    const std::vector<bool>& nulls) {
+  VELOX_CHECK(!mapValues.empty());
+  VELOX_CHECK_EQ(mapValues.size(), inMaps.size());
+  const auto size = mapValues[0]->size();
+
+  std::vector<BufferPtr> inMapBuffers;
+  inMapBuffers.reserve(inMaps.size());
+  for (const auto& inMap : inMaps) {
+    if (!inMap.has_value()) {
+      inMapBuffers.push_back(nullptr);
+      continue;
+    }
+    VELOX_CHECK_EQ(inMap->size(), size);
+    auto buffer = AlignedBuffer::allocate<bool>(size, pool(), false);
+    auto* rawInMap = buffer->asMutable<uint64_t>();
+    for (auto i = 0; i < size; ++i) {
+      bits::setBit(rawInMap, i, (*inMap)[i]);
+    }
+    inMapBuffers.push_back(std::move(buffer));
+  }
+
+  return std::make_shared<FlatMapVector>(
+      pool(),
+      MAP(distinctKeys->type(), mapValues[0]->type()),
+      nulls.empty() ? nullptr : makeNulls(nulls),
+      size,
+      distinctKeys,
+      mapValues,
+      std::move(inMapBuffers));
+}
+
 std::vector<RowVectorPtr> VectorTestBase::split(
     const RowVectorPtr& vector,
     int32_t n) {
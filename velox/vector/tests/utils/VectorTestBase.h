@@ -19,6 +19,7 @@
 #include <folly/executors/CPUThreadPoolExecutor.h>
 
 #include "velox/common/base/RuntimeMetrics.h"
+#include "velox/vector/FlatMapVector.h"
 #include "velox/vector/FlatVector.h"
 #include "velox/vector/tests/utils/VectorMaker.h"
 
@@ -702,6 +703,15 @@ class VectorTestBase {
   /// Creates a null buffer from a vector of booleans.
   BufferPtr makeNulls(const std::vector<bool>& values);
 
+  /// Creates a FlatMapVector with one value vector per key in 'distinctKeys'.
+  /// 'inMaps[i]' tells which maps contain the key at 'i'. std::nullopt means
+  /// that all non-null maps contain it. 'nulls' tells which maps are null.
+  std::shared_ptr<FlatMapVector> makeFlatMapVector(
+      const VectorPtr& distinctKeys,
+      const std::vector<VectorPtr>& mapValues,
+      const std::vector<std::optional<std::vector<bool>>>& inMaps,
+      const std::vector<bool>& nulls = {});
+
   static VectorPtr
   wrapInDictionary(BufferPtr indices, vector_size_t size, VectorPtr vector);
 